@@ -0,0 +1,103 @@
+//---------------------------------------------------------------------------------------
+// Copyright (c) 2001-2019 by PDFTron Systems Inc. All Rights Reserved.
+// Consult legal.txt regarding legal and license information.
+//---------------------------------------------------------------------------------------
+#ifndef PDFTRON_H_CPPCommonByteView
+#define PDFTRON_H_CPPCommonByteView
+
+#include <Common/BasicTypes.h>
+#include <stddef.h>
+#include <string.h>
+#include <vector>
+
+namespace pdftron {
+
+/**
+ * ByteView is a non-owning, read-only view of a sequence of bytes, such as
+ * the buffer of an SDF/Cos string (Obj::GetBufferView()) or the buffered
+ * window of a filter (Filters::FilterView).
+ *
+ * A ByteView does not copy the bytes. The underlying buffer must stay valid
+ * for as long as the view is used; the functions that return a ByteView
+ * document how long that is. Use ToVector() to obtain an owning copy.
+ */
+class ByteView
+{
+public:
+
+	/**
+	 * Create an empty view.
+	 */
+	ByteView() : m_data(0), m_size(0) {}
+
+	/**
+	 * Create a view of the given buffer.
+	 *
+	 * @param data a pointer to the first byte. Can be NULL if 'size' is 0.
+	 * @param size the number of bytes in the view.
+	 */
+	ByteView(const UChar* data, size_t size) : m_data(data), m_size(size) {}
+
+	/**
+	 * @return the number of bytes in the view.
+	 */
+	size_t Size() const { return m_size; }
+
+	/**
+	 * @return true if the view does not contain any bytes.
+	 */
+	bool Empty() const { return m_size == 0; }
+
+	/**
+	 * @return a pointer to the viewed bytes.
+	 */
+	const UChar* Data() const { return m_data; }
+
+	/**
+	 * @return the byte at the given index. 'idx' must be in the range
+	 * [0, Size()).
+	 */
+	UChar operator[](size_t idx) const { return m_data[idx]; }
+
+#ifndef SWIG
+	const UChar* begin() const { return m_data; }
+	const UChar* end() const { return m_data + m_size; }
+#endif
+
+	/**
+	 * @return a view of at most 'count' bytes starting at 'off'. A 'count'
+	 * of (size_t)-1 means the rest of the view.
+	 */
+	ByteView SubView(size_t off, size_t count = (size_t)-1) const;
+
+	/**
+	 * @return the offset of the first occurrence of 'value' at or after
+	 * 'off', or (size_t)-1 if the view does not contain it.
+	 */
+	size_t Find(UChar value, size_t off = 0) const;
+
+	/**
+	 * @return a new vector containing a copy of the viewed bytes.
+	 */
+	std::vector<unsigned char> ToVector() const;
+
+	/**
+	 * Appends a copy of the viewed bytes to a vector.
+	 */
+	void AppendTo(std::vector<unsigned char>& out) const;
+
+	friend bool operator == (const ByteView& v1, const ByteView& v2) { return v1.m_size == v2.m_size && (v1.m_size == 0 || memcmp(v1.m_data, v2.m_data, v1.m_size) == 0); }
+	friend bool operator != (const ByteView& v1, const ByteView& v2) { return !(v1 == v2); }
+
+private:
+	const UChar* m_data;
+	size_t m_size;
+};
+
+
+#include <Impl/ByteView.inl>
+
+
+};	// namespace pdftron
+
+#endif // PDFTRON_H_CPPCommonByteView
@@ -10,7 +10,24 @@
 #include <Common/Exception.h>
 #include <string.h>
 
-#define REX(action) { TRN_Exception ex=action; if(ex!=0) throw Common::Exception(ex); }
+// Set when the compiler supports C++11 (rvalue references, <thread>, <atomic>).
+// Parts of the wrapper layer that depend on these features are compiled only
+// when this macro is defined.
+#if !defined(PDFTRON_CPP11) && !defined(SWIG)
+#if __cplusplus >= 201103L || (defined(_MSC_VER) && _MSC_VER >= 1900)
+#define PDFTRON_CPP11 1
+#endif
+#endif
+
+#ifdef PDFTRON_CPP11
+#include <utility>
+#endif
+
+#define REX(action) { TRN_Exception ex=action; if(ex!=0) PDFTRON_THROW(Common::Exception(ex)); }
+// Like REX, but also leaves the calling function with 'value' when errors are
+// not thrown (PDFTRON_NO_EXCEPTIONS), for code that must not go on after a failure.
+#define REX_RET(action, value) { TRN_Exception ex=action; if(ex!=0) { PDFTRON_THROW(Common::Exception(ex)); return value; } }
+#define REX_RET_VOID(action) { TRN_Exception ex=action; if(ex!=0) { PDFTRON_THROW(Common::Exception(ex)); return; } }
 #define DREX(impl, destroy_action) \
 	if (impl) {\
 		destroy_action;\
@@ -18,18 +35,18 @@
 	}
 #define DREX_NO_IMPL(destroy_action) destroy_action
 
-#define RetObj(ex) TRN_Obj result; REX(ex); return SDF::Obj(result);
-#define RetBool(ex) TRN_Bool result; REX(ex); return TBToB(result);
-#define RetInt(ex) int result; REX(ex); return result;
-#define RetCCS(ex) const char* result; REX(ex); return result;
-#define RetDbl(ex) double result; REX(ex); return result;
-#define RetStr(ex) TRN_UString result; REX(ex); return UString(result);
+#define RetObj(ex) TRN_Obj result = 0; REX(ex); return SDF::Obj(result);
+#define RetBool(ex) TRN_Bool result = 0; REX(ex); return TBToB(result);
+#define RetInt(ex) int result = 0; REX(ex); return result;
+#define RetCCS(ex) const char* result = 0; REX(ex); return result;
+#define RetDbl(ex) double result = 0; REX(ex); return result;
+#define RetStr(ex) TRN_UString result = 0; REX(ex); return UString(result);
 
-#define RetPC(ex) TRN_PatternColor result; REX(ex); return PatternColor(result);
-#define RetFont(ex) TRN_Font result; REX(ex); return Font(result);
-#define RetRec(ex) TRN_Rect result; REX(ex); return *((Rect*)&result);
-#define RetMtx(ex) TRN_Matrix2D result; REX(ex); return *((Common::Matrix2D*)&result)
+#define RetPC(ex) TRN_PatternColor result = 0; REX(ex); return PatternColor(result);
+#define RetFont(ex) TRN_Font result = 0; REX(ex); return Font(result);
+#define RetRec(ex) TRN_Rect result = TRN_Rect(); REX(ex); return *((Rect*)&result);
+#define RetMtx(ex) TRN_Matrix2D result = TRN_Matrix2D(); REX(ex); return *((Common::Matrix2D*)&result)
 #define RetCPT(ex) TRN_ColorPt result; TRN_ColorPtInit(0,0,0,0, &result); REX(ex); return *((ColorPt*)&result)
-#define RetFDFField(ex) TRN_FDFField result; REX(ex); return *((FDFField*)&result)
+#define RetFDFField(ex) TRN_FDFField result = TRN_FDFField(); REX(ex); return *((FDFField*)&result)
 
 #endif // PDFTRON_H_CPPCommonCommon
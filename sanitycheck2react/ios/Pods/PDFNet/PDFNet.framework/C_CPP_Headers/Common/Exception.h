@@ -11,6 +11,34 @@
 #include <cstdio>
 #include <C/Common/TRN_Exception.h>
 
+// Error handling policy. By default errors reported by PDFNet are thrown as
+// Common::Exception. When PDFTRON_NO_EXCEPTIONS is defined (it is defined
+// automatically when the compiler has exceptions disabled, e.g. with
+// -fno-exceptions), the wrapper does not throw or catch. Instead the error is
+// stored as the calling thread's last error (see Common::GetLastException())
+// and passed to the handler installed with Common::SetErrorHandler(), and
+// execution continues: a function whose native call failed returns a null
+// object, 0 or false. Errors reported on the worker threads of the
+// multi-threaded helpers (e.g. ParallelTextExtractor) are passed on to the
+// thread that called them.
+#if !defined(PDFTRON_NO_EXCEPTIONS) && !defined(SWIG)
+#if (defined(__GNUC__) && !defined(__EXCEPTIONS)) || (defined(_MSC_VER) && !defined(_CPPUNWIND))
+#define PDFTRON_NO_EXCEPTIONS 1
+#endif
+#endif
+
+#ifdef PDFTRON_NO_EXCEPTIONS
+#define PDFTRON_THROW(exception) pdftron::Common::ReportError(exception)
+#define PDFTRON_TRY if (true)
+#define PDFTRON_CATCH(decl) else
+#define PDFTRON_RETHROW ((void)0)
+#else
+#define PDFTRON_THROW(exception) throw exception
+#define PDFTRON_TRY try
+#define PDFTRON_CATCH(decl) catch (decl)
+#define PDFTRON_RETHROW throw
+#endif
+
 namespace pdftron { 
 	namespace Common {
 
@@ -114,6 +142,59 @@ inline std::ostream& operator<<(std::ostream& stream, Exception& e)
 	return e.Print(stream);
 }
 
+#ifdef PDFTRON_NO_EXCEPTIONS
+/**
+ * The type of the function called when an error is reported while exceptions
+ * are disabled (PDFTRON_NO_EXCEPTIONS).
+ */
+typedef void (*ErrorHandler)(Exception& e);
+
+/**
+ * Sets the function called for every error reported while exceptions are
+ * disabled, for example to log the error or to abort the program. The
+ * handler is called on the thread that caused the error. Pass 0 (the
+ * default) to only record the error.
+ *
+ * @note The handler is shared by all threads and should be set before other
+ * threads start to use PDFNet.
+ */
+void SetErrorHandler(ErrorHandler handler);
+
+/**
+ * @return true if an error was reported on the calling thread since the last
+ * call to ClearLastException().
+ */
+bool HasError();
+
+/**
+ * @return the last error reported on the calling thread. Only valid if
+ * HasError() returns true.
+ */
+Exception GetLastException();
+
+/**
+ * Clears the last error of the calling thread.
+ *
+ * A typical tight loop that checks for errors without exceptions:
+ * @code
+ * Common::ClearLastException();
+ * for (DictIterator itr = dict.GetDictIterator(); itr.HasNext(); itr.Next()) {
+ *     ...
+ * }
+ * if (Common::HasError()) {
+ *     printf("%s\n", Common::GetLastException().what());
+ * }
+ * @endcode
+ */
+void ClearLastException();
+
+/**
+ * Records an error as the last error of the calling thread and calls the
+ * error handler. This is what PDFTRON_THROW() does when exceptions are disabled.
+ */
+void ReportError(const Exception& e);
+#endif
+
 #include <Impl/Exception.inl>
 
 	};	// namespace Common
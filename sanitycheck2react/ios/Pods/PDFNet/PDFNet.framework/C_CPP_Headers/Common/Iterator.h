@@ -9,6 +9,11 @@
 #include <C/Common/TRN_Types.h>
 #include <C/Common/TRN_Iterator.h>
 
+#ifdef PDFTRON_CPP11
+#include <cstddef>
+#include <iterator>
+#include <vector>
+#endif
 
 namespace pdftron {
 	namespace Common {
@@ -39,7 +44,7 @@ public:
 	 * Advances the iterator to the next element of the collection.
 	 */
 	inline void Next() {
-		BASE_ASSERT(mp_impl, "Null Iterator");
+		BASE_ASSERT_RET_VOID(mp_impl, "Null Iterator");
 		REX(TRN_IteratorNext(mp_impl));
 	}
 
@@ -48,9 +53,9 @@ public:
 	 * @return the current element in the collection
 	 */
 	inline T& Current() {
-		BASE_ASSERT(mp_impl, "Null Iterator");
-		TRN_ItrData result;	
-		REX(TRN_IteratorCurrent(mp_impl,&result));
+		BASE_ASSERT_RET(mp_impl, "Null Iterator", NullItem());
+		TRN_ItrData result = 0;
+		REX_RET(TRN_IteratorCurrent(mp_impl,&result), NullItem());
 		return *((T*)result);
 	}
 
@@ -59,33 +64,60 @@ public:
 	 * next element; false if the iterator is no longer valid. 
 	 */
 	inline bool HasNext() {
-		BASE_ASSERT(mp_impl, "Null Iterator");
-		TRN_Bool result;
+		BASE_ASSERT_RET(mp_impl, "Null Iterator", false);
+		TRN_Bool result = 0;
 		REX(TRN_IteratorHasNext(mp_impl,&result));
 		return TBToB(result);
 	}
 	
 	/**
-	 * Copy constructor.
+	 * Copy constructor. A copy of a null (e.g. moved-from) iterator is null.
 	 */
 	inline Iterator(const Iterator& c) : mp_impl(0) {
-		REX(TRN_IteratorAssign(c.mp_impl,&mp_impl));
+		if (c.mp_impl) REX(TRN_IteratorAssign(c.mp_impl,&mp_impl));
 	}
 
 	/**
 	 * Assignment operator.
 	 */
 	inline Iterator<T>& operator=(const Iterator<T>& other) {
+		if (!other.mp_impl) {
+			DREX(mp_impl, TRN_IteratorDestroy(mp_impl));
+			return *this;
+		}
 		REX(TRN_IteratorAssign(other.mp_impl,&mp_impl));
 		return *this;
 	}
 
+#ifdef PDFTRON_CPP11
+	/**
+	 * Move constructor. Takes over the native iterator without cloning it.
+	 */
+	inline Iterator(Iterator&& c) noexcept : mp_impl(c.mp_impl) {
+		c.mp_impl = 0;
+	}
+
+	/**
+	 * Move assignment operator.
+	 */
+	inline Iterator<T>& operator=(Iterator<T>&& other) noexcept {
+		std::swap(mp_impl, other.mp_impl);
+		return *this;
+	}
+#endif
+
 // @cond PRIVATE_DOC
 #ifndef SWIGHIDDEN
 	inline Iterator(TRN_Iterator impl) : mp_impl(impl) {}
 	TRN_Iterator mp_impl;
 #endif
 // @endcond
+private:
+	// Returned by Current() when it fails and errors are not thrown.
+	static T& NullItem() {
+		static T item;
+		return item;
+	}
 };
 
 /**
@@ -116,29 +148,32 @@ public:
 
 	inline void Next()
 	{
-		BASE_ASSERT(mp_impl, "Null Iterator");
+		BASE_ASSERT_RET_VOID(mp_impl, "Null Iterator");
 		REX(TRN_IteratorNext(mp_impl));
 	}
 
 	inline int Current()
 	{
-		BASE_ASSERT(mp_impl, "Null Iterator");
-		TRN_ItrData result;
-		REX(TRN_IteratorCurrent(mp_impl,&result));
+		BASE_ASSERT_RET(mp_impl, "Null Iterator", 0);
+		TRN_ItrData result = 0;
+		REX_RET(TRN_IteratorCurrent(mp_impl,&result), 0);
 		return *((int*)result);
 	}
 
 	inline bool HasNext()
 	{
-		BASE_ASSERT(mp_impl, "Null Iterator");
-		TRN_Bool result;
+		BASE_ASSERT_RET(mp_impl, "Null Iterator", false);
+		TRN_Bool result = 0;
 		REX(TRN_IteratorHasNext(mp_impl,&result));
 		return TBToB(result);
 	}
 	
 	inline Iterator<int>& operator=(const Iterator<int>& other)
 	{
-		BASE_ASSERT(other.mp_impl, "Null Iterator");
+		if (!other.mp_impl) {
+			DREX(mp_impl, TRN_IteratorDestroy(mp_impl));
+			return *this;
+		}
 		REX(TRN_IteratorAssign(other.mp_impl,&mp_impl));
 		return *this;
 	}
@@ -146,10 +181,23 @@ public:
 	inline Iterator(const Iterator<int>& c) 
 	  : mp_impl(0)
 	{
-		BASE_ASSERT(c.mp_impl, "Null Iterator");
-		REX(TRN_IteratorAssign(c.mp_impl,&mp_impl));
+		if (c.mp_impl) REX(TRN_IteratorAssign(c.mp_impl,&mp_impl));
+	}
+
+#ifdef PDFTRON_CPP11
+	inline Iterator(Iterator<int>&& c) noexcept
+	  : mp_impl(c.mp_impl)
+	{
+		c.mp_impl = 0;
 	}
 
+	inline Iterator<int>& operator=(Iterator<int>&& other) noexcept
+	{
+		std::swap(mp_impl, other.mp_impl);
+		return *this;
+	}
+#endif
+
 // @cond PRIVATE_DOC
 #ifndef SWIGHIDDEN
 	TRN_Iterator mp_impl;
@@ -157,6 +205,136 @@ public:
 // @endcond
 };
 
+#ifdef PDFTRON_CPP11
+/**
+ * RangeTraits describes how IteratorRange reads the current element of an
+ * iterator. It is specialized for every iterator type that can be used with
+ * IteratorRange.
+ */
+template <class Itr>
+struct RangeTraits;
+
+template <class T>
+struct RangeTraits<Iterator<T> >
+{
+	typedef T value_type;
+	static value_type Get(Iterator<T>& itr) { return itr.Current(); }
+};
+
+/**
+ * IteratorRange adapts a PDFNet iterator (such as PageIterator, FieldIterator,
+ * CharIterator, GSChangesIterator or SDF::DictIterator) to a single pass STL
+ * input range, so it can be used in range-based for loops and with standard
+ * algorithms:
+ *
+ * @code
+ * for (Page& page : doc.Pages()) {
+ *     ...
+ * }
+ * for (const std::pair<Obj, Obj>& entry : dict.DictEntries()) {
+ *     ...
+ * }
+ * @endcode
+ *
+ * The range takes ownership of the native iterator and is move-only. To
+ * amortize the cost of the calls to the native iterator, the range reads up
+ * to 'prefetch' elements at a time into a buffer that is reused for the
+ * whole traversal, so iteration does not allocate after the first batch.
+ *
+ * @note Because elements are read ahead of the loop body, changes made to
+ * the collection during the traversal (e.g. inserting or removing pages)
+ * are not reflected in elements that are already buffered. Use a prefetch
+ * count of 1 for such loops.
+ */
+template <class Itr>
+class IteratorRange
+{
+public:
+	typedef typename RangeTraits<Itr>::value_type value_type;
+
+	/**
+	 * An STL input iterator over the elements of an IteratorRange.
+	 */
+	class iterator
+	{
+	public:
+		typedef std::input_iterator_tag iterator_category;
+		typedef typename IteratorRange::value_type value_type;
+		typedef std::ptrdiff_t difference_type;
+		typedef value_type* pointer;
+		typedef value_type& reference;
+
+		iterator() : mp_range(0) {}
+
+		reference operator*() const { return mp_range->m_buffer[mp_range->m_pos]; }
+		pointer operator->() const { return &mp_range->m_buffer[mp_range->m_pos]; }
+
+		iterator& operator++() {
+			if (!mp_range->Advance()) mp_range = 0;
+			return *this;
+		}
+		void operator++(int) { ++*this; }
+
+		bool operator==(const iterator& other) const { return mp_range == other.mp_range; }
+		bool operator!=(const iterator& other) const { return mp_range != other.mp_range; }
+
+	private:
+		friend class IteratorRange;
+		explicit iterator(IteratorRange* range) : mp_range(range) {}
+		IteratorRange* mp_range;
+	};
+
+	/**
+	 * @param itr the iterator to adapt. The traversal starts at its current element.
+	 * @param prefetch the maximum number of elements read ahead of the traversal.
+	 */
+	explicit IteratorRange(Itr&& itr, size_t prefetch = 16)
+		: m_itr(std::move(itr)), m_pos(0), m_prefetch(prefetch > 0 ? prefetch : 1), m_started(false) {}
+
+	IteratorRange(IteratorRange&& other) noexcept
+		: m_itr(std::move(other.m_itr)), m_buffer(std::move(other.m_buffer)), m_pos(other.m_pos),
+		m_prefetch(other.m_prefetch), m_started(other.m_started) {}
+
+	/**
+	 * @return an iterator to the first element that was not consumed yet.
+	 * Since the range is single pass, begin() does not rewind the traversal.
+	 */
+	iterator begin() {
+		if (!m_started) {
+			m_started = true;
+			m_buffer.reserve(m_prefetch);
+			Fill();
+		}
+		return m_pos < m_buffer.size() ? iterator(this) : iterator();
+	}
+
+	iterator end() { return iterator(); }
+
+private:
+	IteratorRange(const IteratorRange&);
+	IteratorRange& operator=(const IteratorRange&);
+
+	void Fill() {
+		m_buffer.clear();
+		m_pos = 0;
+		while (m_buffer.size() < m_prefetch && m_itr.HasNext()) {
+			m_buffer.push_back(RangeTraits<Itr>::Get(m_itr));
+			m_itr.Next();
+		}
+	}
+
+	bool Advance() {
+		if (++m_pos == m_buffer.size()) Fill();
+		return m_pos < m_buffer.size();
+	}
+
+	Itr m_itr;
+	std::vector<value_type> m_buffer;
+	size_t m_pos;
+	size_t m_prefetch;
+	bool m_started;
+};
+#endif
 
 	};	// namespace Common
 };	// namespace pdftron
@@ -112,6 +112,15 @@ public:
 	 *	@param str  a UString.
 	 */
 	 UString& operator=(const UString& str);
+#ifdef PDFTRON_CPP11
+	/**
+	 * Move constructor and move assignment. The native string is handed over 
+	 * without a copy. A moved-from string may only be assigned to (with
+	 * operator= or Assign()) or destroyed.
+	 */
+	 UString(UString&& other) noexcept;
+	 UString& operator=(UString&& other) noexcept;
+#endif
 	 UString& operator=(const char* ascii_str);
 
 	/** 
@@ -0,0 +1,171 @@
+//---------------------------------------------------------------------------------------
+// Copyright (c) 2001-2019 by PDFTron Systems Inc. All Rights Reserved.
+// Consult legal.txt regarding legal and license information.
+//---------------------------------------------------------------------------------------
+#ifndef PDFTRON_H_CPPCommonUStringView
+#define PDFTRON_H_CPPCommonUStringView
+
+#include <Common/BasicTypes.h>
+#include <Common/Common.h>
+#include <Common/UString.h>
+#include <stddef.h>
+
+namespace pdftron {
+
+/**
+ * UStringView is a non-owning, read-only view of a sequence of Unicode (UTF-16)
+ * characters, such as the buffer returned by Word::GetString() or UString::GetBuffer().
+ *
+ * Unlike UString, a UStringView does not allocate a native string object and
+ * all of its methods (length, indexing, comparison, hashing and UTF-8 conversion)
+ * are implemented inline without calling into PDFNet. This makes it suitable for
+ * processing large numbers of short strings, e.g. words produced by TextExtractor.
+ *
+ * @note The view does not copy the characters. The underlying buffer must stay
+ * valid for as long as the view is used. For example, a view returned by
+ * Word::GetStringView() is valid only while the TextExtractor that produced the
+ * word is alive and has not been restarted with TextExtractor::Begin(). Use
+ * ToUString() to obtain an owning copy.
+ */
+class UStringView
+{
+public:
+
+	/**
+	 * Create an empty view.
+	 */
+	UStringView();
+
+	/**
+	 * Create a view of the given character buffer.
+	 *
+	 * @param str a pointer to the first character. Can be NULL if 'length' is 0.
+	 * @param length the number of characters in the view. A negative number
+	 * means that 'str' is NULL-terminated.
+	 */
+	UStringView(const Unicode* str, int length = -1);
+
+	/**
+	 * Create a view of the characters stored in a UString.
+	 *
+	 * @param str the string to view. The view is invalidated by any operation
+	 * that modifies or destroys 'str'.
+	 */
+	UStringView(const UString& str);
+
+	/**
+	 * @return the number of Unicode characters in the view.
+	 */
+	int GetLength() const { return m_len; }
+
+	/**
+	 * @return true if the view does not contain any characters.
+	 */
+	bool Empty() const { return m_len == 0; }
+
+	/**
+	 * @return a pointer to the viewed characters. The buffer is not necessarily
+	 * NULL-terminated.
+	 */
+	const Unicode* GetBuffer() const { return m_str; }
+
+	/**
+	 * @return the character at the given index. 'idx' must be in the range
+	 * [0, GetLength()).
+	 */
+	Unicode GetAt(int idx) const { return m_str[idx]; }
+	Unicode operator[](int idx) const { return m_str[idx]; }
+
+#ifndef SWIG
+	const Unicode* begin() const { return m_str; }
+	const Unicode* end() const { return m_str + m_len; }
+#endif
+
+	/**
+	 * @return a view of at most 'count' characters starting at 'off'.
+	 * A negative 'count' means the rest of the view.
+	 */
+	UStringView SubStr(int off = 0, int count = -1) const;
+
+	/**
+	 * Compares two views, character by character, using the numeric value of
+	 * each character.
+	 *
+	 * @return 0 if both views are equal, a negative value if this view is less
+	 * than 'str', and a positive value otherwise.
+	 */
+	int Compare(const UStringView& str) const;
+
+	/**
+	 * Convert to UTF8 C string.
+	 *
+	 * @param in_out_buf if NULL the function returns the number of bytes
+	 * required to store the UTF8 string. If in_out_buf is not NULL the
+	 * function will fill out the buffer with UTF8 converted string.
+	 *
+	 * @param buf_sz Size of the in_out_buf buffer, in bytes.
+	 * If the converted string does not fit into the buffer, it is truncated
+	 * on a character boundary.
+	 *
+	 * @param null_term to null terminate the converted string set this
+	 * parameter to true.
+	 *
+	 * @return the number of bytes written in the buffer (including null
+	 * terminator if specified).
+	 */
+	int ConvertToUtf8(char* in_out_buf, int buf_sz, bool null_term) const;
+
+	/**
+	 * Convert to UTF8 encoded std::string.
+	 */
+	std::string ConvertToUtf8() const;
+
+	/**
+	 * @return a new UString containing a copy of the viewed characters.
+	 */
+	UString ToUString() const;
+
+	/**
+	 * @return a hash value computed over the viewed characters (FNV-1a). Equal
+	 * views have equal hash values.
+	 */
+	size_t GetHash() const;
+
+	friend bool operator == (const UStringView& v1, const UStringView& v2) { return v1.m_len == v2.m_len && v1.Compare(v2) == 0; }
+	friend bool operator != (const UStringView& v1, const UStringView& v2) { return !(v1 == v2); }
+	friend bool operator <  (const UStringView& v1, const UStringView& v2) { return v1.Compare(v2) < 0; }
+	friend bool operator >  (const UStringView& v1, const UStringView& v2) { return v1.Compare(v2) > 0; }
+	friend bool operator <= (const UStringView& v1, const UStringView& v2) { return v1.Compare(v2) <= 0; }
+	friend bool operator >= (const UStringView& v1, const UStringView& v2) { return v1.Compare(v2) >= 0; }
+
+private:
+	const Unicode* m_str;
+	int m_len;
+};
+
+/**
+ * Hash function object for UStringView, for use with hash based containers.
+ */
+struct UStringViewHash
+{
+	size_t operator()(const UStringView& str) const { return str.GetHash(); }
+};
+
+
+#include <Impl/UStringView.inl>
+
+
+};	// namespace pdftron
+
+#ifdef PDFTRON_CPP11
+#include <functional>
+namespace std {
+	template <>
+	struct hash<pdftron::UStringView>
+	{
+		size_t operator()(const pdftron::UStringView& str) const { return str.GetHash(); }
+	};
+}
+#endif
+
+#endif // PDFTRON_H_CPPCommonUStringView
@@ -0,0 +1,211 @@
+//---------------------------------------------------------------------------------------
+// Copyright (c) 2001-2019 by PDFTron Systems Inc. All Rights Reserved.
+// Consult legal.txt regarding legal and license information.
+//---------------------------------------------------------------------------------------
+#ifndef PDFTRON_H_CPPCommonWorkStealingScheduler
+#define PDFTRON_H_CPPCommonWorkStealingScheduler
+
+#include <Common/Common.h>
+
+#ifdef PDFTRON_CPP11
+#include <deque>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <exception>
+
+namespace pdftron {
+	namespace Common {
+
+/**
+ * WorkStealingScheduler runs a fixed number of independent tasks on a pool of
+ * worker threads. The tasks are initially split into equal contiguous blocks,
+ * one per worker. A worker that runs out of tasks steals half of the remaining
+ * tasks of the most loaded worker, so pages or tiles with very different costs
+ * still keep all threads busy.
+ *
+ * The scheduler is used by the multi-threaded helpers in the PDF namespace
+ * (e.g. ParallelTextExtractor), but it does not depend on PDFNet and can be used
+ * directly.
+ *
+ * @note This class requires C++11 (PDFTRON_CPP11).
+ */
+class WorkStealingScheduler
+{
+public:
+	/**
+	 * @param num_threads the number of worker threads. 0 means one thread per
+	 * hardware thread.
+	 */
+	explicit WorkStealingScheduler(int num_threads = 0)
+		: m_num_threads(num_threads > 0 ? num_threads : DefaultThreadCount()) {}
+
+	/**
+	 * @return the number of worker threads used by Run().
+	 */
+	int GetThreadCount() const { return m_num_threads; }
+
+	/**
+	 * Calls func(task_idx, worker_idx) for every task_idx in [0, num_tasks) and
+	 * waits until all calls have returned. 'worker_idx' is in [0, GetThreadCount())
+	 * and identifies the calling worker, so it can be used to index per-worker
+	 * state (such as one TextExtractor or PDFRasterizer per thread) without locking.
+	 *
+	 * Worker 0 runs on the calling thread. If a task throws, no new tasks are
+	 * started and the first exception is rethrown once all workers have stopped.
+	 * When errors are not thrown (PDFTRON_NO_EXCEPTIONS), the first error a task
+	 * reports likewise stops the run and becomes the calling thread's last error.
+	 */
+	template <class Func>
+	void Run(int num_tasks, Func func) const
+	{
+		if (num_tasks <= 0) return;
+		int num_workers = m_num_threads < num_tasks ? m_num_threads : num_tasks;
+
+		std::vector<Queue> queues(num_workers);
+		for (int w = 0; w < num_workers; ++w) {
+			int begin = (int)((long long)num_tasks * w / num_workers);
+			int end = (int)((long long)num_tasks * (w + 1) / num_workers);
+			for (int t = begin; t < end; ++t) queues[w].tasks.push_back(t);
+		}
+
+		std::atomic<bool> failed(false);
+		std::mutex error_mutex;
+#ifndef PDFTRON_NO_EXCEPTIONS
+		std::exception_ptr error;
+#else
+		// errors are recorded per thread, so the error of worker 0 has to be
+		// told apart from one the caller had before Run()
+		TRN_Exception error = 0;
+		TRN_Exception caller_error = TakeLastException();
+#endif
+
+		auto worker = [&](int w) {
+			int task;
+			while (!failed.load(std::memory_order_relaxed) && NextTask(queues, w, task)) {
+#ifdef PDFTRON_NO_EXCEPTIONS
+				func(task, w);
+				if (TRN_Exception e = TakeLastException()) {
+					std::lock_guard<std::mutex> lock(error_mutex);
+					if (!error) error = e;
+					failed = true;
+				}
+#else
+				try {
+					func(task, w);
+				}
+				catch (...) {
+					std::lock_guard<std::mutex> lock(error_mutex);
+					if (!error) error = std::current_exception();
+					failed = true;
+				}
+#endif
+			}
+		};
+
+		std::vector<std::thread> threads;
+		threads.reserve(num_workers - 1);
+#ifndef PDFTRON_NO_EXCEPTIONS
+		try {
+			for (int w = 1; w < num_workers; ++w) {
+				threads.push_back(std::thread(worker, w));
+			}
+		}
+		catch (...) {
+			// the workers that did start must be joined before the threads
+			// are destroyed
+			failed = true;
+			for (size_t i = 0; i < threads.size(); ++i) {
+				threads[i].join();
+			}
+			throw;
+		}
+#else
+		for (int w = 1; w < num_workers; ++w) {
+			threads.push_back(std::thread(worker, w));
+		}
+#endif
+		worker(0);
+		for (size_t i = 0; i < threads.size(); ++i) {
+			threads[i].join();
+		}
+
+#ifndef PDFTRON_NO_EXCEPTIONS
+		if (error) std::rethrow_exception(error);
+#else
+		LastExceptionSlot() = error ? error : caller_error;
+#endif
+	}
+
+	/**
+	 * @return the number of hardware threads, or 1 if it cannot be determined.
+	 */
+	static int DefaultThreadCount()
+	{
+		unsigned n = std::thread::hardware_concurrency();
+		return n ? (int)n : 1;
+	}
+
+private:
+	struct Queue
+	{
+		std::mutex mutex;
+		std::deque<int> tasks;
+	};
+
+	// Pops the next task from the front of the worker's own queue, or steals
+	// the back half of the largest other queue.
+	static bool NextTask(std::vector<Queue>& queues, int w, int& out_task)
+	{
+		{
+			std::lock_guard<std::mutex> lock(queues[w].mutex);
+			if (!queues[w].tasks.empty()) {
+				out_task = queues[w].tasks.front();
+				queues[w].tasks.pop_front();
+				return true;
+			}
+		}
+
+		for (;;) {
+			int victim = -1;
+			size_t victim_size = 0;
+			for (size_t v = 0; v < queues.size(); ++v) {
+				if ((int)v == w) continue;
+				std::lock_guard<std::mutex> lock(queues[v].mutex);
+				if (queues[v].tasks.size() > victim_size) {
+					victim = (int)v;
+					victim_size = queues[v].tasks.size();
+				}
+			}
+			if (victim < 0) return false;
+
+			std::deque<int> stolen;
+			{
+				std::lock_guard<std::mutex> lock(queues[victim].mutex);
+				std::deque<int>& src = queues[victim].tasks;
+				if (src.empty()) continue; // drained meanwhile, pick another victim
+				size_t take = (src.size() + 1) / 2;
+				stolen.assign(src.end() - take, src.end());
+				src.erase(src.end() - take, src.end());
+			}
+
+			out_task = stolen.front();
+			stolen.pop_front();
+			if (!stolen.empty()) {
+				std::lock_guard<std::mutex> lock(queues[w].mutex);
+				queues[w].tasks.insert(queues[w].tasks.end(), stolen.begin(), stolen.end());
+			}
+			return true;
+		}
+	}
+
+	int m_num_threads;
+};
+
+	};	// namespace Common
+};	// namespace pdftron
+
+#endif // PDFTRON_CPP11
+
+#endif // PDFTRON_H_CPPCommonWorkStealingScheduler
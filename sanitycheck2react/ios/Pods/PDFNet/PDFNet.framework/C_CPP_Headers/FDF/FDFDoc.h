@@ -256,6 +256,10 @@ public:
 	 void MergeAnnots( const UString& command_file, const UString& permitted_user = "" );
 
 	 FDFDoc(const FDFDoc& other);
+#ifdef PDFTRON_CPP11
+	 FDFDoc(FDFDoc&& other) noexcept;
+	 FDFDoc& operator=(FDFDoc&& other) noexcept;
+#endif
 	 
 // @cond PRIVATE_DOC
 #ifndef SWIGHIDDEN
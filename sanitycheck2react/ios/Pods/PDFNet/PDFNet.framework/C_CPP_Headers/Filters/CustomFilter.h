@@ -0,0 +1,130 @@
+//---------------------------------------------------------------------------------------
+// Copyright (c) 2001-2019 by PDFTron Systems Inc. All Rights Reserved.
+// Consult legal.txt regarding legal and license information.
+//---------------------------------------------------------------------------------------
+#ifndef H_FiltersCustomFilter
+#define H_FiltersCustomFilter
+
+#include <Filters/Filter.h>
+#include <Common/Common.h>
+#include <C/Filters/TRN_Filter.h>
+
+namespace pdftron {
+	namespace Filters {
+
+/**
+ * CustomFilter is a source or a sink Filter whose data is provided or consumed
+ * by user defined callback functions. CustomFilter can be used to read documents
+ * from, or save documents to, arbitrary streams (e.g. sockets, encrypted storage,
+ * database blobs) without first copying the whole file into memory.
+ *
+ * For example, to save a document in chunks:
+ * @code
+ * size_t MyWrite(const UChar* data, size_t size, void* user_data) {
+ *   return fwrite(data, 1, size, (FILE*)user_data);
+ * }
+ * ...
+ * doc.Save(&MyWrite, fp, SDFDoc::e_remove_unused);
+ * @endcode
+ */
+class CustomFilter : public Filter
+{
+public:
+
+	enum OpenMode
+	{
+		e_read_mode   = e_Filter_read_mode,
+		e_write_mode  = e_Filter_write_mode,
+		e_append_mode = e_Filter_append_mode
+	};
+
+	/**
+	 * Create a CustomFilter using raw callback functions. The callbacks follow the
+	 * semantics of the corresponding C stdio functions (fseek, ftell, fflush, fread
+	 * and fwrite). 'user_data' is passed unchanged to every callback.
+	 *
+	 * @param mode the open mode. An input filter requires 'read_proc', an output
+	 * filter requires 'write_proc'.
+	 * @param destroy_proc optional callback invoked when the filter is destroyed.
+	 * It can be used to release 'user_data'.
+	 */
+	CustomFilter(OpenMode mode, void* user_data,
+		TRN_SeekProc seek_proc, TRN_TellProc tell_proc, TRN_FlushProc flush_proc,
+		TRN_ReadProc read_proc, TRN_WriteProc write_proc, TRN_DestroyProc destroy_proc = 0);
+
+#ifndef SWIG
+	/**
+	 * A callback receiving the next chunk of output data.
+	 *
+	 * @param data a pointer to the chunk. The buffer is only valid for the
+	 * duration of the call.
+	 * @param size the number of bytes in the chunk.
+	 * @param user_data the pointer passed to the CustomFilter constructor.
+	 * @return the number of bytes consumed. A value smaller than 'size'
+	 * indicates a write error and aborts the operation using the filter.
+	 */
+	typedef size_t (*WriteProc) (const UChar* data, size_t size, void* user_data);
+
+	/**
+	 * Create an output CustomFilter that forwards all written data to 'write_proc'.
+	 * The filter keeps track of the number of bytes written, so it can be used as
+	 * the target of PDFDoc::Save() and SDFDoc::Save() even though the underlying
+	 * stream is not seekable.
+	 *
+	 * @note Because 'write_proc' is invoked once per chunk and in output order,
+	 * the sum of the chunk sizes can be used to report save progress.
+	 * @note The filter cannot seek, so it does not support saving with
+	 * SDFDoc::e_linearized.
+	 */
+	CustomFilter(WriteProc write_proc, void* user_data);
+
+	/**
+	 * Copy constructor and assignment operator. As with Filter, the copy
+	 * takes over the native filter. Both objects keep access to the byte
+	 * count, so GetBytesWritten() remains valid on the original after it
+	 * was passed by value (e.g. to SDFDoc::Save(Filters::Filter, ...)).
+	 */
+	CustomFilter(const CustomFilter& copy);
+	CustomFilter& operator=(const CustomFilter& other);
+	~CustomFilter();
+
+	/**
+	 * @note CustomFilter specific function.
+	 * @return the total number of bytes consumed by the WriteProc callback.
+	 * Returns 0 for filters created using raw callback functions.
+	 */
+	size_t GetBytesWritten() const;
+#endif
+
+private:
+#ifndef SWIG
+	// Shared by the native filter and every CustomFilter that refers to it.
+	// The last one to release it deletes it.
+	struct Sink
+	{
+		WriteProc write_proc;
+		void* user_data;
+		size_t pos;
+		int refs;
+	};
+
+	static void Release(Sink* sink);
+
+	static size_t SinkWrite(const void* buf, size_t size, size_t count, void* user_data);
+	static size_t SinkTell(void* user_data);
+	static int SinkSeek(void* user_data, long offset, int origin);
+	static int SinkFlush(void* user_data);
+	static void SinkDestroy(void* user_data);
+
+	Sink* mp_sink;
+#endif
+};
+
+
+#include <Impl/CustomFilter.inl>
+
+	};	// namespace Filters
+};	// namespace pdftron
+
+
+#endif // H_FiltersCustomFilter
@@ -51,6 +51,10 @@ public:
 	 Filter(const Filter& copy);
 	
 	 Filter& operator=(const Filter& other);
+#ifdef PDFTRON_CPP11
+	 Filter(Filter&& other) noexcept;
+	 Filter& operator=(Filter&& other) noexcept;
+#endif
 
 	 /** 
 	  * @return true if the object is not null, false otherwise.  
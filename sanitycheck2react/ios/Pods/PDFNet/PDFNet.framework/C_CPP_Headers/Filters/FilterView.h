@@ -0,0 +1,110 @@
+//---------------------------------------------------------------------------------------
+// Copyright (c) 2001-2019 by PDFTron Systems Inc. All Rights Reserved.
+// Consult legal.txt regarding legal and license information.
+//---------------------------------------------------------------------------------------
+#ifndef PDFTRON_H_CPPFiltersFilterView
+#define PDFTRON_H_CPPFiltersFilterView
+
+#include <Filters/Filter.h>
+#include <Common/ByteView.h>
+#include <vector>
+
+namespace pdftron {
+	namespace Filters {
+
+/**
+ * FilterView reads an input filter through the filter's own buffer, without
+ * copying the data. Each call to Next() returns the bytes the filter has
+ * buffered (Filter::Begin() and Filter::Size()) as a ByteView, and consumes
+ * them when Next() is called again. FilterReader::Read(), in comparison,
+ * copies every byte into a caller supplied buffer.
+ *
+ * A sample use case, counting the lines of a content stream:
+ * @code
+ * FilterView view(page.GetContents().GetDecodedStream());
+ * size_t lines = 0;
+ * for (ByteView chunk = view.Next(); !chunk.Empty(); chunk = view.Next()) {
+ *     for (size_t i = 0; i < chunk.Size(); ++i) {
+ *         if (chunk[i] == '\n') ++lines;
+ *     }
+ * }
+ * @endcode
+ *
+ * @note The size of the windows is decided by the filter, and a token may
+ * span two windows.
+ */
+class FilterView
+{
+public:
+	/**
+	 * @param filter the input filter to read, e.g. the filter returned by
+	 * SDF::Obj::GetDecodedStream(). The view takes over the ownership of the
+	 * filter.
+	 */
+	explicit FilterView(Filter filter);
+
+	/**
+	 * Consumes the window returned by the previous call to Next(), and
+	 * returns the next one.
+	 *
+	 * @return the bytes buffered by the filter. The view is valid until the
+	 * next call to a member function of this FilterView. An empty view means
+	 * the end of data has been reached.
+	 */
+	ByteView Next();
+
+	/**
+	 * Returns the bytes buffered by the filter without consuming them. Use
+	 * Consume() to move past the bytes that were processed; the remaining
+	 * bytes are returned again by the next call to Peek() or Next().
+	 *
+	 * @return the bytes buffered by the filter, valid until the next call
+	 * to a member function of this FilterView. An empty view means the end
+	 * of data has been reached.
+	 */
+	ByteView Peek();
+
+	/**
+	 * Moves forward by num_bytes.
+	 *
+	 * @param num_bytes the number of bytes to consume. It must not be greater
+	 * than the size of the view returned by the last call to Peek().
+	 */
+	void Consume(size_t num_bytes);
+
+	/**
+	 * Appends the remaining data to a vector. This copies the data once,
+	 * without an intermediate buffer.
+	 *
+	 * @return the number of bytes appended.
+	 */
+	size_t ReadAll(std::vector<unsigned char>& out);
+
+	/**
+	 * @return the number of bytes consumed so far, including the window
+	 * returned by the last call to Next().
+	 */
+	size_t GetCount() const;
+
+	/**
+	 * @return the underlying filter.
+	 */
+	Filter& GetFilter();
+
+private:
+	FilterView(const FilterView&);
+	FilterView& operator=(const FilterView&);
+
+	void ConsumePending();
+
+	Filter m_filter;
+	size_t m_pending;
+	size_t m_count;
+};
+
+#include <Impl/FilterView.inl>
+
+	};	// namespace Filters
+};	// namespace pdftron
+
+#endif // PDFTRON_H_CPPFiltersFilterView
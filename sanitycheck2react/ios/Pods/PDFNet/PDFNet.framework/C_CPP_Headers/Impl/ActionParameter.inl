@@ -7,37 +7,59 @@
 namespace pdftron {
 	namespace PDF {
 
-inline ActionParameter::ActionParameter(const Action& action, const Field& field)
+inline ActionParameter::ActionParameter(const Action& action, const Field& field) : mp_parameter(0)
 {
 	REX(TRN_ActionParameterCreateWithField(action.mp_action,&(field.mp_field),&mp_parameter));
 }
 
-inline ActionParameter::ActionParameter(const Action& action, const Annot& annot)
+inline ActionParameter::ActionParameter(const Action& action, const Annot& annot) : mp_parameter(0)
 {
 	REX(TRN_ActionParameterCreateWithAnnot(action.mp_action, annot.mp_annot, &mp_parameter));
 }
 
-inline ActionParameter::ActionParameter(const Action& action, const Page& page)
+inline ActionParameter::ActionParameter(const Action& action, const Page& page) : mp_parameter(0)
 {
 	REX(TRN_ActionParameterCreateWithPage(action.mp_action, page.mp_page, &mp_parameter));
 }
 
-inline ActionParameter::ActionParameter(const Action& action)
+inline ActionParameter::ActionParameter(const Action& action) : mp_parameter(0)
 {
 	REX(TRN_ActionParameterCreate(action.mp_action, &mp_parameter));
 }
 
-inline ActionParameter::ActionParameter(const ActionParameter& action_param)
+inline ActionParameter::ActionParameter(const ActionParameter& action_param) : mp_parameter(0)
 {
+	if (!action_param.mp_parameter) return;	// a copy of a moved-from parameter is null
 	REX(TRN_ActionParameterCreate(0,&mp_parameter));
 	REX(TRN_ActionParameterAssign(mp_parameter, action_param.mp_parameter));
 }
 
 inline ActionParameter& ActionParameter::operator=(const ActionParameter& action_param) {
+	if (!action_param.mp_parameter) {
+		DREX(mp_parameter, TRN_ActionParameterDestroy(mp_parameter));
+		return *this;
+	}
+	if (!mp_parameter) {
+		// moved-from target
+		REX(TRN_ActionParameterCreate(0,&mp_parameter));
+	}
 	REX(TRN_ActionParameterAssign(mp_parameter, action_param.mp_parameter));
 	return *this;
 }
 
+#ifdef PDFTRON_CPP11
+inline ActionParameter::ActionParameter(ActionParameter&& other) noexcept : mp_parameter(other.mp_parameter)
+{
+	other.mp_parameter = 0;
+}
+
+inline ActionParameter& ActionParameter::operator=(ActionParameter&& other) noexcept
+{
+	std::swap(mp_parameter, other.mp_parameter);
+	return *this;
+}
+#endif
+
 inline ActionParameter::~ActionParameter()
 {
 	DREX(mp_parameter, TRN_ActionParameterDestroy(mp_parameter));
@@ -51,7 +73,7 @@ inline void ActionParameter::Destroy()
 
 inline Action ActionParameter::GetAction()
 {
-	TRN_Action result;
+	TRN_Action result = 0;
 	REX(TRN_ActionParameterGetAction(mp_parameter, &result));
 	return Action(result); 
 }
@@ -1,10 +1,10 @@
 
-inline AttrObj::AttrObj (SDF::Obj dict)
+inline AttrObj::AttrObj (SDF::Obj dict) : mp_obj(0)
 {
 	REX(TRN_AttrObjCreate(dict.mp_obj,&mp_obj));
 }
 	
-inline AttrObj::AttrObj (const AttrObj& a)
+inline AttrObj::AttrObj (const AttrObj& a) : mp_obj(0)
 {
 	REX(TRN_AttrObjCopy(a.mp_obj,&mp_obj));
 }
@@ -17,14 +17,14 @@ inline AttrObj& AttrObj::operator= (const AttrObj& a)
 
 inline const char* AttrObj::GetOwner() const
 {
-	const char* result;
+	const char* result = 0;
 	REX(TRN_AttrObjGetOwner(mp_obj, &result));
 	return result;
 }
 
 inline SDF::Obj AttrObj::GetSDFObj () const
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_AttrObjGetSDFObj(mp_obj,&result));
 	return SDF::Obj(result);
 }
@@ -0,0 +1,290 @@
+
+inline BatchExporter::BatchExporter(int render_threads, int encode_threads)
+	: m_scheduler(render_threads), m_encode_threads(encode_threads), m_jpeg_quality(80)
+{
+	if (m_encode_threads <= 0) {
+		m_encode_threads = (m_scheduler.GetThreadCount() + 1) / 2;
+	}
+}
+
+inline int BatchExporter::GetRenderThreadCount() const
+{
+	return m_scheduler.GetThreadCount();
+}
+
+inline int BatchExporter::GetEncodeThreadCount() const
+{
+	return m_encode_threads;
+}
+
+inline void BatchExporter::SetDrawConfig(const ConfigProc& proc)
+{
+	m_config = proc;
+}
+
+inline void BatchExporter::SetJPEGQuality(int quality)
+{
+	m_jpeg_quality = quality < 0 ? 0 : (quality > 100 ? 100 : quality);
+}
+
+inline BatchExporter::Stats BatchExporter::Export(PDFDoc& doc, const std::vector<int>& page_nums, const std::string& filename_pattern, Format format)
+{
+	return Export(doc, page_nums, [&filename_pattern](int, int page_num) -> Filters::Filter {
+		std::string path = FormatFileName(filename_pattern, page_num);
+		FILE* file = fopen(path.c_str(), "wb");
+		if (!file) {
+			PDFTRON_THROW(Common::Exception("file", __LINE__, __FILE__, "BatchExporter::Export", ("Cannot open " + path).c_str()));
+			return Filters::Filter();
+		}
+		return Filters::CustomFilter(Filters::CustomFilter::e_write_mode, file,
+			&FileSeek, &FileTell, &FileFlush, 0, &FileWrite, &FileClose);
+	}, format);
+}
+
+inline BatchExporter::Stats BatchExporter::Export(PDFDoc& doc, const std::vector<int>& page_nums, const StreamProc& streams, Format format)
+{
+	typedef std::chrono::steady_clock Clock;
+	Clock::time_point start = Clock::now();
+
+	int num_pages = (int)page_nums.size();
+	int num_encoders = m_encode_threads < num_pages ? m_encode_threads : num_pages;
+
+	// resolve all pages up front, so that the workers do not walk the page tree
+	std::vector<SDF::Obj> pages;
+	{
+		DocReadGuard guard(doc, "BatchExporter::Export (page lookup)");
+		PageIndex::Lookup(doc, page_nums, pages);
+	}
+
+	JobQueue queue(2 * (size_t)(num_encoders > 0 ? num_encoders : 1));
+	std::vector<std::unique_ptr<PDFDraw> > draws(m_scheduler.GetThreadCount());
+	std::atomic<bool> failed(false);
+	std::exception_ptr encode_error;
+#ifdef PDFTRON_NO_EXCEPTIONS
+	TRN_Exception encode_failure = 0;
+#endif
+	std::mutex mutex;
+	double render_ms = 0, encode_ms = 0;
+
+	std::vector<std::thread> encoders;
+	for (int e = 0; e < num_encoders; ++e) {
+		encoders.push_back(std::thread([&]() {
+			Job job;
+			double elapsed = 0;
+			while (queue.Pop(job)) {
+				Clock::time_point t = Clock::now();
+				PDFTRON_TRY {
+					Encode(job, streams, format);
+				}
+				PDFTRON_CATCH(...) {
+					std::lock_guard<std::mutex> lock(mutex);
+					if (!encode_error) encode_error = std::current_exception();
+					failed = true;
+					queue.Close(true);
+				}
+#ifdef PDFTRON_NO_EXCEPTIONS
+				if (TRN_Exception e = Common::TakeLastException()) {
+					std::lock_guard<std::mutex> lock(mutex);
+					if (!encode_failure) encode_failure = e;
+					failed = true;
+					queue.Close(true);
+				}
+#endif
+				elapsed += std::chrono::duration<double, std::milli>(Clock::now() - t).count();
+			}
+			std::lock_guard<std::mutex> lock(mutex);
+			encode_ms += elapsed;
+		}));
+	}
+
+	PDFTRON_TRY {
+		m_scheduler.Run(num_pages, [&](int idx, int worker) {
+			if (failed) return;
+			if (!draws[worker]) {
+				draws[worker].reset(new PDFDraw());
+				if (m_config) m_config(*draws[worker]);
+			}
+
+			Clock::time_point t = Clock::now();
+			Job job;
+			job.page_idx = idx;
+			job.page_num = page_nums[idx];
+			{
+				DocReadGuard guard(doc, "BatchExporter::Export (render)");
+				draws[worker]->GetBitmap(Page(pages[idx]), job.bmp, PDFDraw::e_rgb);
+			}
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				render_ms += std::chrono::duration<double, std::milli>(Clock::now() - t).count();
+			}
+			queue.Push(job);
+		});
+	}
+	PDFTRON_CATCH(...) {
+		queue.Close(true);
+		for (size_t e = 0; e < encoders.size(); ++e) encoders[e].join();
+		PDFTRON_RETHROW;
+	}
+
+	queue.Close(false);
+	for (size_t e = 0; e < encoders.size(); ++e) encoders[e].join();
+	if (encode_error) std::rethrow_exception(encode_error);
+#ifdef PDFTRON_NO_EXCEPTIONS
+	if (encode_failure) Common::LastExceptionSlot() = encode_failure;
+#endif
+
+	Stats stats;
+	stats.pages = num_pages;
+	stats.elapsed_ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+	stats.render_ms = render_ms;
+	stats.encode_ms = encode_ms;
+	stats.pages_per_second = stats.elapsed_ms > 0 ? num_pages * 1000.0 / stats.elapsed_ms : 0;
+	return stats;
+}
+
+inline std::string BatchExporter::FormatFileName(const std::string& pattern, int page_num)
+{
+	std::string result;
+	bool replaced = false;
+	for (size_t i = 0; i < pattern.size(); ++i) {
+		if (pattern[i] != '%' || i + 1 == pattern.size()) {
+			result += pattern[i];
+			continue;
+		}
+		if (pattern[i + 1] == '%') {
+			result += '%';
+			++i;
+			continue;
+		}
+		size_t j = i + 1;
+		int width = 0;
+		while (j < pattern.size() && pattern[j] >= '0' && pattern[j] <= '9') {
+			width = width * 10 + (pattern[j] - '0');
+			++j;
+		}
+		if (replaced || j == pattern.size() || pattern[j] != 'd' || width > 32) {
+			result += pattern[i];
+			continue;
+		}
+		char num[48];
+		snprintf(num, sizeof(num), "%0*d", width, page_num);
+		result += num;
+		replaced = true;
+		i = j;
+	}
+	return result;
+}
+
+inline void BatchExporter::Encode(Job& job, const StreamProc& streams, Format format) const
+{
+	BitmapInfo& bmp = job.bmp;
+	const unsigned char* data = bmp.GetData();
+	size_t row = (size_t)bmp.width * 3;
+	std::vector<unsigned char> packed;
+	if (bmp.stride != (int)row) {
+		// the encoder expects tightly packed top-down rows; a negative stride
+		// means that the rows are stored bottom-up
+		size_t stride = (size_t)(bmp.stride < 0 ? -bmp.stride : bmp.stride);
+		packed.resize(row * bmp.height);
+		for (int y = 0; y < bmp.height; ++y) {
+			int src_y = bmp.stride < 0 ? bmp.height - 1 - y : y;
+			memcpy(&packed[y * row], data + src_y * stride, row);
+		}
+		data = packed.empty() ? 0 : &packed[0];
+	}
+
+	SDF::ObjSet hint_set;
+	SDF::Obj hint = hint_set.CreateArray();
+	if (format == e_jpeg) {
+		hint.PushBackName("JPEG");
+		hint.PushBackName("Quality");
+		hint.PushBackNumber(m_jpeg_quality);
+	}
+	else {
+		hint.PushBackName("RAW");
+	}
+
+	// Each page is encoded in its own scratch document, so encoder threads do
+	// not share state and the image data is released as soon as it is written.
+	SDF::SDFDoc scratch;
+	Image image = Image::Create(scratch, data, row * bmp.height, bmp.width, bmp.height, 8,
+		ColorSpace::CreateDeviceRGB(), hint);
+
+	Filters::Filter stream = streams(job.page_idx, job.page_num);
+#ifdef PDFTRON_NO_EXCEPTIONS
+	// the image or the stream could not be created; the encoder thread
+	// picks up the recorded error
+	if (Common::HasError()) return;
+#endif
+	if (!stream) {
+		PDFTRON_THROW(Common::Exception("stream", __LINE__, __FILE__, "BatchExporter::Export", "No output stream for the page"));
+		return;
+	}
+	Filters::FilterWriter writer(stream);
+	if (format == e_jpeg) {
+		image.Export(writer);
+	}
+	else {
+		image.ExportAsPng(writer);
+	}
+	writer.Flush();
+	stream.Flush();
+}
+
+inline bool BatchExporter::JobQueue::Push(Job& job)
+{
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_not_full.wait(lock, [this]() { return m_jobs.size() < m_capacity || m_closed; });
+	if (m_closed) return false;
+	m_jobs.push_back(std::move(job));
+	m_not_empty.notify_one();
+	return true;
+}
+
+inline bool BatchExporter::JobQueue::Pop(Job& job)
+{
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_not_empty.wait(lock, [this]() { return !m_jobs.empty() || m_closed; });
+	if (m_jobs.empty() || m_aborted) return false;
+	job = std::move(m_jobs.front());
+	m_jobs.pop_front();
+	m_not_full.notify_one();
+	return true;
+}
+
+inline void BatchExporter::JobQueue::Close(bool abort)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_closed = true;
+	if (abort) {
+		m_aborted = true;
+		m_jobs.clear();
+	}
+	m_not_empty.notify_all();
+	m_not_full.notify_all();
+}
+
+inline size_t BatchExporter::FileWrite(const void* buf, size_t size, size_t count, void* user_data)
+{
+	return fwrite(buf, size, count, (FILE*)user_data);
+}
+
+inline size_t BatchExporter::FileTell(void* user_data)
+{
+	return (size_t)ftell((FILE*)user_data);
+}
+
+inline int BatchExporter::FileSeek(void* user_data, long offset, int origin)
+{
+	return fseek((FILE*)user_data, offset, origin);
+}
+
+inline int BatchExporter::FileFlush(void* user_data)
+{
+	return fflush((FILE*)user_data);
+}
+
+inline void BatchExporter::FileClose(void* user_data)
+{
+	fclose((FILE*)user_data);
+}
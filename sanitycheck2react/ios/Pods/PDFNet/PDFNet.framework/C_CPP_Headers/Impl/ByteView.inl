@@ -0,0 +1,23 @@
+inline ByteView ByteView::SubView(size_t off, size_t count) const
+{
+	if (off > m_size) off = m_size;
+	if (count > m_size - off) count = m_size - off;
+	return ByteView(m_data + off, count);
+}
+
+inline size_t ByteView::Find(UChar value, size_t off) const
+{
+	if (off >= m_size) return (size_t)-1;
+	const void* p = memchr(m_data + off, value, m_size - off);
+	return p ? (size_t)((const UChar*)p - m_data) : (size_t)-1;
+}
+
+inline std::vector<unsigned char> ByteView::ToVector() const
+{
+	return std::vector<unsigned char>(m_data, m_data + m_size);
+}
+
+inline void ByteView::AppendTo(std::vector<unsigned char>& out) const
+{
+	out.insert(out.end(), m_data, m_data + m_size);
+}
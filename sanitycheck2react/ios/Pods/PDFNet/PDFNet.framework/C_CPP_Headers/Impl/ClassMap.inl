@@ -1,9 +1,9 @@
 
-inline ClassMap::ClassMap (SDF::Obj dict)
+inline ClassMap::ClassMap (SDF::Obj dict) : mp_map(0)
 {
 	REX(TRN_ClassMapCreate(dict.mp_obj,&mp_map));
 }
-inline ClassMap::ClassMap (const ClassMap& p)
+inline ClassMap::ClassMap (const ClassMap& p) : mp_map(0)
 {
 	REX(TRN_ClassMapCopy(p.mp_map,&mp_map));
 }
@@ -16,7 +16,7 @@ inline ClassMap& ClassMap::operator= (const ClassMap& p)
 
 inline bool ClassMap::IsValid() const
 {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_ClassMapIsValid(mp_map,&result));
 	return TBToB(result);
 }
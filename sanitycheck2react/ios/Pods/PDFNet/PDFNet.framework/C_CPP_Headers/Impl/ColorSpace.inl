@@ -1,9 +1,10 @@
 
-inline ColorPt::ColorPt(double x,double y,double z,double w) {
+inline ColorPt::ColorPt(double x,double y,double z,double w) : m_c() {
 	REX(TRN_ColorPtInit(x,y,z,w, &m_c));
 }
 
-inline ColorPt::ColorPt(const ColorPt& co) {
+inline ColorPt::ColorPt(const ColorPt& co) : m_c() {
+	if (!co.m_c.c) return;	// a copy of a moved-from point is null
 	REX(TRN_ColorPtInit(0,0,0,0, &m_c));
 	REX(TRN_ColorPtAssign(&m_c, &co.m_c));
 }
@@ -19,10 +20,31 @@ inline void ColorPt::Destroy() {
 }
 
 inline ColorPt& ColorPt::operator =(const ColorPt& co) {
+	if (!co.m_c.c) {
+		DREX(m_c.c, TRN_ColorPtDestroy(&m_c));
+		return *this;
+	}
+	if (!m_c.c) {
+		// moved-from target
+		REX(TRN_ColorPtInit(0,0,0,0, &m_c));
+	}
 	REX(TRN_ColorPtAssign(&m_c, &co.m_c));
 	return *this;
 }
 
+#ifdef PDFTRON_CPP11
+inline ColorPt::ColorPt(ColorPt&& other) noexcept : m_c(other.m_c)
+{
+	other.m_c.c = 0;
+}
+
+inline ColorPt& ColorPt::operator=(ColorPt&& other) noexcept
+{
+	std::swap(m_c, other.m_c);
+	return *this;
+}
+#endif
+
 inline bool ColorPt::operator== (const ColorPt& co) const {
 	RetBool(TRN_ColorPtCompare(&m_c, &co.m_c, &result));
 }
@@ -36,7 +58,7 @@ inline void ColorPt::Set(int colorant_index,double colorant_value) {
 }
 
 inline double ColorPt::Get(int colorant_index) const {
-	double result;
+	double result = 0;
 	REX(TRN_ColorPtGet(&m_c, colorant_index,&result));
 	return result;
 }
@@ -47,25 +69,25 @@ inline void ColorPt::SetColorantNum(int num) {
 
 
 inline ColorSpace ColorSpace::CreateDeviceGray() {
-	TRN_ColorSpace result;
+	TRN_ColorSpace result = 0;
 	REX(TRN_ColorSpaceCreateDeviceGray(&result));
 	return ColorSpace(result);
 }
 
 inline ColorSpace ColorSpace::CreateDeviceRGB() {
-	TRN_ColorSpace result;
+	TRN_ColorSpace result = 0;
 	REX(TRN_ColorSpaceCreateDeviceRGB(&result));
 	return ColorSpace(result);
 }
 
 inline ColorSpace ColorSpace::CreateDeviceCMYK() {
-	TRN_ColorSpace result;
+	TRN_ColorSpace result = 0;
 	REX(TRN_ColorSpaceCreateDeviceCMYK(&result));
 	return ColorSpace(result);
 }
 
 inline ColorSpace ColorSpace::CreatePattern() {
-	TRN_ColorSpace result;
+	TRN_ColorSpace result = 0;
 	REX(TRN_ColorSpaceCreatePattern(&result));
 	return ColorSpace(result);
 }
@@ -73,14 +95,14 @@ inline ColorSpace ColorSpace::CreatePattern() {
 
 inline ColorSpace ColorSpace::CreateICC(SDF::SDFDoc& doc, const UString& filepath)
 {
-	TRN_ColorSpace result;
+	TRN_ColorSpace result = 0;
 	REX(TRN_ColorSpaceCreateICCFromFile( (doc.mp_doc), (TRN_UString)(&filepath), &result ));
 	return ColorSpace(result);
 }
 
 inline ColorSpace ColorSpace::CreateICC(SDF::SDFDoc& doc, Filters::Filter stm)
 {
-	TRN_ColorSpace result;
+	TRN_ColorSpace result = 0;
 	stm.m_owner = false;
 	REX(TRN_ColorSpaceCreateICCFromFilter( (doc.mp_doc), stm.m_impl, &result ) );
 	// Note: SDFDoc takes the ownership of the stream
@@ -90,25 +112,47 @@ inline ColorSpace ColorSpace::CreateICC(SDF::SDFDoc& doc, Filters::Filter stm)
 
 inline ColorSpace ColorSpace::CreateICC(SDF::SDFDoc& doc, const UChar* buf, size_t buf_sz)
 {
-	TRN_ColorSpace result;
+	TRN_ColorSpace result = 0;
 	REX(TRN_ColorSpaceCreateICCFromBuffer( (doc.mp_doc), buf, (TRN_UInt32)buf_sz, &result ));
 	return ColorSpace(result);
 }
 
-inline ColorSpace::ColorSpace (SDF::Obj color_space) {
+inline ColorSpace::ColorSpace (SDF::Obj color_space) : mp_cs(0) {
 	REX(TRN_ColorSpaceCreate(color_space.mp_obj,&mp_cs));
 }
 
-inline ColorSpace::ColorSpace(const ColorSpace& c) {
+inline ColorSpace::ColorSpace(const ColorSpace& c) : mp_cs(0) {
+	if (!c.mp_cs) return;	// a copy of a moved-from color space is null
 	REX(TRN_ColorSpaceCreate(0,&mp_cs));
 	REX(TRN_ColorSpaceAssign(mp_cs,c.mp_cs));
 }
 
 inline ColorSpace& ColorSpace::operator=(const ColorSpace& c) {
+	if (!c.mp_cs) {
+		DREX(mp_cs, TRN_ColorSpaceDestroy(mp_cs));
+		return *this;
+	}
+	if (!mp_cs) {
+		// moved-from target
+		REX(TRN_ColorSpaceCreate(0,&mp_cs));
+	}
 	REX(TRN_ColorSpaceAssign(mp_cs, c.mp_cs));
 	return *this;
 }
 
+#ifdef PDFTRON_CPP11
+inline ColorSpace::ColorSpace(ColorSpace&& other) noexcept : mp_cs(other.mp_cs)
+{
+	other.mp_cs = 0;
+}
+
+inline ColorSpace& ColorSpace::operator=(ColorSpace&& other) noexcept
+{
+	std::swap(mp_cs, other.mp_cs);
+	return *this;
+}
+#endif
+
 inline ColorSpace::~ColorSpace() {
 	DREX(mp_cs, TRN_ColorSpaceDestroy(mp_cs));
 }
@@ -192,13 +236,13 @@ inline void ColorSpace::Convert2CMYK(const ColorPt& in_color, ColorPt& out_color
 #endif
 
 inline ColorSpace ColorSpace::GetAlternateColorSpace() {
-	TRN_ColorSpace result;
+	TRN_ColorSpace result = 0;
 	REX(TRN_ColorSpaceGetAlternateColorSpace(mp_cs,&result));
 	return ColorSpace(result);
 }
 
 inline ColorSpace ColorSpace::GetBaseColorSpace() {
-	TRN_ColorSpace result;
+	TRN_ColorSpace result = 0;
 	REX(TRN_ColorSpaceGetBaseColorSpace(mp_cs,&result));
 	return ColorSpace(result);
 }
@@ -209,7 +253,7 @@ inline int ColorSpace::GetHighVal() {
 
 #ifndef SWIG
 inline const UChar* ColorSpace::GetLookupTable() {
-	const TRN_UChar* result;
+	const TRN_UChar* result = 0;
 	REX(TRN_ColorSpaceGetLookupTable(mp_cs,&result));
 	return (const UChar*)result;
 }
@@ -228,7 +272,7 @@ inline void ColorSpace::GetBaseColor(UChar color_idx, ColorPt& out_color) {
 #endif
 
 inline Function ColorSpace::GetTintFunction()	{
-	TRN_Function result;
+	TRN_Function result = 0;
 	REX(TRN_ColorSpaceGetTintFunction(mp_cs,&result));
 	return Function(result);
 }
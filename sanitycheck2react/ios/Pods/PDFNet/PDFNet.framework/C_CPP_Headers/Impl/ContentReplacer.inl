@@ -6,7 +6,7 @@
 namespace pdftron {
 namespace PDF {
 
-inline ContentReplacer::ContentReplacer()
+inline ContentReplacer::ContentReplacer() : mp_impl(0)
 {
 	REX(TRN_ContentReplacerCreate(&mp_impl));
 }
@@ -0,0 +1,396 @@
+inline ContentWalker::FormCache::FormCache(size_t max_items)
+	: m_max_items(max_items), m_items(0), m_hits(0), m_misses(0), m_evictions(0)
+{
+}
+
+inline void ContentWalker::FormCache::Remove(const PDFDoc& doc)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	for (EntryList::iterator itr = m_entries.begin(); itr != m_entries.end(); ) {
+		if (itr->key.doc == &doc) {
+			m_items -= itr->content->items.size();
+			m_index.erase(itr->key);
+			itr = m_entries.erase(itr);
+		}
+		else ++itr;
+	}
+}
+
+inline void ContentWalker::FormCache::Clear()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_entries.clear();
+	m_index.clear();
+	m_items = 0;
+}
+
+inline ContentWalker::FormCache::Stats ContentWalker::FormCache::GetStats() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	Stats result;
+	result.hits = m_hits;
+	result.misses = m_misses;
+	result.evictions = m_evictions;
+	result.entries = m_entries.size();
+	result.items = m_items;
+	result.hit_rate = m_hits + m_misses ? (double)m_hits / (double)(m_hits + m_misses) : 0;
+	return result;
+}
+
+inline std::shared_ptr<const ContentWalker::FormCache::Content> ContentWalker::FormCache::Find(const Key& key, int max_depth)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	std::map<Key, EntryList::iterator>::iterator itr = m_index.find(key);
+	if (itr == m_index.end() || itr->second->content->depth > max_depth) {
+		++m_misses;
+		return std::shared_ptr<const Content>();
+	}
+	m_entries.splice(m_entries.begin(), m_entries, itr->second);
+	++m_hits;
+	return itr->second->content;
+}
+
+inline void ContentWalker::FormCache::Insert(const Key& key, const std::shared_ptr<const Content>& content)
+{
+	size_t size = content->items.size();
+	if (size > m_max_items) return;
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+	std::map<Key, EntryList::iterator>::iterator itr = m_index.find(key);
+	if (itr != m_index.end()) {
+		m_items -= itr->second->content->items.size();
+		m_entries.erase(itr->second);
+		m_index.erase(itr);
+	}
+
+	Entry entry;
+	entry.key = key;
+	entry.content = content;
+	m_entries.push_front(entry);
+	m_index[key] = m_entries.begin();
+	m_items += size;
+
+	while (m_items > m_max_items) {
+		Entry& victim = m_entries.back();
+		m_items -= victim.content->items.size();
+		m_index.erase(victim.key);
+		m_entries.pop_back();
+		++m_evictions;
+	}
+}
+
+inline ContentWalker::ContentWalker(int num_threads)
+	: m_scheduler(num_threads), m_type_mask(~0u), m_flags(e_default), m_max_depth(32), m_batch_size(256), m_form_cache(0)
+{
+}
+
+inline int ContentWalker::GetThreadCount() const
+{
+	return m_scheduler.GetThreadCount();
+}
+
+inline void ContentWalker::SetElementTypes(UInt32 type_mask)
+{
+	m_type_mask = type_mask;
+}
+
+inline void ContentWalker::SetItemFlags(UInt32 flags)
+{
+	m_flags = flags;
+}
+
+inline void ContentWalker::SetMaxFormDepth(int max_depth)
+{
+	m_max_depth = max_depth < 0 ? 0 : max_depth;
+}
+
+inline void ContentWalker::SetBatchSize(int batch_size)
+{
+	m_batch_size = batch_size;
+}
+
+inline void ContentWalker::SetFormCache(FormCache* cache)
+{
+	m_form_cache = cache;
+}
+
+inline ContentWalker::Stats ContentWalker::Walk(PDFDoc& doc, const std::vector<int>& page_nums, const BatchProc& proc)
+{
+	Clock::time_point start = Clock::now();
+
+	int num_workers = m_scheduler.GetThreadCount();
+	if (num_workers > (int)page_nums.size()) num_workers = (int)page_nums.size();
+	std::vector<Worker> workers(num_workers);
+
+	// resolve all pages up front, so that the workers do not walk the page tree
+	std::vector<SDF::Obj> pages;
+	{
+		DocReadGuard guard(doc, "ContentWalker::Walk (page lookup)");
+		PageIndex::Lookup(doc, page_nums, pages);
+	}
+
+	m_scheduler.Run((int)page_nums.size(), [&](int idx, int w) {
+		Worker& worker = workers[w];
+		if (!worker.reader) {
+			worker.reader.reset(new ElementReader());
+			worker.batch.reserve(m_batch_size > 0 ? m_batch_size : 1);
+			worker.doc = &doc;
+		}
+		DocReadGuard guard(doc, "ContentWalker::Walk (walk)");
+		WalkPage(Page(pages[idx]), idx, worker, w, proc);
+	});
+
+	Stats stats = Stats();
+	for (size_t w = 0; w < workers.size(); ++w) {
+		const Stats& s = workers[w].stats;
+		stats.pages += s.pages;
+		stats.elements += s.elements;
+		stats.items += s.items;
+		stats.forms += s.forms;
+		stats.forms_skipped += s.forms_skipped;
+		stats.forms_cached += s.forms_cached;
+		if (s.max_depth > stats.max_depth) stats.max_depth = s.max_depth;
+	}
+	stats.elapsed_ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+	return stats;
+}
+
+inline void ContentWalker::WalkPage(Page page, int page_idx, Worker& worker, int worker_idx, const BatchProc& proc) const
+{
+	ElementReader& reader = *worker.reader;
+	std::vector<Frame>& stack = worker.stack;
+	Recording& rec = worker.recording;
+	stack.clear();
+	worker.batch.clear();
+	rec.frame = -1;
+
+	// The forms are entered with FormBegin(), so their elements inherit the
+	// graphics state of the page. The open forms are tracked on 'stack'
+	// rather than by recursion.
+	reader.Begin(page);
+	for (;;) {
+		Element element = reader.Next();
+		if (!element) {
+			reader.End();
+			if (stack.empty()) break;
+			if (rec.frame == (int)stack.size() - 1) EndRecording(worker);
+			stack.pop_back();
+			continue;
+		}
+
+		++worker.stats.elements;
+		Element::Type type = element.GetType();
+		if (m_type_mask & TypeMask(type)) {
+			Item item = Item();
+			Record(element, page_idx, stack, item);
+			Emit(item, worker, worker_idx, proc);
+		}
+
+		if (type == Element::e_form) {
+			Frame frame;
+			if (!CanEnter(element, stack, frame)) {
+				++worker.stats.forms_skipped;
+			}
+			else if (!Replay(element, page_idx, frame, worker, worker_idx, proc)) {
+				reader.FormBegin();
+				stack.push_back(frame);
+				++worker.stats.forms;
+				if ((int)stack.size() > worker.stats.max_depth) worker.stats.max_depth = (int)stack.size();
+				if (rec.frame >= 0 && (int)stack.size() - 1 - rec.frame > rec.depth) rec.depth = (int)stack.size() - 1 - rec.frame;
+			}
+		}
+	}
+
+	Flush(worker, worker_idx, proc);
+	++worker.stats.pages;
+}
+
+inline bool ContentWalker::CanEnter(Element& element, const std::vector<Frame>& stack, Frame& out_frame) const
+{
+	out_frame.obj_num = 0;
+	out_frame.gen_num = 0;
+	if ((int)stack.size() >= m_max_depth) return false;
+
+	SDF::Obj xobj = element.GetXObject();
+	if (!xobj.IsIndirect()) return true;
+	out_frame.obj_num = xobj.GetObjNum();
+	out_frame.gen_num = xobj.GetGenNum();
+	for (size_t i = 0; i < stack.size(); ++i) {
+		if (stack[i].obj_num == out_frame.obj_num) return false;
+	}
+	return true;
+}
+
+inline void ContentWalker::Record(Element& element, int page_idx, const std::vector<Frame>& stack, Item& item) const
+{
+	item.type = element.GetType();
+	item.page_idx = page_idx;
+	item.depth = (int)stack.size();
+	item.form_num = stack.empty() ? 0 : stack.back().obj_num;
+	item.fill_space = ColorSpace::e_null;
+	item.stroke_space = ColorSpace::e_null;
+
+	bool filled = false, stroked = false;
+	switch (item.type) {
+	case Element::e_image:
+	case Element::e_form:
+		item.obj = element.GetXObject();
+		break;
+	case Element::e_text: {
+		GState gs = element.GetGState();
+		item.obj = gs.GetFont().GetSDFObj();
+		item.font_size = gs.GetFontSize();
+		filled = true;
+		break;
+	}
+	case Element::e_path:
+		filled = element.IsFilled();
+		stroked = element.IsStroked();
+		break;
+	default:
+		break;
+	}
+
+	if ((m_flags & e_colors) && (filled || stroked)) {
+		GState gs = element.GetGState();
+		if (filled) item.fill_space = gs.GetFillColorSpace().GetType();
+		if (stroked) item.stroke_space = gs.GetStrokeColorSpace().GetType();
+	}
+	if (m_flags & e_ctm) {
+		GetCTM(element, item.ctm);
+	}
+	if (m_flags & e_bbox) {
+		Rect bbox;
+		if (element.GetBBox(bbox)) {
+			item.bbox[0] = bbox.x1;
+			item.bbox[1] = bbox.y1;
+			item.bbox[2] = bbox.x2;
+			item.bbox[3] = bbox.y2;
+		}
+	}
+}
+
+inline bool ContentWalker::Replay(Element& element, int page_idx, const Frame& frame, Worker& worker, int worker_idx, const BatchProc& proc) const
+{
+	if (!m_form_cache || frame.obj_num == 0 || (m_flags & (e_bbox | e_colors))) return false;
+
+	FormCache::Key key;
+	key.doc = worker.doc;
+	key.obj_num = frame.obj_num;
+	key.gen_num = frame.gen_num;
+	key.type_mask = m_type_mask;
+	key.flags = m_flags;
+
+	double ctm[6] = { 1, 0, 0, 1, 0, 0 };
+	if (m_flags & e_ctm) GetCTM(element, ctm);
+
+	std::vector<Frame>& stack = worker.stack;
+	Recording& rec = worker.recording;
+	int base = (int)stack.size() + 1;
+	std::shared_ptr<const FormCache::Content> content = m_form_cache->Find(key, m_max_depth - base);
+	if (!content) {
+		// Record the form, unless an enclosing form is being recorded
+		// already. The items of this form become part of that recording.
+		if (rec.frame < 0 && Invert(ctm, rec.inv_ctm)) {
+			rec.frame = (int)stack.size();
+			rec.key = key;
+			rec.elements = worker.stats.elements;
+			rec.forms = worker.stats.forms;
+			rec.forms_skipped = worker.stats.forms_skipped;
+			rec.depth = 0;
+			rec.items.clear();
+		}
+		return false;
+	}
+
+	const std::vector<Item>& items = content->items;
+	for (size_t i = 0; i < items.size(); ++i) {
+		Item item = items[i];
+		item.page_idx = page_idx;
+		item.depth += base;
+		if (m_flags & e_ctm) Multiply(items[i].ctm, ctm, item.ctm);
+		Emit(item, worker, worker_idx, proc);
+	}
+
+	worker.stats.elements += content->elements;
+	worker.stats.forms += content->forms;
+	++worker.stats.forms_cached;
+	if (base + content->depth > worker.stats.max_depth) worker.stats.max_depth = base + content->depth;
+	if (rec.frame >= 0 && base - 1 + content->depth - rec.frame > rec.depth) rec.depth = base - 1 + content->depth - rec.frame;
+	return true;
+}
+
+inline void ContentWalker::Emit(const Item& item, Worker& worker, int worker_idx, const BatchProc& proc) const
+{
+	Recording& rec = worker.recording;
+	if (rec.frame >= 0) {
+		rec.items.push_back(item);
+		Item& rel = rec.items.back();
+		rel.depth -= rec.frame + 1;
+		if (m_flags & e_ctm) Multiply(item.ctm, rec.inv_ctm, rel.ctm);
+	}
+
+	worker.batch.push_back(item);
+	if ((int)worker.batch.size() >= m_batch_size) Flush(worker, worker_idx, proc);
+}
+
+inline void ContentWalker::EndRecording(Worker& worker) const
+{
+	Recording& rec = worker.recording;
+	rec.frame = -1;
+
+	// a form that contains a skipped form is read differently at another
+	// depth or inside another form, so it is not cached
+	if (worker.stats.forms_skipped != rec.forms_skipped) return;
+
+	std::shared_ptr<FormCache::Content> content(new FormCache::Content());
+	content->items.swap(rec.items);
+	content->elements = worker.stats.elements - rec.elements;
+	content->forms = worker.stats.forms - rec.forms;
+	content->depth = rec.depth;
+	m_form_cache->Insert(rec.key, content);
+}
+
+inline void ContentWalker::Flush(Worker& worker, int worker_idx, const BatchProc& proc) const
+{
+	if (worker.batch.empty()) return;
+	worker.stats.items += worker.batch.size();
+	proc(worker.batch, worker_idx);
+	worker.batch.clear();
+}
+
+inline void ContentWalker::GetCTM(Element& element, double out_ctm[6])
+{
+	Common::Matrix2D ctm = element.GetCTM();
+	out_ctm[0] = ctm.m_a;
+	out_ctm[1] = ctm.m_b;
+	out_ctm[2] = ctm.m_c;
+	out_ctm[3] = ctm.m_d;
+	out_ctm[4] = ctm.m_h;
+	out_ctm[5] = ctm.m_v;
+}
+
+inline void ContentWalker::Multiply(const double m1[6], const double m2[6], double out[6])
+{
+	// m1 x m2, in the row vector convention of the PDF specification
+	double a = m1[0] * m2[0] + m1[1] * m2[2];
+	double b = m1[0] * m2[1] + m1[1] * m2[3];
+	double c = m1[2] * m2[0] + m1[3] * m2[2];
+	double d = m1[2] * m2[1] + m1[3] * m2[3];
+	double h = m1[4] * m2[0] + m1[5] * m2[2] + m2[4];
+	double v = m1[4] * m2[1] + m1[5] * m2[3] + m2[5];
+	out[0] = a; out[1] = b; out[2] = c; out[3] = d; out[4] = h; out[5] = v;
+}
+
+inline bool ContentWalker::Invert(const double m[6], double out[6])
+{
+	double det = m[0] * m[3] - m[1] * m[2];
+	if (det == 0) return false;
+	out[0] = m[3] / det;
+	out[1] = -m[1] / det;
+	out[2] = -m[2] / det;
+	out[3] = m[0] / det;
+	out[4] = -(m[4] * out[0] + m[5] * out[2]);
+	out[5] = -(m[4] * out[1] + m[5] * out[3]);
+	return true;
+}
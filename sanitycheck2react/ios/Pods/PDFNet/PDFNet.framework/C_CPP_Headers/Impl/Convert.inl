@@ -39,103 +39,103 @@ inline SVGOutputOptions::SVGOutputOptions()
 
 inline void SVGOutputOptions::SetEmbedImages(bool embed_images)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutBool(m_obj, "EMBEDIMAGES", BToTB(embed_images), &result));
 }
 
 inline void SVGOutputOptions::SetNoFonts(bool no_fonts)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutBool(m_obj, "NOFONTS", BToTB(no_fonts), &result));
 }
 
 inline void SVGOutputOptions::SetSvgFonts(bool svg_fonts)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutBool(m_obj, "SVGFONTS", BToTB(svg_fonts), &result));
 }
 
 inline void SVGOutputOptions::SetEmbedFonts(bool embed_fonts)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutBool(m_obj, "EMBEDFONTS", BToTB(embed_fonts), &result));
 }
 
 inline void SVGOutputOptions::SetFlattenContent(enum Convert::FlattenFlag flatten)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	SetFlattenContentImpl(m_obj, flatten, &result);
 }
 
 inline void SVGOutputOptions::SetFlattenThreshold(enum Convert::FlattenThresholdFlag threshold)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	SetFlattenThresholdImpl(m_obj, threshold, &result);
 }
 
 inline void SVGOutputOptions::SetFlattenDPI(UInt32 dpi)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutNumber(m_obj, "DPI", dpi, &result));
 }
 
 inline void SVGOutputOptions::SetFlattenMaximumImagePixels(UInt32 max_pixels)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutNumber(m_obj, "MAX_IMAGE_PIXELS", max_pixels, &result));
 }
 
 inline void SVGOutputOptions::SetCompress(bool svgz)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutBool(m_obj, "SVGZ", BToTB(svgz), &result));
 }
 
 inline void SVGOutputOptions::SetOutputThumbnails(bool include_thumbs)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutBool(m_obj,"NOTHUMBS",BToTB(!include_thumbs),&result));
 }
 
 inline void SVGOutputOptions::SetThumbnailSize(UInt32 size)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutNumber(m_obj,"THUMB_SIZE",size,&result));
 }
 
 inline void SVGOutputOptions::SetCreateXmlWrapper(bool xml)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutBool(m_obj, "NOXMLDOC", BToTB(!xml), &result));
 }
 
 inline void SVGOutputOptions::SetDtd(bool dtd)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutBool(m_obj, "OMITDTD", BToTB(!dtd), &result));
 }
 
 inline void SVGOutputOptions::SetAnnots(bool annots)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutBool(m_obj, "NOANNOTS", BToTB(!annots), &result));
 }
 
 inline void SVGOutputOptions::SetNoUnicode(bool no_unicode)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutBool(m_obj, "NOUNICODE", BToTB(no_unicode), &result));
 }
 
 inline void SVGOutputOptions::SetIndividualCharPlacement(bool individual_char_placement)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutBool(m_obj, "INDIVIDUALCHARPLACEMENT", BToTB(individual_char_placement), &result));
 }
 
 inline void SVGOutputOptions::SetRemoveCharPlacement(bool remove_char_placement)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutBool(m_obj, "REMOVECHARPLACEMENT", BToTB(remove_char_placement), &result));
 }
 
@@ -174,49 +174,49 @@ inline XPSOutputCommonOptions::XPSOutputCommonOptions()
 
 inline void XPSOutputCommonOptions::SetPrintMode(bool print_mode)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutBool(m_obj,"PRINTMODE",BToTB(print_mode),&result));
 }
 
 inline void XPSOutputCommonOptions::SetDPI(UInt32 dpi)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutNumber(m_obj,"DPI",dpi,&result));
 }
 
 inline void XPSOutputCommonOptions::SetRenderPages(bool render)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutBool(m_obj,"RENDER",BToTB(render),&result));
 }
 
 inline void XPSOutputCommonOptions::SetThickenLines(bool thicken)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutBool(m_obj,"THICKENLINES",BToTB(thicken),&result));
 }
 
 inline void XPSOutputCommonOptions::GenerateURLLinks(bool generate)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutBool(m_obj,"URL_LINKS",BToTB(generate),&result));
 }
 
 inline void XPSOutputCommonOptions::SetOverprint(enum OverprintPreviewMode mode)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	SetOverprintImpl(m_obj, static_cast<PDFRasterizer::OverprintPreviewMode>(mode), &result);
 }
 
 inline void XPSOutputOptions::SetOpenXps(bool openxps)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutBool(m_obj,"OPENXPS",BToTB(openxps),&result));
 }
 
 inline void XODOutputOptions::SetOutputThumbnails(bool include_thumbs)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutBool(m_obj,"NOTHUMBS",BToTB(!include_thumbs),&result));
 }
 
@@ -227,7 +227,7 @@ inline void XODOutputOptions::SetThumbnailSize(UInt32 size)
 
 inline void XODOutputOptions::SetThumbnailSize(UInt32 regular_size, UInt32 large_size)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutNumber(m_obj,"THUMB_SIZE",regular_size,&result));
 	REX(TRN_ObjPutNumber(m_obj,"LARGE_THUMB_SIZE",large_size,&result));
 
@@ -235,55 +235,55 @@ inline void XODOutputOptions::SetThumbnailSize(UInt32 regular_size, UInt32 large
 
 inline void XODOutputOptions::SetElementLimit(UInt32 element_limit)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutNumber(m_obj,"ELEMENTLIMIT",element_limit,&result));
 }
 
 inline void XODOutputOptions::SetOpacityMaskWorkaround(bool opacity_render)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutBool(m_obj,"MASKRENDER",opacity_render,&result));
 }
 
 inline void XODOutputOptions::SetMaximumImagePixels(UInt32 max_pixels)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutNumber(m_obj,"MAX_IMAGE_PIXELS",max_pixels,&result));
 }
 
 inline void XODOutputOptions::SetFlattenContent(enum Convert::FlattenFlag flatten)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	SetFlattenContentImpl(m_obj, flatten, &result);
 }
 
 inline void XODOutputOptions::SetFlattenThreshold(enum Convert::FlattenThresholdFlag threshold)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	SetFlattenThresholdImpl(m_obj, threshold, &result);
 }
 
 inline void XODOutputOptions::SetPreferJPG(bool prefer_jpg)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutBool(m_obj,"PREFER_JPEG",prefer_jpg,&result));
 }
 
 inline void XODOutputOptions::SetJPGQuality(UInt32 quality)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutNumber(m_obj,"JPEG_QUALITY",quality,&result));
 }
 
 inline void XODOutputOptions::SetSilverlightTextWorkaround(bool workaround)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutBool(m_obj,"REMOVE_ROTATED_TEXT",workaround,&result));
 }
 
 inline void XODOutputOptions::SetAnnotationOutput(enum AnnotationOutputFlag annot_output)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	switch (annot_output)
 	{
 		case e_internal_xfdf:
@@ -300,19 +300,19 @@ inline void XODOutputOptions::SetAnnotationOutput(enum AnnotationOutputFlag anno
 
 inline void XODOutputOptions::SetExternalParts(bool generate)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutBool(m_obj, "EXTERNAL_PARTS", generate, &result));
 }
 
 inline void XODOutputOptions::SetEncryptPassword(const char* pass)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutName(m_obj, "ENCRYPT_PASSWORD", pass, &result));
 }
 
 inline void XODOutputOptions::UseSilverlightFlashCompatible(bool compatible)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutBool(m_obj, "COMPATIBLE_XOD", compatible, &result));
 }
 
@@ -323,62 +323,62 @@ inline HTMLOutputOptions::HTMLOutputOptions()
 
 inline void HTMLOutputOptions::SetPreferJPG(bool prefer_jpg)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutBool(m_obj,"PREFER_JPEG",prefer_jpg,&result));
 }
 
 inline void HTMLOutputOptions::SetJPGQuality(UInt32 quality)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutNumber(m_obj,"JPEG_QUALITY",quality,&result));
 }
 
 
 inline void HTMLOutputOptions::SetDPI(UInt32 dpi)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutNumber(m_obj,"DPI",dpi,&result));
 }
 
 inline void HTMLOutputOptions::SetMaximumImagePixels(UInt32 max_pixels)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutNumber(m_obj,"MAX_IMAGE_PIXELS",max_pixels,&result));
 }
 
 inline void HTMLOutputOptions::SetReflow(bool reflow)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutBool(m_obj,"REFLOW",reflow,&result));
 }
 
 inline void HTMLOutputOptions::SetScale(double scale)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutNumber(m_obj,"SCALE",scale,&result));
 }
 
 inline void HTMLOutputOptions::SetExternalLinks(bool enable)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutBool(m_obj,"EXTERNAL_LINKS",enable,&result));
 }
 
 inline void HTMLOutputOptions::SetInternalLinks(bool enable)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutBool(m_obj,"INTERNAL_LINKS",enable,&result));
 }
 
 inline void HTMLOutputOptions::SetSimplifyText(bool enable)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutBool(m_obj,"SIMPLIFY_TEXT",enable,&result));
 }
 
 inline void HTMLOutputOptions::SetReportFile(const UString& path)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutText(m_obj,"REPORT_FILE",path.mp_impl,&result));
 }
 
@@ -389,7 +389,7 @@ inline TiffOutputOptions::TiffOutputOptions()
 
 inline void TiffOutputOptions::SetBox(enum Page::Box type)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	switch (type)
 	{
 	case e_Page_media:
@@ -412,7 +412,7 @@ inline void TiffOutputOptions::SetBox(enum Page::Box type)
 
 inline void TiffOutputOptions::SetRotate(enum Page::Rotate rotation)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	switch (rotation)
 	{
 	case e_Page_0:
@@ -432,7 +432,7 @@ inline void TiffOutputOptions::SetRotate(enum Page::Rotate rotation)
 
 inline void TiffOutputOptions::SetClip(double x1, double y1, double x2, double y2)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutNumber(m_obj,"CLIP_X1",x1,&result));
 	REX(TRN_ObjPutNumber(m_obj,"CLIP_Y1",y1,&result));
 	REX(TRN_ObjPutNumber(m_obj,"CLIP_X2",x2,&result));
@@ -441,91 +441,91 @@ inline void TiffOutputOptions::SetClip(double x1, double y1, double x2, double y
 
 inline void TiffOutputOptions::SetPages(const char* page_desc)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutName(m_obj, "PAGES", page_desc, &result));
 }
 
 inline void TiffOutputOptions::SetOverprint(enum PDFRasterizer::OverprintPreviewMode mode)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	SetOverprintImpl(m_obj, mode, &result);
 }
 
 inline void TiffOutputOptions::SetCMYK(bool enable)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutBool(m_obj, "CMYK", BToTB(enable), &result));
 }
 
 inline void TiffOutputOptions::SetDither(bool enable)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutBool(m_obj, "DITHER", BToTB(enable), &result));
 }
 
 inline void TiffOutputOptions::SetGray(bool enable)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutBool(m_obj, "GRAY", BToTB(enable), &result));
 }
 
 inline void TiffOutputOptions::SetMono(bool enable)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutBool(m_obj, "MONO", BToTB(enable), &result));
 }
 
 inline void TiffOutputOptions::SetAnnots(bool enable)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutBool(m_obj, "ANNOTS", BToTB(enable), &result));
 }
 
 inline void TiffOutputOptions::SetSmooth(bool enable)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutBool(m_obj, "SMOOTH", BToTB(enable), &result));
 }
 
 inline void TiffOutputOptions::SetPrintmode(bool enable)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutBool(m_obj, "PRINTMODE", BToTB(enable), &result));
 }
 
 inline void TiffOutputOptions::SetTransparentPage(bool enable)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutBool(m_obj, "TRANSPARENT_PAGE", BToTB(enable), &result));
 }
 
 inline void TiffOutputOptions::SetPalettized(bool enable)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutBool(m_obj, "PALETTIZED", BToTB(enable), &result));
 }
 
 inline void TiffOutputOptions::SetDPI(double dpi)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutNumber(m_obj,"DPI",dpi,&result));
 }
 
 inline void TiffOutputOptions::SetGamma(double gamma)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutNumber(m_obj,"GAMMA",gamma,&result));
 }
 
 inline void TiffOutputOptions::SetHRes(int hres)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutNumber(m_obj,"HRES",static_cast<double>(hres),&result));
 }
 
 inline void TiffOutputOptions::SetVRes(int vres)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutNumber(m_obj,"VRES",static_cast<double>(vres),&result));
 }
 
@@ -536,13 +536,13 @@ inline EPUBOutputOptions::EPUBOutputOptions()
 
 inline void EPUBOutputOptions::SetExpanded(bool expanded)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutBool(m_obj,"EPUB_EXPANDED",expanded,&result));
 }
 
 inline void EPUBOutputOptions::SetReuseCover(bool reuse)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutBool(m_obj,"EPUB_REUSE_COVER",reuse,&result));
 }
 
@@ -598,7 +598,7 @@ inline Filters::Filter Convert::ToXod(const UString & in_filename)
 
 inline Filters::Filter Convert::ToXod( const UString & in_filename, const XODOutputOptions& options)
 {
-	TRN_Filter result;
+	TRN_Filter result = 0;
 	REX(TRN_ConvertFileToXodStream(in_filename.mp_impl, options.m_obj, &result));
 	return Filters::Filter(result,true);
 }
@@ -611,7 +611,7 @@ inline Filters::Filter Convert::ToXod(PDFDoc& in_pdfdoc)
 
 inline Filters::Filter Convert::ToXod(PDFDoc& in_pdfdoc, const XODOutputOptions& options)
 {
-	TRN_Filter result;
+	TRN_Filter result = 0;
 	REX(TRN_ConvertToXodStream(in_pdfdoc.mp_doc, options.m_obj, &result)); // try
 	return Filters::Filter(result,true);
 }
@@ -624,7 +624,7 @@ inline ConversionMonitor Convert::ToXodWithMonitor(PDFDoc& in_pdfdoc)
 
 inline ConversionMonitor Convert::ToXodWithMonitor(PDFDoc& in_pdfdoc, const XODOutputOptions& options)
 {
-	TRN_ConversionMonitor result;
+	TRN_ConversionMonitor result = 0;
 	REX(TRN_ConvertToXodWithMonitor(in_pdfdoc.mp_doc, options.m_obj, &result));
 	ConversionMonitor monitor = ConversionMonitor(result,true);
 	return monitor;
@@ -648,14 +648,14 @@ inline bool ConversionMonitor::Ready()
 
 inline UInt32 ConversionMonitor::Progress()
 {
-	UInt32 result;
+	UInt32 result = 0;
 	REX(TRN_ConversionMonitorProgress(mp_impl,&result));
 	return result;
 }
 
 inline Filters::Filter ConversionMonitor::Filter()
 {
-	TRN_Filter result;
+	TRN_Filter result = 0;
 	REX(TRN_ConversionMonitorFilter(mp_impl, &result));
 	return Filters::Filter(result,true);
 }
@@ -691,6 +691,21 @@ inline ConversionMonitor& ConversionMonitor::operator =(const ConversionMonitor&
 	mp_impl=other.mp_impl;
 	return *this;
 }
+
+#ifdef PDFTRON_CPP11
+inline ConversionMonitor::ConversionMonitor(ConversionMonitor&& other) noexcept : mp_impl(other.mp_impl), m_owner(other.m_owner)
+{
+	other.mp_impl = 0;
+	other.m_owner = false;
+}
+
+inline ConversionMonitor& ConversionMonitor::operator=(ConversionMonitor&& other) noexcept
+{
+	std::swap(mp_impl, other.mp_impl);
+	std::swap(m_owner, other.m_owner);
+	return *this;
+}
+#endif
 inline ConversionMonitor::~ConversionMonitor()
 {
 	if(m_owner) {
@@ -36,6 +36,21 @@ inline CubicCurveBuilder& pdftron::PDF::CubicCurveBuilder::operator= (const Cubi
 	return *this;
 }
 
+#ifdef PDFTRON_CPP11
+inline CubicCurveBuilder::CubicCurveBuilder(CubicCurveBuilder&& other) noexcept : m_impl(other.m_impl), m_owner(other.m_owner)
+{
+	other.m_impl = 0;
+	other.m_owner = false;
+}
+
+inline CubicCurveBuilder& CubicCurveBuilder::operator=(CubicCurveBuilder&& other) noexcept
+{
+	std::swap(m_impl, other.m_impl);
+	std::swap(m_owner, other.m_owner);
+	return *this;
+}
+#endif
+
 inline CubicCurveBuilder::CubicCurveBuilder()
 	: m_impl(0)
 	, m_owner(false)
@@ -0,0 +1,89 @@
+
+inline CustomFilter::CustomFilter(OpenMode mode, void* user_data,
+	TRN_SeekProc seek_proc, TRN_TellProc tell_proc, TRN_FlushProc flush_proc,
+	TRN_ReadProc read_proc, TRN_WriteProc write_proc, TRN_DestroyProc destroy_proc)
+#ifndef SWIG
+	: mp_sink(0)
+#endif
+{
+	REX(TRN_FilterCreateCustom((enum TRN_FilterStdFileOpenMode)mode, user_data,
+		seek_proc, tell_proc, flush_proc, read_proc, write_proc, 0, destroy_proc, &m_impl));
+	m_owner=true;
+}
+
+#ifndef SWIG
+inline CustomFilter::CustomFilter(WriteProc write_proc, void* user_data) : mp_sink(new Sink) {
+	mp_sink->write_proc = write_proc;
+	mp_sink->user_data = user_data;
+	mp_sink->pos = 0;
+	// one reference for this object, one for the native filter (released
+	// via SinkDestroy)
+	mp_sink->refs = 2;
+	TRN_Exception ex = TRN_FilterCreateCustom(e_Filter_write_mode, mp_sink,
+		&SinkSeek, &SinkTell, &SinkFlush, 0, &SinkWrite, 0, &SinkDestroy, &m_impl);
+	if (ex != 0) {
+		delete mp_sink;
+		mp_sink = 0;
+		PDFTRON_THROW(Common::Exception(ex));
+		return;
+	}
+	m_owner=true;
+}
+
+inline CustomFilter::CustomFilter(const CustomFilter& copy) : Filter(copy), mp_sink(copy.mp_sink) {
+	if (mp_sink) ++mp_sink->refs;
+}
+
+inline CustomFilter& CustomFilter::operator=(const CustomFilter& other) {
+	if (this == &other) return *this;
+	Filter::operator=(other);
+	if (other.mp_sink) ++other.mp_sink->refs;
+	Release(mp_sink);
+	mp_sink = other.mp_sink;
+	return *this;
+}
+
+inline CustomFilter::~CustomFilter() {
+	Release(mp_sink);
+}
+
+inline void CustomFilter::Release(Sink* sink) {
+	if (sink && --sink->refs == 0) delete sink;
+}
+
+inline size_t CustomFilter::GetBytesWritten() const {
+	return mp_sink ? mp_sink->pos : 0;
+}
+
+inline size_t CustomFilter::SinkWrite(const void* buf, size_t size, size_t count, void* user_data) {
+	Sink* sink = (Sink*)user_data;
+	size_t bytes = size * count;
+	if (bytes == 0) return count;
+	size_t written = sink->write_proc((const UChar*)buf, bytes, sink->user_data);
+	if (written > bytes) written = bytes;
+	sink->pos += written;
+	return size ? written / size : 0;
+}
+
+inline size_t CustomFilter::SinkTell(void* user_data) {
+	return ((Sink*)user_data)->pos;
+}
+
+inline int CustomFilter::SinkSeek(void* user_data, long offset, int origin) {
+	// The sink is forward only. Seeking is only accepted if it does not move
+	// the current position.
+	Sink* sink = (Sink*)user_data;
+	if (origin == SEEK_CUR && offset == 0) return 0;
+	if (origin == SEEK_SET && offset >= 0 && (size_t)offset == sink->pos) return 0;
+	if (origin == SEEK_END && offset == 0) return 0;
+	return -1;
+}
+
+inline int CustomFilter::SinkFlush(void*) {
+	return 0;
+}
+
+inline void CustomFilter::SinkDestroy(void* user_data) {
+	Release((Sink*)user_data);
+}
+#endif
@@ -27,7 +27,7 @@ inline Date& Date::operator=(const Date& d)
 
 inline bool Date::IsValid() const
 {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_DateIsValid(this,&result));
 	return TBToB(result);
 }
@@ -44,7 +44,7 @@ inline void Date::Attach(SDF::Obj d)
 
 inline bool Date::Update(SDF::Obj d)
 {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_DateUpdate(this,d.mp_obj,&result));
 	return TBToB(result);
 }
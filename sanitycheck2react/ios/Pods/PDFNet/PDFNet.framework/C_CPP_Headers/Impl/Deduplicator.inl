@@ -0,0 +1,196 @@
+
+inline Deduplicator::Deduplicator(int num_threads)
+	: m_scheduler(num_threads)
+{
+}
+
+inline int Deduplicator::GetThreadCount() const
+{
+	return m_scheduler.GetThreadCount();
+}
+
+inline Deduplicator::Stats Deduplicator::Run(SDFDoc& doc)
+{
+	Clock::time_point start = Clock::now();
+	Stats stats = Stats();
+
+	std::vector<Record> records;
+	HashObjects(doc, records, stats);
+	stats.hash_ms = ElapsedMs(start);
+
+	Clock::time_point t = Clock::now();
+	PDF::DocWriteGuard guard(doc, "Deduplicator::Run");
+
+	// in every group of identical objects, keep the one with the lowest object
+	// number. The objects of a group are compared by content first, so that
+	// objects that only share the hash are not merged.
+	std::sort(records.begin(), records.end());
+	ObjHasher verifier;
+	verifier.SetIdentityProc(&IsIdentity);
+	ReplaceMap replace;
+	std::vector<Obj> keep;
+	for (size_t first = 0; first < records.size(); ) {
+		size_t last = first + 1;
+		while (last < records.size() && records[last].hash == records[first].hash) ++last;
+		if (last - first > 1) {
+			keep.assign(1, doc.GetObj(records[first].obj_num));
+			for (size_t i = first + 1; i < last; ++i) {
+				Obj obj = doc.GetObj(records[i].obj_num);
+				size_t k = 0;
+				while (k < keep.size() && !verifier.Equal(keep[k], obj)) ++k;
+				if (k == keep.size()) {
+					keep.push_back(obj);
+					continue;
+				}
+				replace[records[i].obj_num] = keep[k];
+				++stats.duplicates;
+				stats.stream_bytes_saved += records[i].stream_size;
+			}
+		}
+		first = last;
+	}
+
+	if (!replace.empty()) {
+		stats.references_rewritten += RewriteRefs(doc.GetTrailer(), replace);
+		for (UInt32 obj_num = 1; obj_num < stats.objects; ++obj_num) {
+			if (replace.count(obj_num)) continue;
+			Obj obj = doc.GetObj(obj_num);
+			if (!obj || obj.IsFree()) continue;
+			stats.references_rewritten += RewriteRefs(obj, replace);
+		}
+	}
+
+	stats.rewrite_ms = ElapsedMs(t);
+	stats.elapsed_ms = ElapsedMs(start);
+	return stats;
+}
+
+inline void Deduplicator::HashObjects(SDFDoc& doc, std::vector<Record>& out_records, Stats& stats) const
+{
+	std::vector<UInt32> pinned;
+	{
+		PDF::DocReadGuard guard(doc, "Deduplicator::Run (trailer)");
+		stats.objects = doc.XRefSize();
+		Obj trailer = doc.GetTrailer();
+		for (DictIterator itr = trailer.GetDictIterator(); itr.HasNext(); itr.Next()) {
+			Obj value = itr.Value();
+			if (value.IsIndirect()) pinned.push_back(value.GetObjNum());
+		}
+	}
+
+	// each worker keeps its own hasher, so objects shared by the objects of
+	// its blocks are hashed once per worker
+	UInt32 num_objects = stats.objects;
+	int num_blocks = (int)((num_objects + k_block_size - 1) / k_block_size);
+	std::vector<ObjHasher> hashers(m_scheduler.GetThreadCount());
+	for (size_t i = 0; i < hashers.size(); ++i) hashers[i].SetIdentityProc(&IsIdentity);
+	std::vector<std::vector<Record> > results(num_blocks);
+
+	m_scheduler.Run(num_blocks, [&](int block, int worker) {
+		ObjHasher& hasher = hashers[worker];
+		std::vector<Record>& result = results[block];
+		UInt32 begin = (UInt32)block * k_block_size;
+		UInt32 end = begin + k_block_size < num_objects ? begin + k_block_size : num_objects;
+
+		PDF::DocReadGuard guard(doc, "Deduplicator::Run (hash)");
+		for (UInt32 obj_num = begin ? begin : 1; obj_num < end; ++obj_num) {
+			if (std::find(pinned.begin(), pinned.end(), obj_num) != pinned.end()) continue;
+			Obj obj = doc.GetObj(obj_num);
+			if (!obj || obj.IsFree() || !IsMergeable(obj)) continue;
+
+			Record rec;
+			if (!hasher.Hash(obj, rec.hash)) continue;
+			rec.obj_num = obj_num;
+			rec.stream_size = obj.IsStream() ? obj.GetRawStreamLength() : 0;
+			result.push_back(rec);
+		}
+	});
+
+	for (size_t i = 0; i < results.size(); ++i) {
+		out_records.insert(out_records.end(), results[i].begin(), results[i].end());
+	}
+	for (size_t i = 0; i < hashers.size(); ++i) {
+		stats.stream_bytes_hashed += hashers[i].GetStreamBytesHashed();
+	}
+	stats.hashed = (UInt32)out_records.size();
+}
+
+inline bool Deduplicator::IsMergeable(Obj obj)
+{
+	switch (obj.GetType()) {
+	case Obj::e_array:
+		return true;
+	case Obj::e_dict:
+	case Obj::e_stream:
+		return !IsIdentity(obj);
+	default:
+		// merging numbers, names, etc. does not save anything
+		return false;
+	}
+}
+
+inline bool Deduplicator::IsIdentity(Obj obj)
+{
+	if (!obj.IsDict() && !obj.IsStream()) return false;
+
+	static const char* const types[] = {
+		"Catalog", "Pages", "Page", "Annot", "Sig", "DocTimeStamp", "OCG", "OCMD",
+		"StructTreeRoot", "StructElem", "MCR", "OBJR", "Outlines", "XRef", "ObjStm", 0
+	};
+	Obj type = obj.FindObj("Type");
+	if (type && type.IsName()) {
+		const char* name = type.GetName();
+		for (int i = 0; types[i]; ++i) {
+			if (!strcmp(name, types[i])) return true;
+		}
+	}
+
+	// form fields and annotations do not always have a /Type entry
+	if (obj.FindObj("FT") || (obj.FindObj("Subtype") && obj.FindObj("Rect"))) return true;
+	return false;
+}
+
+inline UInt32 Deduplicator::RewriteRefs(Obj container, const ReplaceMap& replace)
+{
+	UInt32 count = 0;
+	if (container.IsDict() || container.IsStream()) {
+		std::vector<std::pair<std::string, Obj> > changes;
+		for (DictIterator itr = container.GetDictIterator(); itr.HasNext(); itr.Next()) {
+			Obj value = itr.Value();
+			if (value.IsIndirect()) {
+				ReplaceMap::const_iterator target = replace.find(value.GetObjNum());
+				if (target != replace.end()) changes.push_back(std::make_pair(std::string(itr.Key().GetName()), target->second));
+			}
+			else if (value.IsDict() || value.IsArray()) {
+				count += RewriteRefs(value, replace);
+			}
+		}
+		// the dictionary is not modified while it is being iterated
+		for (size_t i = 0; i < changes.size(); ++i) {
+			container.Put(changes[i].first.c_str(), changes[i].second);
+		}
+		count += (UInt32)changes.size();
+	}
+	else if (container.IsArray()) {
+		size_t size = container.Size();
+		for (size_t i = 0; i < size; ++i) {
+			Obj value = container.GetAt(i);
+			if (value.IsIndirect()) {
+				ReplaceMap::const_iterator target = replace.find(value.GetObjNum());
+				if (target == replace.end()) continue;
+				container.EraseAt(i);
+				container.Insert(i, target->second);
+				++count;
+			}
+			else if (value.IsDict() || value.IsArray()) {
+				count += RewriteRefs(value, replace);
+			}
+		}
+	}
+	return count;
+}
+
+inline double Deduplicator::ElapsedMs(Clock::time_point start)
+{
+	return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
@@ -0,0 +1,405 @@
+inline DisplayList::DisplayList()
+{
+}
+
+inline void DisplayList::Build(const Page& page, int max_form_depth)
+{
+	ElementReader reader;
+	Build(reader, page, max_form_depth);
+}
+
+inline void DisplayList::Build(ElementReader& reader, const Page& page, int max_form_depth)
+{
+	Clear();
+
+	// index 0 is the initial state, used by the records that precede the
+	// first drawing element
+	GStateIndex index;
+	GStateRecord gs;
+	memset(&gs, 0, sizeof(gs));
+	gs.ctm[0] = gs.ctm[3] = 1;
+	gs.fill_opacity = gs.stroke_opacity = 1;
+	UInt32 gstate = Intern(gs, index);
+
+	// The graphics state is read completely at the first drawing element and
+	// after the state was restored (Q, end of a form); otherwise only the
+	// attributes reported by the change list are read.
+	bool refresh = true;
+	std::vector<UInt32> stack;
+
+	reader.Begin(page);
+	for (;;) {
+		Element element = reader.Next();
+		if (!element) {
+			reader.End();
+			if (stack.empty()) break;
+			stack.pop_back();
+			refresh = true;
+			continue;
+		}
+
+		Element::Type type = element.GetType();
+		switch (type) {
+		case Element::e_path:
+		case Element::e_text:
+		case Element::e_image:
+		case Element::e_inline_image:
+		case Element::e_shading:
+		case Element::e_form: {
+			UInt64 changes = refresh ? ~(UInt64)0 : reader.GetChangeMask();
+			if (changes) {
+				ReadGState(element, changes, gs);
+				gstate = Intern(gs, index);
+				reader.ClearChangeList();
+				refresh = false;
+			}
+			break;
+		}
+		case Element::e_group_end:
+			refresh = true;
+			break;
+		default:
+			break;
+		}
+
+		Add(element, (int)stack.size(), gstate);
+
+		if (type == Element::e_form && CanEnter(element, stack, max_form_depth)) {
+			SDF::Obj xobj = element.GetXObject();
+			reader.FormBegin();
+			stack.push_back(xobj.IsIndirect() ? xobj.GetObjNum() : 0);
+			refresh = true;
+		}
+	}
+}
+
+inline void DisplayList::Clear()
+{
+	m_records.clear();
+	m_gstates.clear();
+	m_ops.clear();
+	m_points.clear();
+	m_text.clear();
+}
+
+inline size_t DisplayList::GetRecordCount() const
+{
+	return m_records.size();
+}
+
+inline const DisplayList::Record& DisplayList::GetRecord(size_t idx) const
+{
+	return m_records[idx];
+}
+
+inline size_t DisplayList::GetGStateCount() const
+{
+	return m_gstates.size();
+}
+
+inline const DisplayList::GStateRecord& DisplayList::GetGState(size_t idx) const
+{
+	return m_gstates[idx];
+}
+
+#ifndef SWIG
+inline PathDataView DisplayList::GetPathData(const Record& rec) const
+{
+	if (rec.type != Element::e_path) return PathDataView();
+	const UChar* ops = m_ops.empty() ? 0 : &m_ops[0] + rec.data_offset;
+	const double* points = m_points.empty() ? 0 : &m_points[0] + rec.point_offset;
+	return PathDataView(ops, rec.data_size, points, rec.point_count);
+}
+
+inline ByteView DisplayList::GetTextData(const Record& rec) const
+{
+	if (rec.type != Element::e_text || m_text.empty()) return ByteView();
+	return ByteView(&m_text[0] + rec.data_offset, rec.data_size);
+}
+
+inline const double* DisplayList::GetTextMatrix(const Record& rec) const
+{
+	if (rec.type != Element::e_text) return 0;
+	return &m_points[0] + rec.point_offset;
+}
+#endif
+
+inline void DisplayList::Replay(Visitor& visitor) const
+{
+	for (size_t i = 0; i < m_records.size(); ++i) {
+		const Record& rec = m_records[i];
+		const GStateRecord& gs = m_gstates[rec.gstate];
+		switch (rec.type) {
+		case Element::e_path:
+			visitor.VisitPath(rec, gs, GetPathData(rec));
+			break;
+		case Element::e_text:
+			visitor.VisitText(rec, gs, GetTextData(rec), GetTextMatrix(rec));
+			break;
+		case Element::e_image:
+		case Element::e_form:
+			visitor.VisitXObject(rec, gs);
+			break;
+		default:
+			visitor.VisitOther(rec, gs);
+			break;
+		}
+	}
+}
+
+inline void DisplayList::SetSourceId(const std::string& source_id)
+{
+	m_source_id = source_id;
+}
+
+inline const std::string& DisplayList::GetSourceId() const
+{
+	return m_source_id;
+}
+
+inline size_t DisplayList::GetMemorySize() const
+{
+	return m_records.size() * sizeof(Record) + m_gstates.size() * sizeof(GStateRecord)
+		+ m_ops.size() + m_points.size() * sizeof(double) + m_text.size() + m_source_id.size();
+}
+
+inline void DisplayList::Serialize(std::vector<unsigned char>& out) const
+{
+	const UInt32 header[5] = { k_magic, k_version, k_byte_order, sizeof(Record), sizeof(GStateRecord) };
+	out.insert(out.end(), (const UChar*)header, (const UChar*)(header + 5));
+	Write(std::vector<char>(m_source_id.begin(), m_source_id.end()), out);
+	Write(m_records, out);
+	Write(m_gstates, out);
+	Write(m_ops, out);
+	Write(m_points, out);
+	Write(m_text, out);
+}
+
+inline bool DisplayList::Deserialize(const UChar* data, size_t size)
+{
+	Clear();
+	m_source_id.clear();
+
+	const UChar* end = data + size;
+	UInt32 header[5];
+	if (size < sizeof(header)) return false;
+	memcpy(header, data, sizeof(header));
+	data += sizeof(header);
+	if (header[0] != k_magic || header[1] != k_version || header[2] != k_byte_order
+		|| header[3] != sizeof(Record) || header[4] != sizeof(GStateRecord)) {
+		return false;
+	}
+
+	std::vector<char> source_id;
+	bool ok = Read(data, end, source_id)
+		&& Read(data, end, m_records)
+		&& Read(data, end, m_gstates)
+		&& Read(data, end, m_ops)
+		&& Read(data, end, m_points)
+		&& Read(data, end, m_text)
+		&& IsValid();
+	if (!ok) {
+		Clear();
+		return false;
+	}
+	m_source_id.assign(source_id.begin(), source_id.end());
+	return true;
+}
+
+inline bool DisplayList::Save(const std::string& path) const
+{
+	std::vector<unsigned char> buf;
+	Serialize(buf);
+	FILE* file = fopen(path.c_str(), "wb");
+	if (!file) return false;
+	bool ok = fwrite(&buf[0], buf.size(), 1, file) == 1;
+	if (fclose(file) != 0) ok = false;
+	if (!ok) remove(path.c_str());
+	return ok;
+}
+
+inline bool DisplayList::Load(const std::string& path)
+{
+	std::vector<unsigned char> buf;
+	bool ok = false;
+	FILE* file = fopen(path.c_str(), "rb");
+	if (file) {
+		long size = fseek(file, 0, SEEK_END) == 0 ? ftell(file) : -1;
+		if (size > 0 && fseek(file, 0, SEEK_SET) == 0) {
+			buf.resize((size_t)size);
+			ok = fread(&buf[0], buf.size(), 1, file) == 1;
+		}
+		fclose(file);
+	}
+	if (!ok) {
+		Clear();
+		m_source_id.clear();
+		return false;
+	}
+	return Deserialize(&buf[0], buf.size());
+}
+
+inline void DisplayList::Add(Element& element, int depth, UInt32 gstate)
+{
+	Record rec;
+	memset(&rec, 0, sizeof(rec));
+	rec.type = (UInt8)element.GetType();
+	rec.depth = (UInt16)depth;
+	rec.gstate = gstate;
+
+	switch (rec.type) {
+	case Element::e_path: {
+		if (element.IsStroked()) rec.flags |= e_stroked;
+		if (element.IsFilled()) rec.flags |= e_filled;
+		if (element.IsClippingPath()) rec.flags |= e_clip;
+		if (element.IsWindingFill()) rec.flags |= e_winding_fill;
+		PathDataView path = element.GetPathDataView();
+		ByteView ops = path.GetOperators();
+		rec.data_offset = (UInt32)m_ops.size();
+		rec.data_size = (UInt32)ops.Size();
+		m_ops.insert(m_ops.end(), ops.begin(), ops.end());
+		rec.point_offset = (UInt32)m_points.size();
+		rec.point_count = (UInt32)path.GetPointCount();
+		m_points.insert(m_points.end(), path.GetPoints(), path.GetPoints() + path.GetPointCount());
+		break;
+	}
+	case Element::e_text: {
+		ByteView text = element.GetTextDataView();
+		rec.data_offset = (UInt32)m_text.size();
+		rec.data_size = (UInt32)text.Size();
+		m_text.insert(m_text.end(), text.begin(), text.end());
+		Common::Matrix2D tm = element.GetTextMatrix();
+		rec.point_offset = (UInt32)m_points.size();
+		rec.point_count = 6;
+		m_points.push_back(tm.m_a);
+		m_points.push_back(tm.m_b);
+		m_points.push_back(tm.m_c);
+		m_points.push_back(tm.m_d);
+		m_points.push_back(tm.m_h);
+		m_points.push_back(tm.m_v);
+		break;
+	}
+	case Element::e_image:
+	case Element::e_form: {
+		SDF::Obj xobj = element.GetXObject();
+		if (xobj.IsIndirect()) rec.obj_num = xobj.GetObjNum();
+		break;
+	}
+	default:
+		break;
+	}
+
+	m_records.push_back(rec);
+}
+
+inline bool DisplayList::CanEnter(Element& element, const std::vector<UInt32>& stack, int max_form_depth)
+{
+	if ((int)stack.size() >= max_form_depth) return false;
+	SDF::Obj xobj = element.GetXObject();
+	if (!xobj.IsIndirect()) return true;
+	UInt32 obj_num = xobj.GetObjNum();
+	for (size_t i = 0; i < stack.size(); ++i) {
+		if (stack[i] == obj_num) return false;
+	}
+	return true;
+}
+
+inline void DisplayList::ReadGState(Element& element, UInt64 changes, GStateRecord& gs)
+{
+	GState state = element.GetGState();
+	if (changes & GState::AttributeBit(GState::e_transform)) {
+		Common::Matrix2D ctm = state.GetTransform();
+		gs.ctm[0] = ctm.m_a;
+		gs.ctm[1] = ctm.m_b;
+		gs.ctm[2] = ctm.m_c;
+		gs.ctm[3] = ctm.m_d;
+		gs.ctm[4] = ctm.m_h;
+		gs.ctm[5] = ctm.m_v;
+	}
+	if (changes & (GState::AttributeBit(GState::e_fill_cs) | GState::AttributeBit(GState::e_fill_color))) {
+		ColorSpace cs = state.GetFillColorSpace();
+		gs.fill_space = (UInt8)cs.GetType();
+		ReadColor(state.GetFillColor(), cs.GetComponentNum(), gs.fill_color);
+	}
+	if (changes & (GState::AttributeBit(GState::e_stroke_cs) | GState::AttributeBit(GState::e_stroke_color))) {
+		ColorSpace cs = state.GetStrokeColorSpace();
+		gs.stroke_space = (UInt8)cs.GetType();
+		ReadColor(state.GetStrokeColor(), cs.GetComponentNum(), gs.stroke_color);
+	}
+	if (changes & GState::AttributeBit(GState::e_line_width)) {
+		gs.line_width = state.GetLineWidth();
+	}
+	if (changes & GState::AttributeBit(GState::e_font)) {
+		SDF::Obj font = state.GetFont().GetSDFObj();
+		gs.font = font && font.IsIndirect() ? font.GetObjNum() : 0;
+	}
+	if (changes & GState::AttributeBit(GState::e_font_size)) {
+		gs.font_size = state.GetFontSize();
+	}
+	if (changes & GState::AttributeBit(GState::e_text_render_mode)) {
+		gs.text_render_mode = (UInt8)state.GetTextRenderMode();
+	}
+	if (changes & GState::AttributeBit(GState::e_opacity_fill)) {
+		gs.fill_opacity = state.GetFillOpacity();
+	}
+	if (changes & GState::AttributeBit(GState::e_opacity_stroke)) {
+		gs.stroke_opacity = state.GetStrokeOpacity();
+	}
+}
+
+inline void DisplayList::ReadColor(ColorPt color, int num, double out[4])
+{
+	for (int i = 0; i < 4; ++i) {
+		out[i] = i < num ? color.Get(i) : 0;
+	}
+}
+
+inline UInt32 DisplayList::Intern(const GStateRecord& gs, GStateIndex& index)
+{
+	std::string key((const char*)&gs, sizeof(gs));
+	GStateIndex::iterator itr = index.find(key);
+	if (itr != index.end()) return itr->second;
+	UInt32 idx = (UInt32)m_gstates.size();
+	m_gstates.push_back(gs);
+	index.insert(std::make_pair(key, idx));
+	return idx;
+}
+
+inline bool DisplayList::IsValid() const
+{
+	for (size_t i = 0; i < m_records.size(); ++i) {
+		const Record& rec = m_records[i];
+		if (rec.gstate >= m_gstates.size()) return false;
+		if (rec.type == Element::e_path) {
+			if ((UInt64)rec.data_offset + rec.data_size > m_ops.size()) return false;
+			if ((UInt64)rec.point_offset + rec.point_count > m_points.size()) return false;
+		}
+		else if (rec.type == Element::e_text) {
+			if ((UInt64)rec.data_offset + rec.data_size > m_text.size()) return false;
+			if ((UInt64)rec.point_offset + 6 > m_points.size()) return false;
+		}
+	}
+	return true;
+}
+
+template <class T>
+inline void DisplayList::Write(const std::vector<T>& data, std::vector<unsigned char>& out)
+{
+	UInt64 count = data.size();
+	out.insert(out.end(), (const UChar*)&count, (const UChar*)(&count + 1));
+	if (count) out.insert(out.end(), (const UChar*)&data[0], (const UChar*)(&data[0] + data.size()));
+}
+
+template <class T>
+inline bool DisplayList::Read(const UChar*& data, const UChar* end, std::vector<T>& out)
+{
+	UInt64 count;
+	if ((size_t)(end - data) < sizeof(count)) return false;
+	memcpy(&count, data, sizeof(count));
+	data += sizeof(count);
+	if (count > (UInt64)(end - data) / sizeof(T)) return false;
+	out.resize((size_t)count);
+	if (count) memcpy(&out[0], data, (size_t)count * sizeof(T));
+	data += (size_t)count * sizeof(T);
+	return true;
+}
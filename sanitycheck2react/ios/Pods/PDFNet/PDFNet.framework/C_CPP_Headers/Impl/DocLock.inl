@@ -0,0 +1,363 @@
+
+inline LockProfiler::State& LockProfiler::GetState()
+{
+	static State state;
+	return state;
+}
+
+inline void LockProfiler::Enable(bool enable)
+{
+	GetState().enabled = enable;
+}
+
+inline bool LockProfiler::IsEnabled()
+{
+	return GetState().enabled.load(std::memory_order_relaxed);
+}
+
+inline void LockProfiler::Reset()
+{
+	State& state = GetState();
+	std::lock_guard<std::mutex> lock(state.mutex);
+	state.sites.clear();
+}
+
+inline std::vector<LockProfiler::SiteStats> LockProfiler::GetSiteStats()
+{
+	State& state = GetState();
+	std::lock_guard<std::mutex> lock(state.mutex);
+	std::map<std::string, SiteStats> sorted(state.sites.begin(), state.sites.end());
+	std::vector<SiteStats> result;
+	result.reserve(sorted.size());
+	for (std::map<std::string, SiteStats>::const_iterator itr = sorted.begin(); itr != sorted.end(); ++itr) {
+		result.push_back(itr->second);
+	}
+	return result;
+}
+
+inline std::vector<LockProfiler::Holder> LockProfiler::GetHolders(const SDF::SDFDoc* doc)
+{
+	State& state = GetState();
+	std::lock_guard<std::mutex> lock(state.mutex);
+	std::vector<Holder> result;
+	for (std::map<UInt64, HoldRecord>::const_iterator itr = state.holds.begin(); itr != state.holds.end(); ++itr) {
+		const HoldRecord& rec = itr->second;
+		if (doc && rec.doc != doc) continue;
+		std::ostringstream thread_id;
+		thread_id << rec.thread_id;
+		Holder holder;
+		holder.doc = rec.doc;
+		holder.thread_id = thread_id.str();
+		holder.site = rec.site;
+		holder.mode = rec.mode;
+		holder.held_ms = ElapsedMs(rec.start);
+		result.push_back(holder);
+	}
+	return result;
+}
+
+inline std::vector<LockProfiler::Holder> LockProfiler::GetHolders(const PDFDoc* doc)
+{
+	return GetHolders(doc ? &const_cast<PDFDoc*>(doc)->GetSDFDoc() : 0);
+}
+
+inline std::string LockProfiler::ToJSON()
+{
+	std::vector<SiteStats> sites = GetSiteStats();
+	std::vector<Holder> holders = GetHolders();
+
+	std::string out = "{\"sites\":[";
+	for (size_t i = 0; i < sites.size(); ++i) {
+		const SiteStats& s = sites[i];
+		if (i) out += ',';
+		out += "{\"site\":";
+		AppendString(out, s.site);
+		out += ",\"read_count\":";
+		AppendNumber(out, (double)s.read_count);
+		out += ",\"write_count\":";
+		AppendNumber(out, (double)s.write_count);
+		out += ",\"contended_count\":";
+		AppendNumber(out, (double)s.contended_count);
+		out += ",\"timeout_count\":";
+		AppendNumber(out, (double)s.timeout_count);
+		out += ",\"wait_ms\":{\"total\":";
+		AppendNumber(out, s.wait_total_ms);
+		out += ",\"max\":";
+		AppendNumber(out, s.wait_max_ms);
+		out += ",\"histogram_us\":";
+		AppendHistogram(out, s.wait_histogram);
+		out += "},\"hold_ms\":{\"total\":";
+		AppendNumber(out, s.hold_total_ms);
+		out += ",\"max\":";
+		AppendNumber(out, s.hold_max_ms);
+		out += ",\"histogram_us\":";
+		AppendHistogram(out, s.hold_histogram);
+		out += "}}";
+	}
+	out += "],\"holders\":[";
+	for (size_t i = 0; i < holders.size(); ++i) {
+		const Holder& h = holders[i];
+		char doc[32];
+		snprintf(doc, sizeof(doc), "%p", (const void*)h.doc);
+		if (i) out += ',';
+		out += "{\"doc\":";
+		AppendString(out, doc);
+		out += ",\"thread\":";
+		AppendString(out, h.thread_id);
+		out += ",\"site\":";
+		AppendString(out, h.site);
+		out += h.mode == e_read ? ",\"mode\":\"read\"" : ",\"mode\":\"write\"";
+		out += ",\"held_ms\":";
+		AppendNumber(out, h.held_ms);
+		out += '}';
+	}
+	out += "]}";
+	return out;
+}
+
+inline UInt64 LockProfiler::BeginHold(const SDF::SDFDoc* doc, const char* site, Mode mode, double wait_ms, bool contended)
+{
+	State& state = GetState();
+	HoldRecord rec;
+	rec.doc = doc;
+	rec.thread_id = std::this_thread::get_id();
+	rec.site = site ? site : "(unnamed)";
+	rec.mode = mode;
+	rec.start = Clock::now();
+
+	std::lock_guard<std::mutex> lock(state.mutex);
+	SiteStats& s = GetSiteLocked(state, rec.site);
+	if (mode == e_read) ++s.read_count; else ++s.write_count;
+	if (contended) ++s.contended_count;
+	s.wait_total_ms += wait_ms;
+	if (wait_ms > s.wait_max_ms) s.wait_max_ms = wait_ms;
+	AddSample(s.wait_histogram, wait_ms);
+
+	UInt64 hold_id = state.next_hold_id++;
+	state.holds.insert(std::make_pair(hold_id, rec));
+	return hold_id;
+}
+
+inline void LockProfiler::EndHold(UInt64 hold_id, double hold_ms)
+{
+	State& state = GetState();
+	std::lock_guard<std::mutex> lock(state.mutex);
+	std::map<UInt64, HoldRecord>::iterator itr = state.holds.find(hold_id);
+	if (itr == state.holds.end()) return;
+	SiteStats& s = GetSiteLocked(state, itr->second.site);
+	s.hold_total_ms += hold_ms;
+	if (hold_ms > s.hold_max_ms) s.hold_max_ms = hold_ms;
+	AddSample(s.hold_histogram, hold_ms);
+	state.holds.erase(itr);
+}
+
+inline void LockProfiler::RecordTimeout(const char* site, double wait_ms)
+{
+	State& state = GetState();
+	std::lock_guard<std::mutex> lock(state.mutex);
+	SiteStats& s = GetSiteLocked(state, site ? site : "(unnamed)");
+	++s.timeout_count;
+	s.wait_total_ms += wait_ms;
+	if (wait_ms > s.wait_max_ms) s.wait_max_ms = wait_ms;
+	AddSample(s.wait_histogram, wait_ms);
+}
+
+inline double LockProfiler::ElapsedMs(Clock::time_point start)
+{
+	return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+inline LockProfiler::SiteStats& LockProfiler::GetSiteLocked(State& state, const std::string& site)
+{
+	std::unordered_map<std::string, SiteStats>::iterator itr = state.sites.find(site);
+	if (itr == state.sites.end()) {
+		SiteStats s = SiteStats();
+		s.site = site;
+		itr = state.sites.insert(std::make_pair(site, s)).first;
+	}
+	return itr->second;
+}
+
+inline void LockProfiler::AddSample(UInt64* histogram, double ms)
+{
+	double us = ms * 1000;
+	int bucket = 0;
+	while (bucket < k_num_buckets - 1 && us >= (double)(1ULL << bucket)) ++bucket;
+	++histogram[bucket];
+}
+
+inline void LockProfiler::AppendHistogram(std::string& out, const UInt64* histogram)
+{
+	out += '{';
+	bool first = true;
+	for (int i = 0; i < k_num_buckets; ++i) {
+		if (!histogram[i]) continue;
+		if (!first) out += ',';
+		first = false;
+		char key[32];
+		snprintf(key, sizeof(key), "\"%llu\":", 1ULL << i);
+		out += key;
+		AppendNumber(out, (double)histogram[i]);
+	}
+	out += '}';
+}
+
+inline void LockProfiler::AppendString(std::string& out, const std::string& str)
+{
+	out += '"';
+	for (size_t i = 0; i < str.size(); ++i) {
+		unsigned char c = (unsigned char)str[i];
+		if (c == '"' || c == '\\') {
+			out += '\\';
+			out += (char)c;
+		}
+		else if (c < 0x20) {
+			char esc[8];
+			snprintf(esc, sizeof(esc), "\\u%04x", c);
+			out += esc;
+		}
+		else {
+			out += (char)c;
+		}
+	}
+	out += '"';
+}
+
+inline void LockProfiler::AppendNumber(std::string& out, double value)
+{
+	char buf[32];
+	if (value == (double)(UInt64)value) {
+		snprintf(buf, sizeof(buf), "%llu", (unsigned long long)value);
+	}
+	else {
+		snprintf(buf, sizeof(buf), "%.3f", value);
+	}
+	out += buf;
+}
+
+inline DocLockGuard::DocLockGuard(SDF::SDFDoc& doc, LockProfiler::Mode mode, const char* site)
+	: m_doc(doc), m_mode(mode), m_locked(false), m_hold_id(0)
+{
+	if (!LockProfiler::IsEnabled()) {
+		Lock();
+		return;
+	}
+
+	LockProfiler::Clock::time_point start = LockProfiler::Clock::now();
+	bool contended = !TryLock(0);
+	if (contended) Lock();
+	m_acquired = LockProfiler::Clock::now();
+	BeginHold(site, std::chrono::duration<double, std::milli>(m_acquired - start).count(), contended);
+}
+
+inline DocLockGuard::DocLockGuard(SDF::SDFDoc& doc, LockProfiler::Mode mode, int milliseconds, const char* site)
+	: m_doc(doc), m_mode(mode), m_locked(false), m_hold_id(0)
+{
+	if (!LockProfiler::IsEnabled()) {
+		TryLock(milliseconds);
+		return;
+	}
+
+	LockProfiler::Clock::time_point start = LockProfiler::Clock::now();
+	bool contended = !TryLock(0);
+	if (contended && milliseconds > 0) TryLock(milliseconds);
+	m_acquired = LockProfiler::Clock::now();
+	double wait_ms = std::chrono::duration<double, std::milli>(m_acquired - start).count();
+	if (m_locked) {
+		BeginHold(site, wait_ms, contended);
+	}
+	else {
+		LockProfiler::RecordTimeout(site, wait_ms);
+	}
+}
+
+inline DocLockGuard::~DocLockGuard()
+{
+	Release();
+}
+
+inline bool DocLockGuard::OwnsLock() const
+{
+	return m_locked;
+}
+
+inline void DocLockGuard::Unlock()
+{
+	Release();
+}
+
+inline bool DocLockGuard::TryLock(int milliseconds)
+{
+	m_locked = m_mode == LockProfiler::e_read ? m_doc.TryLockRead(milliseconds) : m_doc.TryLock(milliseconds);
+	return m_locked;
+}
+
+inline void DocLockGuard::Lock()
+{
+	if (m_mode == LockProfiler::e_read) m_doc.LockRead(); else m_doc.Lock();
+	m_locked = true;
+}
+
+inline void DocLockGuard::BeginHold(const char* site, double wait_ms, bool contended)
+{
+	PDFTRON_TRY {
+		m_hold_id = LockProfiler::BeginHold(&m_doc, site, m_mode, wait_ms, contended);
+	}
+	PDFTRON_CATCH(...) {
+		// the destructor does not run when the constructor throws
+		Release();
+		PDFTRON_RETHROW;
+	}
+}
+
+inline void DocLockGuard::Release()
+{
+	if (!m_locked) return;
+	double hold_ms = m_hold_id ? LockProfiler::ElapsedMs(m_acquired) : 0;
+	m_locked = false;
+	if (m_mode == LockProfiler::e_read) m_doc.UnlockRead(); else m_doc.Unlock();
+	if (m_hold_id) {
+		LockProfiler::EndHold(m_hold_id, hold_ms);
+		m_hold_id = 0;
+	}
+}
+
+inline DocReadGuard::DocReadGuard(PDFDoc& doc, const char* site)
+	: DocLockGuard(doc.GetSDFDoc(), LockProfiler::e_read, site)
+{
+}
+
+inline DocReadGuard::DocReadGuard(PDFDoc& doc, int milliseconds, const char* site)
+	: DocLockGuard(doc.GetSDFDoc(), LockProfiler::e_read, milliseconds, site)
+{
+}
+
+inline DocReadGuard::DocReadGuard(SDF::SDFDoc& doc, const char* site)
+	: DocLockGuard(doc, LockProfiler::e_read, site)
+{
+}
+
+inline DocReadGuard::DocReadGuard(SDF::SDFDoc& doc, int milliseconds, const char* site)
+	: DocLockGuard(doc, LockProfiler::e_read, milliseconds, site)
+{
+}
+
+inline DocWriteGuard::DocWriteGuard(PDFDoc& doc, const char* site)
+	: DocLockGuard(doc.GetSDFDoc(), LockProfiler::e_write, site)
+{
+}
+
+inline DocWriteGuard::DocWriteGuard(PDFDoc& doc, int milliseconds, const char* site)
+	: DocLockGuard(doc.GetSDFDoc(), LockProfiler::e_write, milliseconds, site)
+{
+}
+
+inline DocWriteGuard::DocWriteGuard(SDF::SDFDoc& doc, const char* site)
+	: DocLockGuard(doc, LockProfiler::e_write, site)
+{
+}
+
+inline DocWriteGuard::DocWriteGuard(SDF::SDFDoc& doc, int milliseconds, const char* site)
+	: DocLockGuard(doc, LockProfiler::e_write, milliseconds, site)
+{
+}
@@ -0,0 +1,77 @@
+
+inline DocSnapshotManager::DocSnapshotManager(PDFDoc& doc, UInt32 save_flags, const std::string& password)
+	: m_doc(doc), m_save_flags(save_flags & ~(UInt32)SDF::SDFDoc::e_incremental), m_password(password)
+{
+	Publish();
+}
+
+inline UInt64 DocSnapshotManager::Publish()
+{
+	// serializes publishers, so that version numbers follow the save order
+	std::lock_guard<std::mutex> publish_lock(m_publish_mutex);
+
+	std::shared_ptr<Version> version = std::make_shared<Version>();
+	version->number = GetVersion() + 1;
+	{
+		DocWriteGuard guard(m_doc, "DocSnapshotManager::Publish");
+		version->data = m_doc.Save(m_save_flags);
+	}
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_latest = version;
+	return version->number;
+}
+
+inline UInt64 DocSnapshotManager::GetVersion() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_latest ? m_latest->number : 0;
+}
+
+inline std::shared_ptr<const DocSnapshotManager::Version> DocSnapshotManager::GetLatest() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_latest;
+}
+
+inline DocSnapshotManager::Reader::Reader(DocSnapshotManager& manager)
+	: m_manager(manager)
+{
+	Open(m_manager.GetLatest());
+}
+
+inline bool DocSnapshotManager::Reader::Refresh()
+{
+	std::shared_ptr<const Version> latest = m_manager.GetLatest();
+	if (latest == m_version) return false;
+	return Open(latest);
+}
+
+inline UInt64 DocSnapshotManager::Reader::GetVersion() const
+{
+	return m_version ? m_version->number : 0;
+}
+
+inline PDFDoc& DocSnapshotManager::Reader::GetDoc()
+{
+	return *m_doc;
+}
+
+inline bool DocSnapshotManager::Reader::Open(const std::shared_ptr<const Version>& version)
+{
+	const UChar* data = version->data.empty() ? 0 : &version->data[0];
+	std::unique_ptr<PDFDoc> doc(new PDFDoc(data, version->data.size()));
+	const std::string& password = m_manager.m_password;
+	bool ok = password.empty() ? doc->InitSecurityHandler()
+		: doc->InitStdSecurityHandler(password.c_str(), (int)password.size());
+	if (!ok) {
+		PDFTRON_THROW(Common::Exception("InitSecurityHandler", __LINE__, __FILE__, "DocSnapshotManager::Reader",
+			"Cannot decrypt the published version"));
+		// keep the current version; a new reader keeps the undecrypted
+		// document, so that GetDoc() stays valid
+		if (m_doc) return false;
+	}
+	m_doc = std::move(doc);
+	m_version = version;
+	return ok;
+}
@@ -36,6 +36,21 @@ inline DocumentConversion& pdftron::PDF::DocumentConversion::operator= (const Do
 	return *this;
 }
 
+#ifdef PDFTRON_CPP11
+inline DocumentConversion::DocumentConversion(DocumentConversion&& other) noexcept : m_impl(other.m_impl), m_owner(other.m_owner)
+{
+	other.m_impl = 0;
+	other.m_owner = false;
+}
+
+inline DocumentConversion& DocumentConversion::operator=(DocumentConversion&& other) noexcept
+{
+	std::swap(m_impl, other.m_impl);
+	std::swap(m_owner, other.m_owner);
+	return *this;
+}
+#endif
+
 inline DocumentConversion::DocumentConversion()
 	: m_impl(0)
 	, m_owner(false)
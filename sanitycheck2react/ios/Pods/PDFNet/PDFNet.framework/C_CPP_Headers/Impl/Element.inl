@@ -21,7 +21,7 @@ inline Element::Type Element::GetType()
 
 inline GState Element::GetGState()
 {
-	TRN_GState result;
+	TRN_GState result = 0;
 	REX(TRN_ElementGetGState(mp_elem,&result));
 	return GState(result);
 }
@@ -34,7 +34,7 @@ inline Common::Matrix2D Element::GetCTM()
 inline Rect Element::GetBBox()
 {
 	Rect bbox;
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_ElementGetBBox(mp_elem,(TRN_Rect*)&bbox,&result));
 	return bbox;
 }
@@ -48,7 +48,7 @@ inline bool Element::GetBBox(Rect& out_bbox)
 
 inline Struct::SElement Element::GetParentStructElement()
 {
-	TRN_SElement result;
+	TRN_SElement result = TRN_SElement();
     REX(TRN_ElementGetParentStructElement(mp_elem,&result));
 	return Struct::SElement(result);
 }
@@ -91,22 +91,43 @@ inline bool Element::IsClipWindingFill()
 inline PathData Element::GetPathData() const
 {
 	PathData data;
-	char* arr;
-	int size;
-	TRN_ElementGetPathTypesCount(mp_elem, &size);
-	data.oprs.resize(size);
-	TRN_ElementGetPathTypes(mp_elem,(const char**)&arr);
-	memcpy(&data.oprs.front(), arr, size);
-	
-	int dataSize;
-	const double* arr2;
-	TRN_ElementGetPathPointCount(mp_elem, &dataSize);
-	data.pts.resize(dataSize);
-	REX(TRN_ElementGetPathPoints(mp_elem, &arr2));
-	memcpy(&data.pts.front(), arr2, dataSize * sizeof(double));
+	GetPathData(data);
 	return data;
 }
 
+inline void Element::GetPathData(PathData& out) const
+{
+	const char* arr = 0;
+	int size = 0;
+	REX(TRN_ElementGetPathTypesCount(mp_elem, &size));
+	REX(TRN_ElementGetPathTypes(mp_elem, &arr));
+	out.oprs.assign((const UChar*)arr, (const UChar*)arr + size);
+
+	const double* arr2 = 0;
+	int dataSize = 0;
+	REX(TRN_ElementGetPathPointCount(mp_elem, &dataSize));
+	REX(TRN_ElementGetPathPoints(mp_elem, &arr2));
+	out.pts.assign(arr2, arr2 + dataSize);
+	out.is_def = true;
+	out.glyph_index = 0;
+}
+
+#ifndef SWIG
+inline PathDataView Element::GetPathDataView() const
+{
+	const char* arr = 0;
+	int size = 0;
+	REX(TRN_ElementGetPathTypesCount(mp_elem, &size));
+	REX(TRN_ElementGetPathTypes(mp_elem, &arr));
+
+	const double* arr2 = 0;
+	int dataSize = 0;
+	REX(TRN_ElementGetPathPointCount(mp_elem, &dataSize));
+	REX(TRN_ElementGetPathPoints(mp_elem, &arr2));
+	return PathDataView((const UChar*)arr, size, arr2, dataSize);
+}
+#endif
+
 #ifdef SWIG
 inline void Element::SetPathData(const PathData& data)
 {
@@ -153,7 +174,7 @@ inline SDF::Obj Element::GetXObject()
 
 inline Filters::Filter Element::GetImageData() const
 {
-	TRN_Filter result;
+	TRN_Filter result = 0;
 	REX(TRN_ElementGetImageData(mp_elem,&result));
 	return Filters::Filter(result, true);
 }
@@ -166,7 +187,7 @@ inline int Element::GetImageDataSize() const
 #if defined(_WIN32)
 inline Gdiplus::Bitmap* Element::GetBitmap() const
 {
-	TRN_GDIPlusBitmap result;
+	TRN_GDIPlusBitmap result = 0;
 	REX(TRN_ElementGetBitmap(mp_elem,&result));
 	return (Gdiplus::Bitmap*) result;
 }
@@ -175,7 +196,7 @@ inline Gdiplus::Bitmap* Element::GetBitmap() const
 
 inline ColorSpace Element::GetImageColorSpace() const
 {
-	TRN_ColorSpace result;
+	TRN_ColorSpace result = 0;
 	REX(TRN_ElementGetImageColorSpace(mp_elem,&result));
 	return ColorSpace(result);
 }
@@ -229,7 +250,7 @@ inline GState::RenderingIntent Element::GetImageRenderingIntent() const
 
 inline UString Element::GetTextString()
 {
-	TRN_UString result;
+	TRN_UString result = 0;
 	REX(TRN_ElementGetTextString(mp_elem,&result));
 	return UString(result);	
 }
@@ -237,11 +258,11 @@ inline UString Element::GetTextString()
 #ifdef SWIG
 inline std::vector<unsigned char> Element::GetTextData()
 {
-	UInt32 size;
+	UInt32 size = 0;
 	REX(TRN_ElementGetTextDataSize(mp_elem,&size));
 	std::vector<unsigned char> result;
 	result.resize(size);
-	const UChar* arr;
+	const UChar* arr = 0;
 	REX(TRN_ElementGetTextData(mp_elem,&arr));
 	memcpy(&(result[0]), arr, size);
 	return result;
@@ -249,7 +270,7 @@ inline std::vector<unsigned char> Element::GetTextData()
 #else
 inline const UChar* Element::GetTextData()
 {
-	const UChar* result;
+	const UChar* result = 0;
 	REX(TRN_ElementGetTextData(mp_elem,&result));
 	return result;
 }
@@ -257,11 +278,31 @@ inline const UChar* Element::GetTextData()
 
 inline UInt32 Element::GetTextDataSize()
 {
-	UInt32 result;
+	UInt32 result = 0;
 	REX(TRN_ElementGetTextDataSize(mp_elem,&result));
 	return result;
 }
 
+inline void Element::GetTextData(std::vector<unsigned char>& out)
+{
+	UInt32 size = 0;
+	const UChar* arr = 0;
+	REX(TRN_ElementGetTextDataSize(mp_elem,&size));
+	REX(TRN_ElementGetTextData(mp_elem,&arr));
+	out.assign(arr, arr + size);
+}
+
+#ifndef SWIG
+inline ByteView Element::GetTextDataView()
+{
+	UInt32 size = 0;
+	const UChar* arr = 0;
+	REX(TRN_ElementGetTextDataSize(mp_elem,&size));
+	REX(TRN_ElementGetTextData(mp_elem,&arr));
+	return ByteView(arr, size);
+}
+#endif
+
 inline Common::Matrix2D Element::GetTextMatrix()
 {
 	RetMtx(TRN_ElementGetTextMatrix(mp_elem,&result));
@@ -269,11 +310,18 @@ inline Common::Matrix2D Element::GetTextMatrix()
 
 inline CharIterator Element::GetCharIterator()
 {
-	TRN_Iterator result;
+	TRN_Iterator result = 0;
 	REX(TRN_ElementGetCharIterator(mp_elem,&result));
 	return CharIterator(result);
 }
 
+#ifdef PDFTRON_CPP11
+inline CharRange Element::Chars()
+{
+	return CharRange(GetCharIterator());
+}
+#endif
+
 inline double Element::GetTextLength()
 {
 	RetDbl(TRN_ElementGetTextLength(mp_elem,&result));
@@ -335,7 +383,7 @@ inline void Element::SetNewTextLineOffset(double dx, double dy)
 
 inline Shading Element::GetShading()
 {
-	TRN_Shading result;
+	TRN_Shading result = 0;
 	REX(TRN_ElementGetShading(mp_elem,&result));
 	return Shading(result);
 }
@@ -1,5 +1,5 @@
 
-inline ElementBuilder::ElementBuilder() {
+inline ElementBuilder::ElementBuilder() : mp_builder(0) {
 	REX(TRN_ElementBuilderCreate(&mp_builder));
 }
 
@@ -7,6 +7,19 @@ inline ElementBuilder::~ElementBuilder() {
 	DREX(mp_builder, TRN_ElementBuilderDestroy(mp_builder));
 }
 
+#ifdef PDFTRON_CPP11
+inline ElementBuilder::ElementBuilder(ElementBuilder&& other) noexcept : mp_builder(other.mp_builder)
+{
+	other.mp_builder = 0;
+}
+
+inline ElementBuilder& ElementBuilder::operator=(ElementBuilder&& other) noexcept
+{
+	std::swap(mp_builder, other.mp_builder);
+	return *this;
+}
+#endif
+
 inline void ElementBuilder::Destroy()
 {
 	REX(TRN_ElementBuilderDestroy(mp_builder));
@@ -18,79 +31,79 @@ inline void ElementBuilder::Reset(GState gs) {
 }
 
 inline Element ElementBuilder::CreateImage(Image& img) {
-	TRN_Element result;
+	TRN_Element result = 0;
 	REX(TRN_ElementBuilderCreateImage(mp_builder,img.mp_image,&result));
 	return Element(result);
 }
 
 inline Element ElementBuilder::CreateImage(Image& img, const Common::Matrix2D& mtx) {
-	TRN_Element result;
+	TRN_Element result = 0;
 	REX(TRN_ElementBuilderCreateImageFromMatrix(mp_builder,img.mp_image,(const TRN_Matrix2D*)&mtx,&result));
 	return Element(result);
 }
 
 inline Element ElementBuilder::CreateImage(Image& img, double x, double y, double hscale, double vscale) {
-	TRN_Element result;
+	TRN_Element result = 0;
 	REX(TRN_ElementBuilderCreateImageScaled(mp_builder,img.mp_image,x,y,hscale,vscale,&result));
 	return Element(result);
 }
 
 inline Element ElementBuilder::CreateGroupBegin() {
-	TRN_Element result;
+	TRN_Element result = 0;
 	REX(TRN_ElementBuilderCreateGroupBegin(mp_builder,&result));
 	return Element(result);
 }
 
 inline Element ElementBuilder::CreateGroupEnd() {
-	TRN_Element result;
+	TRN_Element result = 0;
 	REX(TRN_ElementBuilderCreateGroupEnd(mp_builder,&result));
 	return Element(result);
 }
 
 inline Element ElementBuilder::CreateShading(Shading& sh) {
-	TRN_Element result;
+	TRN_Element result = 0;
 	REX(TRN_ElementBuilderCreateShading(mp_builder,sh.mp_shade,&result));
 	return Element(result);
 }
 
 inline Element ElementBuilder::CreateForm(SDF::Obj form) {
-	TRN_Element result;
+	TRN_Element result = 0;
 	REX(TRN_ElementBuilderCreateFormFromStream(mp_builder,form.mp_obj,&result));
 	return Element(result);
 }
 
 inline Element ElementBuilder::CreateForm(Page page) {
-	TRN_Element result;
+	TRN_Element result = 0;
 	REX(TRN_ElementBuilderCreateFormFromPage(mp_builder,page.mp_page,&result));
 	return Element(result);
 }
 
 inline Element ElementBuilder::CreateForm(Page page, class PDFDoc& doc) {
-	TRN_Element result;
+	TRN_Element result = 0;
 	REX(TRN_ElementBuilderCreateFormFromDoc(mp_builder,page.mp_page,doc.mp_doc,&result));
 	return Element(result);
 }
 
 inline Element ElementBuilder::CreateTextBegin(Font font, double font_sz) {
-	TRN_Element result;
+	TRN_Element result = 0;
 	REX(TRN_ElementBuilderCreateTextBeginWithFont(mp_builder,font.mp_font,font_sz,&result));
 	return Element(result);
 }
 
 inline Element ElementBuilder::CreateTextBegin() {
-	TRN_Element result;
+	TRN_Element result = 0;
 	REX(TRN_ElementBuilderCreateTextBegin(mp_builder,&result));
 	return Element(result);
 }
 
 inline Element ElementBuilder::CreateTextEnd() {
-	TRN_Element result;
+	TRN_Element result = 0;
 	REX(TRN_ElementBuilderCreateTextEnd(mp_builder,&result));
 	return Element(result);
 }
 
 inline Element ElementBuilder::CreateTextRun(const char* text_data, Font font, double font_sz) {
-	TRN_Element result;
+	TRN_Element result = 0;
 	REX(TRN_ElementBuilderCreateTextRun(mp_builder,text_data,
 		font.mp_font,font_sz,&result));
 	return Element(result);
@@ -98,13 +111,13 @@ inline Element ElementBuilder::CreateTextRun(const char* text_data, Font font, d
 
 #ifndef SWIG
 inline Element ElementBuilder::CreateTextRun(const char* text_data, UInt32 text_data_sz, Font font, double font_sz) {
-	TRN_Element result;
+	TRN_Element result = 0;
 	REX(TRN_ElementBuilderCreateTextRunWithSize(mp_builder,text_data,text_data_sz,font.mp_font,font_sz,&result));
 	return Element(result);
 }
 
 inline Element ElementBuilder::CreateTextRun(const UChar* text_data, UInt32 text_data_sz, Font font, double font_sz) {
-	TRN_Element result;
+	TRN_Element result = 0;
 	TRN_String text_dataString = { (const char*) text_data, (unsigned int) text_data_sz };
 	REX(TRN_ElementBuilderCreateTextRunUnsigned(mp_builder,
 		text_dataString, font.mp_font, font_sz, &result));
@@ -113,20 +126,20 @@ inline Element ElementBuilder::CreateTextRun(const UChar* text_data, UInt32 text
 #endif
 
 inline Element ElementBuilder::CreateTextRun(const char* text_data) {
-	TRN_Element result;
+	TRN_Element result = 0;
 	REX(TRN_ElementBuilderCreateNewTextRun(mp_builder,text_data,&result));
 	return Element(result);
 }
 
 #ifndef SWIG
 inline Element ElementBuilder::CreateTextRun(const char* text_data, UInt32 text_data_sz) {
-	TRN_Element result;
+	TRN_Element result = 0;
 	REX(TRN_ElementBuilderCreateNewTextRunWithSize(mp_builder,text_data,text_data_sz,&result));
 	return Element(result);
 }
 
 inline Element ElementBuilder::CreateTextRun(const UChar* text_data, UInt32 text_data_sz) {
-	TRN_Element result;
+	TRN_Element result = 0;
 	TRN_String text_dataString = { (const char*) text_data, (unsigned int) text_data_sz };
 	REX(TRN_ElementBuilderCreateNewTextRunUnsigned(mp_builder, text_dataString, &result));
 	return Element(result);
@@ -134,45 +147,45 @@ inline Element ElementBuilder::CreateTextRun(const UChar* text_data, UInt32 text
 #endif
 
 inline Element ElementBuilder::CreateUnicodeTextRun(const Unicode* text_data, UInt32 text_data_sz) {
-	TRN_Element result;
+	TRN_Element result = 0;
 	REX(TRN_ElementBuilderCreateUnicodeTextRun(mp_builder,text_data,text_data_sz,&result));
 	return Element(result);
 }
 
 inline Element ElementBuilder::CreateTextNewLine(double dx, double dy) {
-	TRN_Element result;
+	TRN_Element result = 0;
 	REX(TRN_ElementBuilderCreateTextNewLineWithOffset(mp_builder,dx,dy,&result));
 	return Element(result);
 }
 
 inline Element ElementBuilder::CreateTextNewLine() {
-	TRN_Element result;
+	TRN_Element result = 0;
 	REX(TRN_ElementBuilderCreateTextNewLine(mp_builder,&result));
 	return Element(result);
 }
 
 inline Element ElementBuilder::CreatePath(const std::vector<double>& points, const std::vector<unsigned char>& seg_types) {
-	TRN_Element result;
+	TRN_Element result = 0;
 	REX(TRN_ElementBuilderCreatePath(mp_builder,&(points[0]),static_cast<int>(points.size()),(const char*)&(seg_types[0]),static_cast<int>(seg_types.size()),&result));
 	return Element(result);
 }
 
 #ifndef SWIG
 inline Element ElementBuilder::CreatePath(const double* points, int point_count, const char* seg_types, int seg_types_count) {
-	TRN_Element result;
+	TRN_Element result = 0;
 	REX(TRN_ElementBuilderCreatePath(mp_builder,points,point_count,seg_types,seg_types_count,&result));
 	return Element(result);
 }
 #endif
 
 inline Element ElementBuilder::CreateRect(double x, double y, double width, double height) {
-	TRN_Element result;
+	TRN_Element result = 0;
 	REX(TRN_ElementBuilderCreateRect(mp_builder,x,y,width,height,&result));
 	return Element(result);
 }
 
 inline Element ElementBuilder::CreateEllipse(double cx, double cy, double rx, double ry) {
-	TRN_Element result;
+	TRN_Element result = 0;
 	REX(TRN_ElementBuilderCreateEllipse(mp_builder,cx,cy,rx,ry,&result));
 	return Element(result);
 }
@@ -182,7 +195,7 @@ inline void ElementBuilder::PathBegin() {
 }
 
 inline Element ElementBuilder::PathEnd() {
-	TRN_Element result;
+	TRN_Element result = 0;
 	REX(TRN_ElementBuilderPathEnd(mp_builder,&result));
 	return Element(result);
 }
@@ -1,5 +1,5 @@
 
-inline ElementReader::ElementReader()
+inline ElementReader::ElementReader() : mp_reader(0)
 {
 	REX(TRN_ElementReaderCreate(&mp_reader));
 }
@@ -9,6 +9,19 @@ inline ElementReader::~ElementReader()
 	DREX(mp_reader, TRN_ElementReaderDestroy(mp_reader));
 }
 
+#ifdef PDFTRON_CPP11
+inline ElementReader::ElementReader(ElementReader&& other) noexcept : mp_reader(other.mp_reader)
+{
+	other.mp_reader = 0;
+}
+
+inline ElementReader& ElementReader::operator=(ElementReader&& other) noexcept
+{
+	std::swap(mp_reader, other.mp_reader);
+	return *this;
+}
+#endif
+
 inline void ElementReader::Destroy()
 {
 	REX(TRN_ElementReaderDestroy(mp_reader));
@@ -35,14 +48,14 @@ inline void ElementReader::AppendResource(SDF::Obj res)
 
 inline Element ElementReader::Next()
 {
-	TRN_Element result;
+	TRN_Element result = 0;
 	REX(TRN_ElementReaderNext(mp_reader,&result));
 	return Element(result);
 }
 
 inline Element ElementReader::Current()
 {
-	TRN_Element result;
+	TRN_Element result = 0;
 	REX(TRN_ElementReaderCurrent(mp_reader,&result));
 	return Element(result);
 }
@@ -69,17 +82,34 @@ inline bool ElementReader::End()
 
 inline GSChangesIterator ElementReader::GetChangesIterator()
 {
-	TRN_Iterator result;
+	TRN_Iterator result = 0;
 	REX(TRN_ElementReaderGetChangesIterator(mp_reader,&result));
 	return Common::Iterator<int>(result);
 }
 
+#ifdef PDFTRON_CPP11
+inline GSChangesRange ElementReader::Changes()
+{
+	return GSChangesRange(GetChangesIterator());
+}
+#endif
+
 inline bool ElementReader::IsChanged(GState::GStateAttribute attrib)
 {
 	RetBool(TRN_ElementReaderIsChanged(mp_reader,
 		(enum TRN_GStateAttribute)attrib,&result));
 }
 
+inline UInt64 ElementReader::GetChangeMask()
+{
+	UInt64 changes = 0;
+	for (GSChangesIterator itr = GetChangesIterator(); itr.HasNext(); itr.Next()) {
+		int attr = itr.Current();
+		if (attr >= 0 && attr < GState::e_null) changes |= GState::AttributeBit((GState::GStateAttribute)attr);
+	}
+	return changes;
+}
+
 inline void ElementReader::ClearChangeList()
 {
 	REX(TRN_ElementReaderClearChangeList(mp_reader));
@@ -1,5 +1,5 @@
 
-inline ElementWriter::ElementWriter()
+inline ElementWriter::ElementWriter() : mp_writer(0)
 {
 	REX(TRN_ElementWriterCreate(&mp_writer));
 }
@@ -9,6 +9,19 @@ inline ElementWriter::~ElementWriter()
 	DREX(mp_writer, TRN_ElementWriterDestroy(mp_writer));
 }
 
+#ifdef PDFTRON_CPP11
+inline ElementWriter::ElementWriter(ElementWriter&& other) noexcept : mp_writer(other.mp_writer)
+{
+	other.mp_writer = 0;
+}
+
+inline ElementWriter& ElementWriter::operator=(ElementWriter&& other) noexcept
+{
+	std::swap(mp_writer, other.mp_writer);
+	return *this;
+}
+#endif
+
 inline void ElementWriter::Destroy()
 {
 	REX(TRN_ElementWriterDestroy(mp_writer));
@@ -33,7 +46,7 @@ inline void ElementWriter::Begin(SDF::SDFDoc& doc, bool compress)
 
 inline SDF::Obj ElementWriter::End()
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ElementWriterEnd(mp_writer,&result));
 	return SDF::Obj(result);
 }
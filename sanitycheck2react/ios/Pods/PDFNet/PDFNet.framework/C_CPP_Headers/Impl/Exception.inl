@@ -55,8 +55,70 @@ inline std::ostream& Exception::Print(std::ostream& stream)
 	return stream << ToString();
 }
 
+#ifdef PDFTRON_NO_EXCEPTIONS
+#if defined(PDFTRON_CPP11)
+#define PDFTRON_THREAD_LOCAL thread_local
+#elif defined(_MSC_VER)
+#define PDFTRON_THREAD_LOCAL __declspec(thread)
+#else
+#define PDFTRON_THREAD_LOCAL __thread
+#endif
+
+inline TRN_Exception& LastExceptionSlot()
+{
+	static PDFTRON_THREAD_LOCAL TRN_Exception last = 0;
+	return last;
+}
+
+inline ErrorHandler& ErrorHandlerSlot()
+{
+	static ErrorHandler handler = 0;
+	return handler;
+}
+
+inline void SetErrorHandler(ErrorHandler handler)
+{
+	ErrorHandlerSlot() = handler;
+}
+
+inline bool HasError()
+{
+	return LastExceptionSlot() != 0;
+}
+
+inline Exception GetLastException()
+{
+	return Exception(LastExceptionSlot());
+}
+
+inline void ClearLastException()
+{
+	LastExceptionSlot() = 0;
+}
+
+inline void ReportError(const Exception& e)
+{
+	LastExceptionSlot() = e.e;
+	ErrorHandler handler = ErrorHandlerSlot();
+	if (handler) {
+		Exception copy(e);
+		handler(copy);
+	}
+}
+
+// Returns the calling thread's last error and clears it. Used to pass errors
+// recorded on worker threads on to the thread that started them.
+inline TRN_Exception TakeLastException()
+{
+	TRN_Exception e = LastExceptionSlot();
+	LastExceptionSlot() = 0;
+	return e;
+}
+#endif
+
 /**
- * Runtime assertion macro 
+ * Runtime assertion macro. The _RET variants also leave the calling function
+ * (with the given value) when errors are not thrown.
  */
 #ifdef _WIN32	
 	#if (_MSC_VER < 1300)
@@ -66,14 +128,18 @@ inline std::ostream& Exception::Print(std::ostream& stream)
 #endif	
 
 #ifdef PDFNET_USE_NO_FUNCTION_MACRO	
-	#define BASE_ASSERT(condition, msg)	if (!(condition)) throw Common::Exception((#condition), __LINE__, __FILE__, "",	msg)
-	#define BASE_ASSERTEX(condition, msg,er)	if (!(condition)) throw Common::Exception((#condition), __LINE__, __FILE__, "",	msg, er)
-	#define BASE_ASSERT2(condition, derived,  msg) if (!(condition)) throw derived((#condition), __LINE__, __FILE__, "", msg)
+	#define BASE_ASSERT(condition, msg)	if (!(condition)) PDFTRON_THROW(Common::Exception((#condition), __LINE__, __FILE__, "",	msg))
+	#define BASE_ASSERTEX(condition, msg,er)	if (!(condition)) PDFTRON_THROW(Common::Exception((#condition), __LINE__, __FILE__, "",	msg, er))
+	#define BASE_ASSERT2(condition, derived,  msg) if (!(condition)) PDFTRON_THROW(derived((#condition), __LINE__, __FILE__, "", msg))
+	#define BASE_ASSERT_RET(condition, msg, value) if (!(condition)) { PDFTRON_THROW(Common::Exception((#condition), __LINE__, __FILE__, "", msg)); return value; }
+	#define BASE_ASSERT_RET_VOID(condition, msg) if (!(condition)) { PDFTRON_THROW(Common::Exception((#condition), __LINE__, __FILE__, "", msg)); return; }
 	#define BASE_WARNING(condition, msg) if (!(condition)) Common::ReportWarning((#condition), __LINE__, __FILE__, "", msg)
 #else
-	#define BASE_ASSERT(condition, msg) if (!(condition)) throw Common::Exception((#condition), __LINE__, __FILE__, __FUNCTION__, msg)
-	#define BASE_ASSERTEX(condition, msg, er) if (!(condition)) throw Common::Exception((#condition), __LINE__, __FILE__, __FUNCTION__, msg, er)
-	#define BASE_ASSERT2(condition, derived, msg) if (!(condition)) throw derived((#condition), __LINE__, __FILE__, __FUNCTION__, msg)
+	#define BASE_ASSERT(condition, msg) if (!(condition)) PDFTRON_THROW(Common::Exception((#condition), __LINE__, __FILE__, __FUNCTION__, msg))
+	#define BASE_ASSERTEX(condition, msg, er) if (!(condition)) PDFTRON_THROW(Common::Exception((#condition), __LINE__, __FILE__, __FUNCTION__, msg, er))
+	#define BASE_ASSERT2(condition, derived, msg) if (!(condition)) PDFTRON_THROW(derived((#condition), __LINE__, __FILE__, __FUNCTION__, msg))
+	#define BASE_ASSERT_RET(condition, msg, value) if (!(condition)) { PDFTRON_THROW(Common::Exception((#condition), __LINE__, __FILE__, __FUNCTION__, msg)); return value; }
+	#define BASE_ASSERT_RET_VOID(condition, msg) if (!(condition)) { PDFTRON_THROW(Common::Exception((#condition), __LINE__, __FILE__, __FUNCTION__, msg)); return; }
 	#define BASE_WARNING(condition, msg) if (!(condition)) Common::ReportWarning((#condition), __LINE__, __FILE__, __FUNCTION__, msg)
 #endif
 
@@ -36,6 +36,21 @@ inline ExternalAnnotManager& pdftron::PDF::ExternalAnnotManager::operator= (cons
 	return *this;
 }
 
+#ifdef PDFTRON_CPP11
+inline ExternalAnnotManager::ExternalAnnotManager(ExternalAnnotManager&& other) noexcept : m_impl(other.m_impl), m_owner(other.m_owner)
+{
+	other.m_impl = 0;
+	other.m_owner = false;
+}
+
+inline ExternalAnnotManager& ExternalAnnotManager::operator=(ExternalAnnotManager&& other) noexcept
+{
+	std::swap(m_impl, other.m_impl);
+	std::swap(m_owner, other.m_owner);
+	return *this;
+}
+#endif
+
 inline ExternalAnnotManager::ExternalAnnotManager()
 	: m_impl(0)
 	, m_owner(false)
@@ -1,5 +1,5 @@
 
-inline FDFDoc::FDFDoc(TRN_FDFDoc impl, bool owner)
+inline FDFDoc::FDFDoc(TRN_FDFDoc impl, bool owner) : mp_doc(0)
 {
 	if (impl) {
 		mp_doc = impl;
@@ -10,27 +10,27 @@ inline FDFDoc::FDFDoc(TRN_FDFDoc impl, bool owner)
 	m_owner = owner;
 }
 
-inline FDFDoc::FDFDoc(SDF::SDFDoc& sdfdoc) : m_owner(true) {
+inline FDFDoc::FDFDoc(SDF::SDFDoc& sdfdoc) : mp_doc(0), m_owner(true) {
 	REX(TRN_FDFDocCreateFromSDFDoc(sdfdoc.mp_doc,&mp_doc));
 	sdfdoc.mp_doc=0;
 }
 
-inline FDFDoc::FDFDoc (const char* filepath) : m_owner(true) {
+inline FDFDoc::FDFDoc (const char* filepath) : mp_doc(0), m_owner(true) {
 	REX(TRN_FDFDocCreateFromFilePath(filepath,&mp_doc));
 }
 
-inline FDFDoc::FDFDoc (const UString& filepath) : m_owner(true) {
+inline FDFDoc::FDFDoc (const UString& filepath) : mp_doc(0), m_owner(true) {
 	REX(TRN_FDFDocCreateFromUFilePath(filepath.mp_impl,&mp_doc));
 }
 
-inline FDFDoc::FDFDoc (Filters::Filter stream) : m_owner(true) {
+inline FDFDoc::FDFDoc (Filters::Filter stream) : mp_doc(0), m_owner(true) {
 	stream.m_owner = false;
 	REX(TRN_FDFDocCreateFromStream(stream.m_impl,&mp_doc));
 	// Note: FDFDoc takes the ownership of the stream
 	stream.m_impl = 0; 
 }
 
-inline FDFDoc::FDFDoc (const char* buf, size_t buf_size) : m_owner(true) {
+inline FDFDoc::FDFDoc (const char* buf, size_t buf_size) : mp_doc(0), m_owner(true) {
 	REX(TRN_FDFDocCreateFromMemoryBuffer(buf,buf_size,&mp_doc));
 }
 
@@ -66,6 +66,21 @@ inline FDFDoc& FDFDoc::operator =(const FDFDoc& other)
 	return *this;
 }
 
+#ifdef PDFTRON_CPP11
+inline FDFDoc::FDFDoc(FDFDoc&& other) noexcept : mp_doc(other.mp_doc), m_owner(other.m_owner)
+{
+	other.mp_doc = 0;
+	other.m_owner = false;
+}
+
+inline FDFDoc& FDFDoc::operator=(FDFDoc&& other) noexcept
+{
+	std::swap(mp_doc, other.mp_doc);
+	std::swap(m_owner, other.m_owner);
+	return *this;
+}
+#endif
+
 inline FDFDoc::~FDFDoc () {
 	if(m_owner) { 
 		DREX(mp_doc, TRN_FDFDocDestroy(mp_doc));
@@ -88,8 +103,8 @@ inline void FDFDoc::Save(const UString& path) {
 }
 
 inline std::vector<unsigned char> FDFDoc::Save() {
-	size_t size;
-	char* buf;
+	size_t size = 0;
+	char* buf = 0;
 	std::vector<unsigned char> result;
 	REX(TRN_FDFDocSaveMemoryBuffer(mp_doc,(const char**)&buf,&size));
 	result.resize(size);
@@ -132,14 +147,14 @@ inline void FDFDoc::SetID(SDF::Obj id) {
 }
 
 inline FDFFieldIterator FDFDoc::GetFieldIterator() {
-	TRN_Iterator result;
+	TRN_Iterator result = 0;
 	REX(TRN_FDFDocGetFieldIteratorBegin(mp_doc,&result));
 	return Common::Iterator<FDFField>(result);
 }
 
 inline FDFFieldIterator FDFDoc::GetFieldIterator(const UString& field_name)
 {
-	TRN_Iterator result;
+	TRN_Iterator result = 0;
 	REX(TRN_FDFDocGetFieldIterator(mp_doc, field_name.mp_impl,&result));
 	return Common::Iterator<FDFField>(result);
 }
@@ -164,7 +179,7 @@ inline SDF::SDFDoc& FDFDoc::GetSDFDoc() {
 }
 
 inline FDFDoc FDFDoc::CreateFromXFDF (const UString& filepath) {
-	TRN_FDFDoc doc;
+	TRN_FDFDoc doc = 0;
 	REX(TRN_FDFDocCreateFromXFDF(filepath.mp_impl, &doc));
 	return FDFDoc(doc);
 }
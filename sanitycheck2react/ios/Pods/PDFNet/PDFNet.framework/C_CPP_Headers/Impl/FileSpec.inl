@@ -9,24 +9,24 @@ inline FileSpec::FileSpec() : mp_impl(0)
 
 inline FileSpec FileSpec::Create(SDF::SDFDoc& doc, const UString& path, bool embed)
 {
-	TRN_FileSpec result;
+	TRN_FileSpec result = 0;
 	REX(TRN_FileSpecCreate(doc.mp_doc,path.mp_impl,BToTB(embed),&result));
 	return FileSpec(result);
 }
 
 inline FileSpec FileSpec::CreateURL(SDF::SDFDoc& doc, const char* url)
 {
-	TRN_FileSpec result;
+	TRN_FileSpec result = 0;
 	REX(TRN_FileSpecCreateURL(doc.mp_doc,url,&result));
 	return FileSpec(result);
 }
 
-inline FileSpec::FileSpec(SDF::Obj f)
+inline FileSpec::FileSpec(SDF::Obj f) : mp_impl(0)
 {
 	REX(TRN_FileSpecCreateFromObj(f.mp_obj,&mp_impl))
 }
 
-inline FileSpec::FileSpec (const FileSpec& d)
+inline FileSpec::FileSpec (const FileSpec& d) : mp_impl(0)
 {
 	REX(TRN_FileSpecCopy(d.mp_impl,&mp_impl));
 }
@@ -39,28 +39,28 @@ inline FileSpec& FileSpec::operator=(const FileSpec& d)
 
 inline bool FileSpec::operator==(const FileSpec& d)
 {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_FileSpecCompare(mp_impl,d.mp_impl,&result));
 	return TBToB(result);
 }
 
 inline bool FileSpec::IsValid() const
 {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_FileSpecIsValid(mp_impl,&result));
 	return TBToB(result);
 }
 
 inline bool FileSpec::Export(const UString& save_as) const
 {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_FileSpecExport(mp_impl,save_as.mp_impl,&result));
 	return TBToB(result);
 }
 
 inline Filters::Filter FileSpec::GetFileData() const
 {
-	TRN_Filter result;
+	TRN_Filter result = 0;
 	REX(TRN_FileSpecGetFileData(mp_impl,&result));
 	return Filters::Filter(result, true);
 }
@@ -79,7 +79,7 @@ inline void FileSpec::SetDesc(const UString& desc)
 
 inline SDF::Obj FileSpec::GetSDFObj () const
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_FileSpecGetSDFObj(mp_impl,&result));
 	return SDF::Obj(result);
 }
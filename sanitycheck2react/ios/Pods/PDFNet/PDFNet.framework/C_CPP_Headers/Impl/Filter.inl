@@ -38,6 +38,21 @@ inline Filter& Filter::operator =(const Filter& other)
 	return *this;
 }
 
+#ifdef PDFTRON_CPP11
+inline Filter::Filter(Filter&& other) noexcept : m_impl(other.m_impl), m_owner(other.m_owner)
+{
+	other.m_impl = 0;
+	other.m_owner = false;
+}
+
+inline Filter& Filter::operator=(Filter&& other) noexcept
+{
+	std::swap(m_impl, other.m_impl);
+	std::swap(m_owner, other.m_owner);
+	return *this;
+}
+#endif
+
 inline Filter::~Filter () 
 {
 	if(m_owner) {
@@ -58,45 +73,45 @@ inline void Filter::AttachFilter(Filter attach_filter) {
 }
 
 inline Filter Filter::ReleaseAttachedFilter () {
-	TRN_Filter result;
+	TRN_Filter result = 0;
 	REX(TRN_FilterReleaseAttachedFilter(m_impl,&result));
 	return Filter(result,true);
 }
 
 inline Filter Filter::GetAttachedFilter () {
-	TRN_Filter result;
+	TRN_Filter result = 0;
 	REX(TRN_FilterGetAttachedFilter(m_impl,&result));
 	return Filter(result, false);
 }
 
 inline Filter Filter::GetSourceFilter () {
-	TRN_Filter result;
+	TRN_Filter result = 0;
 	REX(TRN_FilterGetSourceFilter(m_impl,&result));
 	return Filter(result, false);
 }
 
 inline const char* Filter::GetName () const {
-	const char* result;
+	const char* result = 0;
 	REX(TRN_FilterGetName(m_impl,&result));
 	return result;
 }
 
 inline const char* Filter::GetDecodeName () const { 
-	const char* result;
+	const char* result = 0;
 	REX(TRN_FilterGetDecodeName(m_impl,&result));
 	return result;
 }
 
 #ifndef SWIG
 inline UChar* Filter::Begin () {
-	TRN_UChar* result;
+	TRN_UChar* result = 0;
 	REX(TRN_FilterBegin(m_impl,&result));
 	return (UChar*)result;
 }
 #endif
 
 inline size_t Filter::Size () {
-	size_t result;
+	size_t result = 0;
 	REX(TRN_FilterSize(m_impl,&result));
 	return result;
 }
@@ -106,13 +121,13 @@ inline void Filter::Consume (size_t num_bytes) {
 }
 
 inline size_t Filter::Count () {
-	size_t result;
+	size_t result = 0;
 	REX(TRN_FilterCount(m_impl,&result));
 	return result;
 }
 
 inline size_t Filter::SetCount (size_t new_count) {
-	size_t result;
+	size_t result = 0;
 	REX(TRN_FilterSetCount(m_impl,new_count,&result));
 	return result;
 }
@@ -130,13 +145,13 @@ inline void Filter::FlushAll () {
 }
 
 inline bool Filter::IsInputFilter () {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_FilterIsInputFilter(m_impl,&result));
 	return TBToB(result);
 }
 
 inline bool Filter::CanSeek () {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_FilterCanSeek(m_impl,&result));
 	return TBToB(result);
 }
@@ -146,19 +161,19 @@ inline void Filter::Seek (ptrdiff_t offset, ReferencePos origin) {
 }
 
 inline ptrdiff_t Filter::Tell () {
-	ptrdiff_t result;
+	ptrdiff_t result = 0;
 	REX(TRN_FilterTell(m_impl,&result));
 	return result;
 }
 
 inline Filter Filter::CreateInputIterator () {
-	TRN_Filter result;
+	TRN_Filter result = 0;
 	REX(TRN_FilterCreateInputIterator(m_impl,&result));
 	return Filter(result,true);
 }
 
 inline const UString Filter::GetFilePath() const {
-	TRN_UString result;
+	TRN_UString result = 0;
 	REX(TRN_FilterGetFilePath(m_impl,&result));
 	UString temp;
 	temp.mp_impl=result;
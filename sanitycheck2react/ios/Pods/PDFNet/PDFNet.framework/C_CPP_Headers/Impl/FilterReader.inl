@@ -1,10 +1,10 @@
 
-inline FilterReader::FilterReader() 
+inline FilterReader::FilterReader() : m_impl(0) 
 {
 	REX(TRN_FilterReaderCreate(0, &m_impl));
 }
 
-inline FilterReader::FilterReader (Filter& filter)
+inline FilterReader::FilterReader (Filter& filter) : m_impl(0)
 {
 	REX(TRN_FilterReaderCreate(filter.m_impl, &m_impl));
 }
@@ -16,21 +16,21 @@ inline FilterReader::~FilterReader ()
 
 inline int FilterReader::Get()
 {
-	int result;
+	int result = 0;
 	REX(TRN_FilterReaderGet(m_impl,&result));
 	return result;
 }
 
 inline int FilterReader::Peek()
 {
-	int result;
+	int result = 0;
 	REX(TRN_FilterReaderPeek(m_impl,&result));
 	return result;
 }
 
 inline std::vector<unsigned char> FilterReader::Read(size_t buf_size)
 {
-	size_t size;
+	size_t size = 0;
 	std::vector<unsigned char> result;
 	result.resize(buf_size);
 	REX(TRN_FilterReaderRead(m_impl, &result[0], buf_size, &size));
@@ -41,7 +41,7 @@ inline std::vector<unsigned char> FilterReader::Read(size_t buf_size)
 #ifndef SWIG
 inline size_t FilterReader::Read(UChar* buf, size_t buf_size)
 {
-	size_t result;
+	size_t result = 0;
 	REX(TRN_FilterReaderRead(m_impl,buf,buf_size,&result));
 	return result;
 }
@@ -54,7 +54,7 @@ inline void FilterReader::AttachFilter(Filter& filter)
 
 inline Filter FilterReader::GetAttachedFilter()
 {
-	TRN_Filter result;
+	TRN_Filter result = 0;
 	REX(TRN_FilterReaderGetAttachedFilter(m_impl, &result));
 	return Filter(result,false);
 }
@@ -66,14 +66,14 @@ inline void FilterReader::Seek(ptrdiff_t offset, Filter::ReferencePos origin)
 
 inline ptrdiff_t FilterReader::Tell ()
 {
-	ptrdiff_t result;
+	ptrdiff_t result = 0;
 	REX(TRN_FilterReaderTell(m_impl,&result));
 	return result;
 }
 
 inline size_t FilterReader::Count ()
 {
-	size_t result;
+	size_t result = 0;
 	REX(TRN_FilterReaderCount(m_impl, &result));
 	return result;
 }
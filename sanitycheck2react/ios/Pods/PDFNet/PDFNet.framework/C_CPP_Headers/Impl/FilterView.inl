@@ -0,0 +1,53 @@
+inline FilterView::FilterView(Filter filter) : m_filter(filter), m_pending(0), m_count(0) {}
+
+inline ByteView FilterView::Next()
+{
+	ByteView window = Peek();
+	m_pending = window.Size();
+	m_count += m_pending;
+	return window;
+}
+
+inline ByteView FilterView::Peek()
+{
+	ConsumePending();
+	size_t size = m_filter.Size();
+	if (size == 0) return ByteView();
+	return ByteView(m_filter.Begin(), size);
+}
+
+inline void FilterView::Consume(size_t num_bytes)
+{
+	ConsumePending();
+	m_filter.Consume(num_bytes);
+	m_count += num_bytes;
+}
+
+inline size_t FilterView::ReadAll(std::vector<unsigned char>& out)
+{
+	size_t total = 0;
+	for (ByteView window = Next(); !window.Empty(); window = Next()) {
+		window.AppendTo(out);
+		total += window.Size();
+	}
+	return total;
+}
+
+inline size_t FilterView::GetCount() const
+{
+	return m_count;
+}
+
+inline Filter& FilterView::GetFilter()
+{
+	ConsumePending();
+	return m_filter;
+}
+
+inline void FilterView::ConsumePending()
+{
+	if (m_pending) {
+		m_filter.Consume(m_pending);
+		m_pending = 0;
+	}
+}
@@ -1,10 +1,10 @@
 
-inline FilterWriter::FilterWriter ()
+inline FilterWriter::FilterWriter () : m_impl(0)
 {
 	REX(TRN_FilterWriterCreate(0, &m_impl));
 }
 
-inline FilterWriter::FilterWriter (Filter& filter)
+inline FilterWriter::FilterWriter (Filter& filter) : m_impl(0)
 {
 	REX(TRN_FilterWriterCreate(filter.m_impl, &m_impl));
 }
@@ -71,7 +71,7 @@ inline void FilterWriter::WriteLine(const char* line, char eol)
 
 inline size_t FilterWriter::WriteBuffer(std::vector<unsigned char> buf)
 {
-	size_t result;
+	size_t result = 0;
 	REX(TRN_FilterWriterWriteBuffer(m_impl,(const char*)&(buf[0]),buf.size(),&result));
 	return result;
 }
@@ -79,7 +79,7 @@ inline size_t FilterWriter::WriteBuffer(std::vector<unsigned char> buf)
 #ifndef SWIG
 inline size_t FilterWriter::WriteBuffer(const char* buf, size_t buf_size)
 {
-	size_t result;
+	size_t result = 0;
 	REX(TRN_FilterWriterWriteBuffer(m_impl,buf,buf_size,&result));
 	return result;
 }
@@ -92,7 +92,7 @@ inline void FilterWriter::AttachFilter(Filter& filter)
 
 inline Filter FilterWriter::GetAttachedFilter()
 {
-	TRN_Filter result;
+	TRN_Filter result = 0;
 	REX(TRN_FilterWriterGetAttachedFilter(m_impl,&result));
 	return Filter(result,false);
 }
@@ -104,14 +104,14 @@ inline void FilterWriter::Seek(ptrdiff_t offset, Filter::ReferencePos origin)
 
 inline ptrdiff_t FilterWriter::Tell ()
 {
-	ptrdiff_t result;
+	ptrdiff_t result = 0;
 	REX(TRN_FilterWriterTell(m_impl,&result));
 	return result;
 }
 
 inline size_t FilterWriter::Count ()
 {
-	size_t result;
+	size_t result = 0;
 	REX(TRN_FilterWriterCount(m_impl,&result));
 	return result;
 }
@@ -1,4 +1,4 @@
-inline Flattener::Flattener()
+inline Flattener::Flattener() : mp_impl(0)
 {
 	REX(TRN_FlattenerCreate(&mp_impl));
 }
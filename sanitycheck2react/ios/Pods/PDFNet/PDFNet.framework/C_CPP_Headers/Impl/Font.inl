@@ -1,5 +1,5 @@
 
-inline Font::Font (SDF::Obj font_dict)
+inline Font::Font (SDF::Obj font_dict) : mp_font(0)
 {
 	REX(TRN_FontCreateFromObj(font_dict.mp_obj,&mp_font));
 }
@@ -71,18 +71,40 @@ inline Font Font::CreateType1Font(SDF::SDFDoc& doc, const UString& font_path, bo
 	RetFont(TRN_FontCreateType1Font(doc.mp_doc,font_path.mp_impl,BToTB(embed),&result));
 }
 
-inline Font::Font(const Font& c)
+inline Font::Font(const Font& c) : mp_font(0)
 {
+	if (!c.mp_font) return;	// a copy of a moved-from font is null
 	REX(TRN_FontCreateFromObj(0,&mp_font));
 	REX(TRN_FontAssign(mp_font,c.mp_font));
 }
 
 inline Font& Font::operator=(const Font& c)
 {
+	if (!c.mp_font) {
+		DREX(mp_font, TRN_FontDestroy(mp_font));
+		return *this;
+	}
+	if (!mp_font) {
+		// moved-from target
+		REX(TRN_FontCreateFromObj(0,&mp_font));
+	}
 	REX(TRN_FontAssign(mp_font,c.mp_font));
 	return *this;
 }
 
+#ifdef PDFTRON_CPP11
+inline Font::Font(Font&& other) noexcept : mp_font(other.mp_font)
+{
+	other.mp_font = 0;
+}
+
+inline Font& Font::operator=(Font&& other) noexcept
+{
+	std::swap(mp_font, other.mp_font);
+	return *this;
+}
+#endif
+
 inline Font::Type Font::GetType()
 {
 	enum TRN_FontType result;
@@ -176,7 +198,7 @@ inline double Font::GetMissingWidth()
 
 inline Common::Iterator<UInt32> Font::GetCharCodeIterator()
 {
-	TRN_Iterator result;
+	TRN_Iterator result = 0;
 	REX(TRN_FontGetCharCodeIterator(mp_font,&result));
 	return Common::Iterator<UInt32>(result);
 }
@@ -185,11 +207,11 @@ inline PathData Font::GetGlyphPath(UInt32 char_code,
 					bool conics2cubics, 
 					Common::Matrix2D* transform)
 {
-	TRN_Bool result0;
+	TRN_Bool result0 = 0;
 	int oprs_sz,data_sz, glyph_idx;
 	REX(TRN_FontGetGlyphPath(mp_font, char_code, 0, &oprs_sz, 0, &data_sz,
 		&glyph_idx, BToTB(conics2cubics),(TRN_Matrix2D*)transform, &result0));
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	std::vector<unsigned char> out_oprs;
 	std::vector<double> out_data;
 	if (result0 && oprs_sz>0 && data_sz>0) {
@@ -229,7 +251,7 @@ inline bool Font::MapToUnicode(UInt32 char_code,
 #ifndef SWIG
 inline const char** Font::GetEncoding()
 {
-	const char** result;
+	const char** result = 0;
 	REX(TRN_FontGetEncoding(mp_font,&result));
 	return result;
 }
@@ -257,7 +279,7 @@ inline int Font::GetEmbeddedFontBufSize()
 
 inline UInt16 Font::GetUnitsPerEm()
 {
-	UInt16 result;
+	UInt16 result = 0;
 	REX(TRN_FontGetUnitsPerEm(mp_font, &result));
 	return result;
 }
@@ -299,9 +321,9 @@ inline SDF::Obj Font::GetType3GlyphStream(UInt32 char_code)
 
 inline std::vector<double> Font::GetVerticalAdvance(UInt32 char_code)
 {
-	double out_pos_vect_x;
-	double out_pos_vect_y;
-	double result;
+	double out_pos_vect_x = 0;
+	double out_pos_vect_y = 0;
+	double result = 0;
 	std::vector<double> arr(3);
 	TRN_FontGetVerticalAdvance(mp_font,char_code,&out_pos_vect_x,&out_pos_vect_y,&result);
 	arr[0] = out_pos_vect_x;
@@ -324,7 +346,7 @@ inline Font Font::GetDescendant()
 
 inline UInt32 Font::MapToCID(UInt32 char_code) const
 {
-	UInt32 result;
+	UInt32 result = 0;
 	REX(TRN_FontMapToCID(mp_font,char_code,&result));
 	return result;
 }
@@ -1,21 +1,43 @@
 
-inline Function::Function (SDF::Obj funct_dict)
+inline Function::Function (SDF::Obj funct_dict) : mp_func(0)
 {
 	REX(TRN_FunctionCreate(funct_dict.mp_obj,&mp_func));
 }
 
-inline Function::Function(const Function& f)
+inline Function::Function(const Function& f) : mp_func(0)
 {
+	if (!f.mp_func) return;	// a copy of a moved-from function is null
 	REX(TRN_FunctionCreate(0,&mp_func));
 	REX(TRN_FunctionAssign(mp_func,f.mp_func));
 }
 
 inline Function& Function::operator=(const Function& f)
 {
+	if (!f.mp_func) {
+		DREX(mp_func, TRN_FunctionDestroy(mp_func));
+		return *this;
+	}
+	if (!mp_func) {
+		// moved-from target
+		REX(TRN_FunctionCreate(0,&mp_func));
+	}
 	REX(TRN_FunctionAssign(mp_func,f.mp_func));
 	return *this;
 }
 
+#ifdef PDFTRON_CPP11
+inline Function::Function(Function&& other) noexcept : mp_func(other.mp_func)
+{
+	other.mp_func = 0;
+}
+
+inline Function& Function::operator=(Function&& other) noexcept
+{
+	std::swap(mp_func, other.mp_func);
+	return *this;
+}
+#endif
+
 inline Function::~Function()
 {
 	DREX(mp_func, TRN_FunctionDestroy(mp_func));
@@ -46,7 +68,7 @@ inline int Function::GetOutputCardinality()
 
 inline std::vector<double> Function::Eval(const std::vector<double>& in_arr)
 {
-	int size;
+	int size = 0;
 	TRN_FunctionGetOutputCardinality(mp_func,&size);
 	std::vector<double> result(size);
 	REX(TRN_FunctionEval(mp_func,(double*)&(in_arr[0]),(double*)&(result[0])));
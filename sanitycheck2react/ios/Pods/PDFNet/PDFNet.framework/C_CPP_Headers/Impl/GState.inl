@@ -22,14 +22,14 @@ inline Common::Matrix2D GState::GetTransform()
 
 inline ColorSpace GState::GetStrokeColorSpace()
 {
-	TRN_ColorSpace result;
+	TRN_ColorSpace result = 0;
 	REX(TRN_GStateGetStrokeColorSpace(mp_state,&result));
 	return ColorSpace(result);
 }
 
 inline ColorSpace GState::GetFillColorSpace()
 {
-	TRN_ColorSpace result;
+	TRN_ColorSpace result = 0;
 	REX(TRN_GStateGetFillColorSpace(mp_state,&result));
 	return result;
 }
@@ -85,7 +85,7 @@ inline double GState::GetMiterLimit() const
 
 inline std::vector<double> GState::GetDashes() const
 {
-	int dashes_sz;
+	int dashes_sz = 0;
 	std::vector<double> dashes;
 	REX(TRN_GStateGetDashes(mp_state,0,&dashes_sz));
 	dashes.resize(dashes_sz);
@@ -99,7 +99,7 @@ inline std::vector<double> GState::GetDashes() const
 #ifndef SWIG
 inline void GState::GetDashes(std::vector<double>& dashes) const
 {
-	int dashes_sz;
+	int dashes_sz = 0;
 	REX(TRN_GStateGetDashes(mp_state,0,&dashes_sz));
 	dashes.resize(dashes_sz);
 	if (dashes_sz < 1) return;
@@ -134,7 +134,7 @@ inline double GState::GetLeading() const
 
 inline Font GState::GetFont() const
 {
-	TRN_Font result;
+	TRN_Font result = 0;
 	REX(TRN_GStateGetFont(mp_state, &result));
 	return Font(result);
 }
@@ -462,3 +462,52 @@ inline GState::GState(TRN_GState impl) : mp_state(impl)
 {
 }
 
+
+inline UInt64 GState::GetNumericMask()
+{
+	return AttributeBit(e_transform) | AttributeBit(e_line_width)
+		| AttributeBit(e_opacity_fill) | AttributeBit(e_opacity_stroke)
+		| AttributeBit(e_font_size) | AttributeBit(e_char_spacing)
+		| AttributeBit(e_word_spacing) | AttributeBit(e_text_rise);
+}
+
+inline void GState::GetNumericSnapshot(NumericSnapshot& out)
+{
+	UpdateNumericSnapshot(GetNumericMask(), out);
+}
+
+inline void GState::UpdateNumericSnapshot(UInt64 changes, NumericSnapshot& snapshot)
+{
+	if (changes & AttributeBit(e_transform)) {
+		Common::Matrix2D ctm = GetTransform();
+		snapshot.ctm[0] = ctm.m_a;
+		snapshot.ctm[1] = ctm.m_b;
+		snapshot.ctm[2] = ctm.m_c;
+		snapshot.ctm[3] = ctm.m_d;
+		snapshot.ctm[4] = ctm.m_h;
+		snapshot.ctm[5] = ctm.m_v;
+	}
+	if (changes & AttributeBit(e_line_width)) snapshot.line_width = GetLineWidth();
+	if (changes & AttributeBit(e_opacity_fill)) snapshot.fill_opacity = GetFillOpacity();
+	if (changes & AttributeBit(e_opacity_stroke)) snapshot.stroke_opacity = GetStrokeOpacity();
+	if (changes & AttributeBit(e_font_size)) snapshot.font_size = GetFontSize();
+	if (changes & AttributeBit(e_char_spacing)) snapshot.char_spacing = GetCharSpacing();
+	if (changes & AttributeBit(e_word_spacing)) snapshot.word_spacing = GetWordSpacing();
+	if (changes & AttributeBit(e_text_rise)) snapshot.text_rise = GetTextRise();
+}
+
+inline UInt64 GState::Compare(const NumericSnapshot& s1, const NumericSnapshot& s2)
+{
+	UInt64 diff = 0;
+	for (int i = 0; i < 6; ++i) {
+		if (s1.ctm[i] != s2.ctm[i]) diff |= AttributeBit(e_transform);
+	}
+	if (s1.line_width != s2.line_width) diff |= AttributeBit(e_line_width);
+	if (s1.fill_opacity != s2.fill_opacity) diff |= AttributeBit(e_opacity_fill);
+	if (s1.stroke_opacity != s2.stroke_opacity) diff |= AttributeBit(e_opacity_stroke);
+	if (s1.font_size != s2.font_size) diff |= AttributeBit(e_font_size);
+	if (s1.char_spacing != s2.char_spacing) diff |= AttributeBit(e_char_spacing);
+	if (s1.word_spacing != s2.word_spacing) diff |= AttributeBit(e_word_spacing);
+	if (s1.text_rise != s2.text_rise) diff |= AttributeBit(e_text_rise);
+	return diff;
+}
@@ -180,13 +180,13 @@ namespace pdftron {
 
 		#ifndef SWIG
 		inline bool HTML2PDF::Convert(PDFDoc& doc, const UString& url) {
-			TRN_Bool ret;
+			TRN_Bool ret = 0;
 			REX(TRN_HTML2PDFStaticConvert(doc.mp_doc, url.mp_impl, &ret));
 			return TBToB(ret);
 		}
 
 		inline bool HTML2PDF::Convert(PDFDoc& doc, const UString& url, const WebPageSettings& settings) {
-			TRN_Bool ret;
+			TRN_Bool ret = 0;
 			REX(TRN_HTML2PDFStaticConvert2(doc.mp_doc, url.mp_impl, settings.mp_impl, &ret));
 			return TBToB(ret);
 		}
@@ -217,13 +217,13 @@ namespace pdftron {
 		}
 
 		inline bool HTML2PDF::Convert(PDFDoc& doc) {
-			TRN_Bool ret;
+			TRN_Bool ret = 0;
 			REX(TRN_HTML2PDFConvert(mp_html2pdf, doc.mp_doc, &ret));
 			return TBToB(ret);
 		}
 
 		inline int HTML2PDF::GetHTTPErrorCode() const {
-			int ret;
+			int ret = 0;
 			REX(TRN_HTML2PDFGetHttpErrorCode(mp_html2pdf, &ret));
 			return ret;
 		}
@@ -290,7 +290,7 @@ namespace pdftron {
 		}
 
 		inline UString HTML2PDF::GetLog() const {
-			TRN_UString result;
+			TRN_UString result = 0;
 			REX(TRN_HTML2PDFGetLog(mp_html2pdf, &result));
 			return UString(result);	
 		}
@@ -7,7 +7,7 @@ inline ptrdiff_t Highlights::GetHandleInternal() {
     return (ptrdiff_t) mp_highlights;
 }
 
-inline Highlights::Highlights()
+inline Highlights::Highlights() : mp_highlights(0)
 {
 	REX(TRN_HighlightsCreate(&mp_highlights));
 }
@@ -24,17 +24,40 @@ inline void Highlights::Destroy ()
 	mp_highlights = 0;
 }
 
-inline Highlights::Highlights(const Highlights& hlts)
+inline Highlights::Highlights(const Highlights& hlts) : mp_highlights(0)
 {
+	if (!hlts.mp_highlights) return;	// a copy of moved-from highlights is null
 	REX(TRN_HighlightsCopyCtor(hlts.mp_highlights, &mp_highlights));
 }
 
 inline Highlights& Highlights::operator = ( const Highlights& hlts )
 {
+	if (!hlts.mp_highlights) {
+		DREX(mp_highlights, TRN_HighlightsDestroy(mp_highlights));
+		return *this;
+	}
+	if (!mp_highlights) {
+		// moved-from target
+		REX(TRN_HighlightsCopyCtor(hlts.mp_highlights, &mp_highlights));
+		return *this;
+	}
 	REX( TRN_HighlightsAssign(mp_highlights, hlts.mp_highlights) );
 	return *this;
 }
 
+#ifdef PDFTRON_CPP11
+inline Highlights::Highlights(Highlights&& other) noexcept : mp_highlights(other.mp_highlights)
+{
+	other.mp_highlights = 0;
+}
+
+inline Highlights& Highlights::operator=(Highlights&& other) noexcept
+{
+	std::swap(mp_highlights, other.mp_highlights);
+	return *this;
+}
+#endif
+
 inline void Highlights::Add( const Highlights& hlts )
 {
 	REX( TRN_HighlightsAdd(mp_highlights, hlts.mp_highlights ) );
@@ -77,8 +100,8 @@ inline int Highlights::GetCurrentPageNumber() const
 
 inline std::vector<QuadPoint> Highlights::GetCurrentQuads() const
 {
-	int num;
-	double* quads;
+	int num = 0;
+	double* quads = 0;
 	TRN_HighlightsGetCurrentQuads(mp_highlights, ((const double**)&quads), &num);
 	std::vector<QuadPoint> result;
 	result.resize(num);
@@ -41,7 +41,7 @@ inline Image Image::Create(SDF::SDFDoc& doc,
 	size_t image_data_size,
 	SDF::Obj encoder_hints)
 {
-	TRN_Image result;
+	TRN_Image result = 0;
 	REX(TRN_ImageCreateFromMemory2(doc.mp_doc, image_data, image_data_size,
 		encoder_hints.mp_obj, &result));
 	return Image(result);
@@ -51,7 +51,7 @@ inline Image Image::Create(SDF::SDFDoc& doc,
 	Filters::Filter stream,
 	SDF::Obj encoder_hints)
 {
-	TRN_Image result;
+	TRN_Image result = 0;
 	stream.m_owner = false;
 	REX(TRN_ImageCreateFromStream2(doc.mp_doc, stream.m_impl, encoder_hints.mp_obj, &result));
 	stream.m_impl = 0;
@@ -61,7 +61,7 @@ inline Image Image::Create(SDF::SDFDoc& doc,
 #if defined(_WIN32)
 inline Image Image::Create(SDF::SDFDoc& doc, Gdiplus::Bitmap* bmp, SDF::Obj encoder_hints)
 {
-	TRN_Image result;
+	TRN_Image result = 0;
 	REX(TRN_ImageCreateFromBitmap(doc.mp_doc,(TRN_GDIPlusBitmap)bmp,encoder_hints.mp_obj,&result));
 	return Image(result);
 }
@@ -113,7 +113,7 @@ inline Image Image::CreateSoftMask(SDF::SDFDoc& doc,
 	int bpc, 
 	SDF::Obj encoder_hints)
 {
-	TRN_Image result;
+	TRN_Image result = 0;
 	REX(TRN_ImageCreateSoftMaskFromStream(doc.mp_doc,
 		image_data.m_impl,width,height,bpc,
 		encoder_hints.mp_obj,&result));
@@ -129,7 +129,7 @@ inline Image Image::Create(SDF::SDFDoc& doc,
 	ColorSpace color_space,
 	InputFilter input_format)
 {
-	TRN_Image result;
+	TRN_Image result = 0;
 	REX(TRN_ImageCreateDirectFromMemory(doc.mp_doc,image_data,
 		image_data_size,width,height,bpc,color_space.mp_cs,
 		(enum TRN_ImageInputFilter)input_format,&result));
@@ -144,29 +144,47 @@ inline Image Image::Create(SDF::SDFDoc& doc,
 	ColorSpace color_space,
 	InputFilter input_format)
 {
-	TRN_Image result;
+	TRN_Image result = 0;
 	REX(TRN_ImageCreateDirectFromStream(doc.mp_doc,
 		image_data.m_impl,width,height,bpc,color_space.mp_cs,
 		(enum TRN_ImageInputFilter)input_format,&result));
 	return Image(result);
 }
 
-inline Image::Image(SDF::Obj image_xobject)
+inline Image::Image(SDF::Obj image_xobject) : mp_image(0)
 {
 	REX(TRN_ImageCreateFromObj(image_xobject.mp_obj,&mp_image));
 }
 
-inline Image::Image(const Image& c)
+inline Image::Image(const Image& c) : mp_image(0)
 {
+	if (!c.mp_image) return;	// a copy of a moved-from image is null
 	REX(TRN_ImageCopy(c.mp_image,&mp_image));
 }
 
 inline Image& Image::operator=(const Image& c)
 {
+	if (!c.mp_image) {
+		mp_image = 0;
+		return *this;
+	}
 	REX(TRN_ImageCopy(c.mp_image,&mp_image));
 	return *this;
 }
 
+#ifdef PDFTRON_CPP11
+inline Image::Image(Image&& other) noexcept : mp_image(other.mp_image)
+{
+	other.mp_image = 0;
+}
+
+inline Image& Image::operator=(Image&& other) noexcept
+{
+	std::swap(mp_image, other.mp_image);
+	return *this;
+}
+#endif
+
 inline SDF::Obj Image::GetSDFObj () const
 {
 	RetObj(TRN_ImageGetSDFObj(mp_image,&result));
@@ -179,7 +197,7 @@ inline bool Image::IsValid() const
 
 inline Filters::Filter Image::GetImageData() const
 {
-	TRN_Filter result;
+	TRN_Filter result = 0;
 	REX(TRN_ImageGetImageData(mp_image,&result));
 	return Filters::Filter(result,true);
 }
@@ -192,7 +210,7 @@ inline int Image::GetImageDataSize() const
 #if defined(_WIN32)
 inline Gdiplus::Bitmap* Image::GetBitmap() const
 {
-	TRN_GDIPlusBitmap result;
+	TRN_GDIPlusBitmap result = 0;
 	REX(TRN_ImageGetBitmap(mp_image,&result));
 	return (Gdiplus::Bitmap*)result;
 }
@@ -200,7 +218,7 @@ inline Gdiplus::Bitmap* Image::GetBitmap() const
 
 inline ColorSpace Image::GetImageColorSpace() const
 {
-	TRN_ColorSpace result;
+	TRN_ColorSpace result = 0;
 	REX(TRN_ImageGetImageColorSpace(mp_image,&result));
 	return ColorSpace(result);
 }
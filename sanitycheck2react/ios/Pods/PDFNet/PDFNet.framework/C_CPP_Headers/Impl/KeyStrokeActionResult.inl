@@ -5,36 +5,59 @@ namespace pdftron {
 
 inline bool KeyStrokeActionResult::IsValid()
 {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_KeyStrokeActionResultIsValid(mp_result, &result));
 	return TBToB(result);
 }
 
 inline UString KeyStrokeActionResult::GetText()
 {
-	TRN_UString result;
+	TRN_UString result = 0;
 	REX(TRN_KeyStrokeActionResultGetText(mp_result, &result));
 	return UString(result);
 }
 
-inline KeyStrokeActionResult::KeyStrokeActionResult(){}
+inline KeyStrokeActionResult::KeyStrokeActionResult() : mp_result(0) {}
         
 inline KeyStrokeActionResult::~KeyStrokeActionResult()
 {
 	DREX(mp_result, TRN_KeyStrokeActionResultDestroy(mp_result));
 }
 
-inline KeyStrokeActionResult::KeyStrokeActionResult(const KeyStrokeActionResult& action_result)
+inline KeyStrokeActionResult::KeyStrokeActionResult(const KeyStrokeActionResult& action_result) : mp_result(0)
 {
+	if (!action_result.mp_result) return;	// a copy of a moved-from result is null
 	REX(TRN_KeyStrokeActionResultCopy(action_result.mp_result, &mp_result));
 }
 
 inline KeyStrokeActionResult& KeyStrokeActionResult::operator=(const KeyStrokeActionResult& action_result)
 {
+	if (!action_result.mp_result) {
+		DREX(mp_result, TRN_KeyStrokeActionResultDestroy(mp_result));
+		return *this;
+	}
+	if (!mp_result) {
+		// moved-from target
+		REX(TRN_KeyStrokeActionResultCopy(action_result.mp_result, &mp_result));
+		return *this;
+	}
 	REX(TRN_KeyStrokeActionResultAssign(mp_result, action_result.mp_result));
 	return *this;
 }
 
+#ifdef PDFTRON_CPP11
+inline KeyStrokeActionResult::KeyStrokeActionResult(KeyStrokeActionResult&& other) noexcept : mp_result(other.mp_result)
+{
+	other.mp_result = 0;
+}
+
+inline KeyStrokeActionResult& KeyStrokeActionResult::operator=(KeyStrokeActionResult&& other) noexcept
+{
+	std::swap(mp_result, other.mp_result);
+	return *this;
+}
+#endif
+
 inline void KeyStrokeActionResult::Destroy()
 {
 	REX(TRN_KeyStrokeActionResultDestroy(mp_result));
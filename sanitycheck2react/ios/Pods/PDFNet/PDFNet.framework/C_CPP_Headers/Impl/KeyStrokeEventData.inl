@@ -3,7 +3,7 @@
 namespace pdftron {
 	namespace PDF {
 
-inline KeyStrokeEventData::KeyStrokeEventData(const UString& field_name, const UString& current_value, const UString& change, int selection_start, int selection_end)
+inline KeyStrokeEventData::KeyStrokeEventData(const UString& field_name, const UString& current_value, const UString& change, int selection_start, int selection_end) : mp_data(0)
 {
 	REX(TRN_KeyStrokeEventDataCreate(field_name.mp_impl, current_value.mp_impl, change.mp_impl, selection_start, selection_end, &mp_data));
 }
@@ -13,17 +13,40 @@ inline KeyStrokeEventData::~KeyStrokeEventData()
 	DREX(mp_data, TRN_KeyStrokeEventDataDestroy(mp_data));
 }
 
-inline KeyStrokeEventData::KeyStrokeEventData(const KeyStrokeEventData& data)
+inline KeyStrokeEventData::KeyStrokeEventData(const KeyStrokeEventData& data) : mp_data(0)
 {
+	if (!data.mp_data) return;	// a copy of moved-from event data is null
 	REX(TRN_KeyStrokeEventDataCopy(data.mp_data, &mp_data));
 }
 
 inline KeyStrokeEventData& KeyStrokeEventData::operator=(const KeyStrokeEventData& data)
 {
+	if (!data.mp_data) {
+		DREX(mp_data, TRN_KeyStrokeEventDataDestroy(mp_data));
+		return *this;
+	}
+	if (!mp_data) {
+		// moved-from target
+		REX(TRN_KeyStrokeEventDataCopy(data.mp_data, &mp_data));
+		return *this;
+	}
 	REX(TRN_KeyStrokeEventDataAssign(mp_data, data.mp_data));
 	return *this;
 }
 
+#ifdef PDFTRON_CPP11
+inline KeyStrokeEventData::KeyStrokeEventData(KeyStrokeEventData&& other) noexcept : mp_data(other.mp_data)
+{
+	other.mp_data = 0;
+}
+
+inline KeyStrokeEventData& KeyStrokeEventData::operator=(KeyStrokeEventData&& other) noexcept
+{
+	std::swap(mp_data, other.mp_data);
+	return *this;
+}
+#endif
+
 inline void KeyStrokeEventData::Destroy()
 {
 	REX(TRN_KeyStrokeEventDataDestroy(mp_data));
@@ -36,7 +36,7 @@ inline void Markup::SetTitle(const char* title)
 //Popup
 inline Popup Markup::GetPopup() const
 {
-	TRN_Annot result;
+	TRN_Annot result = 0;
 	REX(TRN_MarkupAnnotGetPopup(mp_annot,&result));
 	return Annot(result);
 }
@@ -49,7 +49,7 @@ inline void Markup::SetPopup(const Popup& bs)
 //CA
 inline double Markup::GetOpacity() const
 {
-	double result;
+	double result = 0;
 	REX(TRN_MarkupAnnotGetOpacity(mp_annot, &result)); 
 	return result;
 }
@@ -73,7 +73,7 @@ inline void Markup::SetSubject(const UString& subj)
 //CreationDate
 inline Date Markup::GetCreationDates() const
 {
-	TRN_Date result;
+	TRN_Date result = TRN_Date();
 	REX(TRN_MarkupAnnotGetCreationDates(mp_annot,&result));
 	return *((Date*)&result);
 }
@@ -100,7 +100,7 @@ inline void Markup::SetBorderEffect(Markup::BorderEffect effect)
 //BEI
 inline double Markup::GetBorderEffectIntensity() const
 {
-	double result;
+	double result = 0;
 	REX(TRN_MarkupAnnotGetBorderEffectIntensity(mp_annot, &result)); 
 	return result;
 }
@@ -124,7 +124,7 @@ inline ColorPt Markup::GetInteriorColor() const
 inline int Markup::GetInteriorColorCompNum() const
 { 
 	//return GetColorCompNumUtil();
-	int result;
+	int result = 0;
 	REX(TRN_MarkupAnnotGetInteriorColorCompNum(mp_annot, &result));
 	return result;
 }
@@ -139,7 +139,7 @@ inline void Markup::SetInteriorColor(const ColorPt& c, int CompNum)
 //RD
 inline Rect Markup::GetContentRect() const
 {
-	TRN_Rect result;
+	TRN_Rect result = TRN_Rect();
 	REX(TRN_MarkupAnnotGetContentRect(mp_annot, &result));
 	return *((Rect*)&result);
 }
@@ -152,7 +152,7 @@ inline void Markup::SetContentRect(const Rect& cr)
 //RD
 inline Rect Markup::GetPadding() const
 {
-	TRN_Rect result;
+	TRN_Rect result = TRN_Rect();
 	REX(TRN_MarkupAnnotGetPadding(mp_annot, &result));
 	return *((Rect*)&result);
 }
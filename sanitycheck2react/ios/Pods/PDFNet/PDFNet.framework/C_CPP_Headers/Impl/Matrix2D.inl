@@ -33,7 +33,7 @@ inline Matrix2D Matrix2D::operator* (const Matrix2D& m) const {
 }
 
 inline bool Matrix2D::operator ==(const Matrix2D& m) const {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	TRN_Matrix2DEquals(this,&m,&result);
 	return TBToB(result);
 }
@@ -46,7 +46,7 @@ inline Matrix2D Matrix2D::Multiply(const Matrix2D& m)
 
 inline bool Matrix2D::IsEquals(const Matrix2D& m) const
 {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	TRN_Matrix2DEquals(this,&m,&result);
 	return TBToB(result);
 }
@@ -5,7 +5,7 @@ inline MemoryFilter::MemoryFilter(size_t buf_sz, bool is_input) {
 }
 
 inline UChar* MemoryFilter::GetBuffer() {
-	TRN_UChar* result;
+	TRN_UChar* result = 0;
 	REX(TRN_FilterMemoryFilterGetBuffer(m_impl, &result));
 	return result;
 }
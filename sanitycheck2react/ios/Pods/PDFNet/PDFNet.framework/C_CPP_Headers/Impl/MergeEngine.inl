@@ -0,0 +1,257 @@
+
+inline MergeEngine::MergeEngine(int num_threads)
+	: m_scheduler(num_threads), m_batch_size(0), m_import_bookmarks(false)
+{
+}
+
+inline int MergeEngine::GetThreadCount() const
+{
+	return m_scheduler.GetThreadCount();
+}
+
+inline void MergeEngine::SetBatchSize(int batch_size)
+{
+	m_batch_size = batch_size;
+}
+
+inline void MergeEngine::SetImportBookmarks(bool import_bookmarks)
+{
+	m_import_bookmarks = import_bookmarks;
+}
+
+inline void MergeEngine::AddSource(const UString& path, const std::string& password)
+{
+	Source source;
+	source.path = path;
+	source.password = password;
+	source.doc = 0;
+	m_sources.push_back(source);
+}
+
+inline void MergeEngine::AddSource(PDFDoc& doc)
+{
+	Source source;
+	source.doc = &doc;
+	m_sources.push_back(source);
+}
+
+inline int MergeEngine::GetSourceCount() const
+{
+	return (int)m_sources.size();
+}
+
+inline void MergeEngine::Clear()
+{
+	m_sources.clear();
+}
+
+inline MergeEngine::Stats MergeEngine::Merge(PDFDoc& dest)
+{
+	Clock::time_point start = Clock::now();
+	Stats stats = Stats();
+	std::map<SDF::ContentHash, SDF::Obj> canonical;
+	SDF::ObjHasher verifier;	// compares resources of the destination document
+
+	int num_sources = (int)m_sources.size();
+	int batch_size = m_batch_size > 0 ? m_batch_size : 4 * m_scheduler.GetThreadCount();
+	std::vector<Prepared> current, next;
+	if (num_sources > 0) {
+		current.resize(batch_size < num_sources ? batch_size : num_sources);
+		Prepare(0, current, stats);
+	}
+
+	for (int first = 0; first < num_sources; first += batch_size) {
+		// prepare the next batch while the current one is imported
+		int next_first = first + batch_size;
+		std::exception_ptr prepare_error;
+#ifdef PDFTRON_NO_EXCEPTIONS
+		TRN_Exception prepare_failure = 0;
+#endif
+		std::thread preparer;
+		if (next_first < num_sources) {
+			next.resize(batch_size < num_sources - next_first ? batch_size : num_sources - next_first);
+			preparer = std::thread([&]() {
+				PDFTRON_TRY {
+					Prepare(next_first, next, stats);
+				}
+				PDFTRON_CATCH(...) {
+					prepare_error = std::current_exception();
+				}
+#ifdef PDFTRON_NO_EXCEPTIONS
+				prepare_failure = Common::TakeLastException();
+#endif
+			});
+		}
+
+		PDFTRON_TRY {
+			for (size_t i = 0; i < current.size(); ++i) {
+				Import(dest, current[i], canonical, verifier, stats);
+				current[i] = Prepared();	// closes the source document
+			}
+		}
+		PDFTRON_CATCH(...) {
+			if (preparer.joinable()) preparer.join();
+			PDFTRON_RETHROW;
+		}
+
+		if (preparer.joinable()) preparer.join();
+		if (prepare_error) std::rethrow_exception(prepare_error);
+#ifdef PDFTRON_NO_EXCEPTIONS
+		if (prepare_failure) Common::LastExceptionSlot() = prepare_failure;
+#endif
+		current.swap(next);
+		next.clear();
+	}
+
+	stats.elapsed_ms = ElapsedMs(start);
+	return stats;
+}
+
+inline MergeEngine::Stats MergeEngine::Merge(const UString& path, UInt32 save_flags)
+{
+	Clock::time_point start = Clock::now();
+	PDFDoc dest;
+	Stats stats = Merge(dest);
+
+	Clock::time_point t = Clock::now();
+	dest.Save(path, save_flags);
+	stats.save_ms = ElapsedMs(t);
+	stats.elapsed_ms = ElapsedMs(start);
+	return stats;
+}
+
+inline void MergeEngine::Prepare(int first_source, std::vector<Prepared>& batch, Stats& stats) const
+{
+	std::mutex mutex;
+	m_scheduler.Run((int)batch.size(), [&](int idx, int) {
+		const Source& source = m_sources[first_source + idx];
+		Prepared& prepared = batch[idx];
+
+		Clock::time_point t = Clock::now();
+		if (source.doc) {
+			prepared.doc = source.doc;
+		}
+		else {
+			prepared.owned.reset(new PDFDoc(source.path));
+			bool ok = source.password.empty() ? prepared.owned->InitSecurityHandler()
+				: prepared.owned->InitStdSecurityHandler(source.password.c_str(), (int)source.password.size());
+			if (!ok) {
+				PDFTRON_THROW(Common::Exception("InitSecurityHandler", __LINE__, __FILE__, "MergeEngine::Merge",
+					("Cannot decrypt " + source.path.ConvertToUtf8()).c_str()));
+				return;
+			}
+			prepared.doc = prepared.owned.get();
+		}
+		double open_ms = ElapsedMs(t);
+
+		t = Clock::now();
+		int resources = 0;
+		{
+			DocReadGuard guard(*prepared.doc, "MergeEngine::Prepare");
+			prepared.pages.reserve(prepared.doc->GetPageCount());
+			for (PageIterator itr = prepared.doc->GetPageIterator(); itr.HasNext(); itr.Next()) {
+				prepared.pages.push_back(itr.Current());
+			}
+
+			SDF::ObjHasher hasher;
+			const char* const* types = GetResourceTypes();
+			for (size_t i = 0; i < prepared.pages.size(); ++i) {
+				SDF::Obj res = prepared.pages[i].GetResourceDict();
+				if (!res || !res.IsDict()) continue;
+				for (int type = 0; types[type]; ++type) {
+					SDF::Obj dict = res.FindObj(types[type]);
+					if (!dict || !dict.IsDict()) continue;
+					for (SDF::DictIterator itr = dict.GetDictIterator(); itr.HasNext(); itr.Next()) {
+						SDF::Obj value = itr.Value();
+						if (!value.IsIndirect() || prepared.hashes.count(value.GetObjNum())) continue;
+						SDF::ContentHash hash;
+						if (hasher.Hash(value, hash)) {
+							prepared.hashes[value.GetObjNum()] = hash;
+							++resources;
+						}
+					}
+				}
+			}
+		}
+
+		std::lock_guard<std::mutex> lock(mutex);
+		stats.open_ms += open_ms;
+		stats.hash_ms += ElapsedMs(t);
+		stats.resources += resources;
+	});
+}
+
+inline void MergeEngine::Import(PDFDoc& dest, Prepared& source, std::map<SDF::ContentHash, SDF::Obj>& canonical,
+	SDF::ObjHasher& verifier, Stats& stats) const
+{
+	++stats.sources;
+	if (source.pages.empty()) return;
+
+	DocReadGuard src_guard(*source.doc, "MergeEngine::Import");
+	DocWriteGuard dest_guard(dest, "MergeEngine::Import");
+
+	Clock::time_point t = Clock::now();
+	std::vector<Page> imported = dest.ImportPages(source.pages, m_import_bookmarks);
+	for (size_t i = 0; i < imported.size(); ++i) {
+		dest.PagePushBack(imported[i]);
+	}
+	stats.import_ms += ElapsedMs(t);
+	stats.pages += (int)imported.size();
+
+	t = Clock::now();
+	for (size_t i = 0; i < imported.size() && i < source.pages.size(); ++i) {
+		Redirect(source.pages[i], imported[i], source.hashes, canonical, verifier, stats);
+	}
+	stats.dedupe_ms += ElapsedMs(t);
+}
+
+inline void MergeEngine::Redirect(Page src_page, Page dest_page, const std::map<UInt32, SDF::ContentHash>& hashes,
+	std::map<SDF::ContentHash, SDF::Obj>& canonical, SDF::ObjHasher& verifier, Stats& stats)
+{
+	// ImportPages() keeps the structure of the resource dictionaries, so the
+	// imported copy of a source resource is found under the same keys.
+	SDF::Obj src_res = src_page.GetResourceDict();
+	SDF::Obj dest_res = dest_page.GetResourceDict();
+	if (!src_res || !dest_res || !src_res.IsDict() || !dest_res.IsDict()) return;
+
+	const char* const* types = GetResourceTypes();
+	for (int type = 0; types[type]; ++type) {
+		SDF::Obj src_dict = src_res.FindObj(types[type]);
+		SDF::Obj dest_dict = dest_res.FindObj(types[type]);
+		if (!src_dict || !dest_dict || !src_dict.IsDict() || !dest_dict.IsDict()) continue;
+
+		for (SDF::DictIterator itr = src_dict.GetDictIterator(); itr.HasNext(); itr.Next()) {
+			SDF::Obj value = itr.Value();
+			if (!value.IsIndirect()) continue;
+			std::map<UInt32, SDF::ContentHash>::const_iterator hash = hashes.find(value.GetObjNum());
+			if (hash == hashes.end()) continue;
+
+			const char* key = itr.Key().GetName();
+			SDF::Obj dest_value = dest_dict.FindObj(key);
+			if (!dest_value || !dest_value.IsIndirect()) continue;
+
+			std::pair<std::map<SDF::ContentHash, SDF::Obj>::iterator, bool> entry =
+				canonical.insert(std::make_pair(hash->second, dest_value));
+			if (entry.second || entry.first->second.GetObjNum() == dest_value.GetObjNum()) continue;
+
+			// the hash only selects a candidate; a resource is shared only if
+			// its content really matches
+			if (!verifier.Equal(entry.first->second, dest_value)) continue;
+			dest_dict.Put(key, entry.first->second);
+			++stats.resources_merged;
+		}
+	}
+}
+
+inline const char* const* MergeEngine::GetResourceTypes()
+{
+	static const char* const types[] = {
+		"Font", "XObject", "ExtGState", "ColorSpace", "Pattern", "Shading", "Properties", 0
+	};
+	return types;
+}
+
+inline double MergeEngine::ElapsedMs(Clock::time_point start)
+{
+	return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
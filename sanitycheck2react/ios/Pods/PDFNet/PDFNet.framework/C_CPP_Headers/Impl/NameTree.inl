@@ -14,13 +14,13 @@ inline NameTree NameTree::Find(class SDFDoc& doc, const std::string& name)
 	return result;
 }
 
-inline NameTree::NameTree (Obj name_tree)
+inline NameTree::NameTree (Obj name_tree) : mp_obj(0)
 {
 	REX(TRN_NameTreeCreateFromObj(name_tree.mp_obj,&(mp_obj)));
 }
 
 
-inline NameTree::NameTree (const NameTree& d)
+inline NameTree::NameTree (const NameTree& d) : mp_obj(0)
 {
 	REX(TRN_NameTreeCopy(d.mp_obj,&(mp_obj)));
 }
@@ -33,14 +33,14 @@ inline NameTree& NameTree::operator=(const NameTree& d)
 
 inline bool NameTree::IsValid()
 {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_NameTreeIsValid(mp_obj,&result));
 	return TBToB(result);
 }
 
 inline NameTreeIterator NameTree::GetIterator(const UChar* key, int key_sz)
 {
-	TRN_DictIterator result;
+	TRN_DictIterator result = 0;
 	TRN_String keyString = { (const char*)key, (unsigned int)key_sz };
 	REX(TRN_NameTreeGetIterator(mp_obj, keyString, &(result)));
 	return DictIterator(result);
@@ -55,7 +55,7 @@ inline Obj NameTree::GetValue(const UChar* key, int key_sz)
 
 inline NameTreeIterator NameTree::GetIterator()
 {
-	TRN_DictIterator result;
+	TRN_DictIterator result = 0;
 	REX(TRN_NameTreeGetIteratorBegin(mp_obj,&(result)));
 	return DictIterator(result);
 }
@@ -80,7 +80,7 @@ inline void NameTree::Erase (DictIterator& pos)
 
 inline Obj NameTree::GetSDFObj () const
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_NameTreeGetSDFObj(mp_obj,&(result)));
 	return Obj(result);
 }
@@ -1,11 +1,11 @@
 
 
-inline NumberTree::NumberTree (Obj number_tree)
+inline NumberTree::NumberTree (Obj number_tree) : mp_obj(0)
 {
 	REX(TRN_NumberTreeCreate(number_tree.mp_obj,&mp_obj));
 }
 
-inline NumberTree::NumberTree (const NumberTree& d)
+inline NumberTree::NumberTree (const NumberTree& d) : mp_obj(0)
 {
 	REX(TRN_NumberTreeCopy(d.mp_obj,&mp_obj));
 }
@@ -18,14 +18,14 @@ inline NumberTree& NumberTree::operator=(const NumberTree& d)
 
 inline bool NumberTree::IsValid()
 {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_NumberTreeIsValid(mp_obj,&result));
 	return TBToB(result);
 }
 
 inline NumberTreeIterator NumberTree::GetIterator(TRN_Int32 key)
 {
-	TRN_DictIterator result;
+	TRN_DictIterator result = 0;
 	REX(TRN_NumberTreeGetIterator(mp_obj,key,&(result)));
 	return DictIterator(result);
 }
@@ -33,7 +33,7 @@ inline NumberTreeIterator NumberTree::GetIterator(TRN_Int32 key)
 
 inline NumberTreeIterator NumberTree::GetIterator()
 {
-	TRN_DictIterator result;
+	TRN_DictIterator result = 0;
 	REX(TRN_NumberTreeGetIteratorBegin(mp_obj,&(result)));
 	return DictIterator(result);
 }
@@ -61,7 +61,7 @@ inline void NumberTree::Erase (DictIterator& pos)
 
 inline Obj NumberTree::GetSDFObj () const
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_NumberTreeGetSDFObj(mp_obj,&(result)));
 	return Obj(result);
 }
@@ -0,0 +1,397 @@
+
+inline ObjHasher::State::State()
+	: m_size(0), m_tail_size(0)
+{
+	m_lanes[0] = 0x9E3779B97F4A7C15ULL;
+	m_lanes[1] = 0xC2B2AE3D27D4EB4FULL;
+	m_lanes[2] = 0x165667B19E3779F9ULL;
+	m_lanes[3] = 0x85EBCA77C2B2AE63ULL;
+}
+
+inline void ObjHasher::State::Update(const void* data, size_t size)
+{
+	const UChar* p = (const UChar*)data;
+	m_size += size;
+
+	if (m_tail_size) {
+		size_t fill = 32 - m_tail_size;
+		if (size < fill) {
+			memcpy(m_tail + m_tail_size, p, size);
+			m_tail_size += size;
+			return;
+		}
+		memcpy(m_tail + m_tail_size, p, fill);
+		Round(m_tail);
+		m_tail_size = 0;
+		p += fill;
+		size -= fill;
+	}
+
+	for (; size >= 32; p += 32, size -= 32) Round(p);
+
+	if (size) {
+		memcpy(m_tail, p, size);
+		m_tail_size = size;
+	}
+}
+
+inline void ObjHasher::State::UpdateByte(UChar value)
+{
+	Update(&value, 1);
+}
+
+inline void ObjHasher::State::UpdateWord(UInt64 value)
+{
+	UChar buf[8];
+	for (int i = 0; i < 8; ++i) buf[i] = (UChar)(value >> (8 * i));
+	Update(buf, 8);
+}
+
+inline ContentHash ObjHasher::State::Finish() const
+{
+	UInt64 lanes[4] = { m_lanes[0], m_lanes[1], m_lanes[2], m_lanes[3] };
+
+	// the tail holds less than one block; spread its words over the lanes
+	UChar last[32] = { 0 };
+	memcpy(last, m_tail, m_tail_size);
+	for (size_t i = 0; i * 8 < m_tail_size; ++i) lanes[i] = Mix(lanes[i], Load(last + i * 8));
+
+	UInt64 a = Rotl(lanes[0], 1) + Rotl(lanes[1], 7) + Rotl(lanes[2], 12) + Rotl(lanes[3], 18);
+	UInt64 b = (lanes[0] ^ Rotl(lanes[2], 29)) * 0x87C37B91114253D5ULL
+		+ (lanes[1] ^ Rotl(lanes[3], 43)) * 0x4CF5AD432745937FULL;
+
+	ContentHash result;
+	result.h1 = Avalanche(a ^ m_size);
+	result.h2 = Avalanche(b + m_size * 0x9E3779B97F4A7C15ULL) ^ Rotl(result.h1, 32);
+	return result;
+}
+
+inline void ObjHasher::State::Round(const UChar* block)
+{
+	m_lanes[0] = Mix(m_lanes[0], Load(block));
+	m_lanes[1] = Mix(m_lanes[1], Load(block + 8));
+	m_lanes[2] = Mix(m_lanes[2], Load(block + 16));
+	m_lanes[3] = Mix(m_lanes[3], Load(block + 24));
+}
+
+inline UInt64 ObjHasher::State::Mix(UInt64 lane, UInt64 word)
+{
+	lane += word * 0xC2B2AE3D27D4EB4FULL;
+	return Rotl(lane, 31) * 0x9E3779B185EBCA87ULL;
+}
+
+inline UInt64 ObjHasher::State::Load(const UChar* p)
+{
+	UInt64 word;
+	memcpy(&word, p, 8);
+	return word;
+}
+
+inline UInt64 ObjHasher::State::Rotl(UInt64 value, int bits)
+{
+	return value << bits | value >> (64 - bits);
+}
+
+inline UInt64 ObjHasher::State::Avalanche(UInt64 value)
+{
+	// MurmurHash3 finalizer
+	value ^= value >> 33;
+	value *= 0xFF51AFD7ED558CCDULL;
+	value ^= value >> 33;
+	value *= 0xC4CEB9FE1A85EC53ULL;
+	value ^= value >> 33;
+	return value;
+}
+
+inline ObjHasher::ObjHasher()
+	: m_stream_bytes(0), m_identity_proc(0)
+{
+}
+
+inline void ObjHasher::SetIdentityProc(IdentityProc proc)
+{
+	m_identity_proc = proc;
+	Clear();
+}
+
+inline bool ObjHasher::Hash(Obj obj, ContentHash& out_hash)
+{
+	if (obj.IsIndirect()) return HashIndirect(obj, 0, out_hash);
+	State state;
+	if (!HashContent(obj, state, 0)) return false;
+	out_hash = state.Finish();
+	return true;
+}
+
+inline bool ObjHasher::Equal(Obj a, Obj b)
+{
+	if (a.IsIndirect() && b.IsIndirect()) return EqualIndirect(a, b, 0);
+	return EqualContent(a, b, 0);
+}
+
+inline void ObjHasher::Clear()
+{
+	m_cache.clear();
+	m_active.clear();
+	m_equal.clear();
+	m_comparing.clear();
+}
+
+inline UInt64 ObjHasher::GetStreamBytesHashed() const
+{
+	return m_stream_bytes;
+}
+
+inline bool ObjHasher::HashIndirect(Obj obj, int depth, ContentHash& out_hash)
+{
+	UInt32 obj_num = obj.GetObjNum();
+	std::map<UInt32, Entry>::const_iterator itr = m_cache.find(obj_num);
+	if (itr != m_cache.end()) {
+		out_hash = itr->second.hash;
+		return itr->second.valid;
+	}
+
+	// a reference back to an object that is being hashed is a cycle
+	if (!m_active.insert(obj_num).second) return false;
+	State state;
+	Entry entry;
+	entry.valid = HashContent(obj, state, depth);
+	entry.hash = state.Finish();
+	m_active.erase(obj_num);
+
+	m_cache[obj_num] = entry;
+	out_hash = entry.hash;
+	return entry.valid;
+}
+
+inline bool ObjHasher::HashContent(Obj obj, State& state, int depth)
+{
+	if (depth > k_max_depth) return false;
+
+	switch (obj.GetType()) {
+	case Obj::e_null:
+		state.UpdateByte('n');
+		return true;
+	case Obj::e_bool:
+		state.UpdateByte('b');
+		state.UpdateByte(obj.GetBool() ? 1 : 0);
+		return true;
+	case Obj::e_number:
+		{
+			double value = obj.GetNumber();
+			if (value == 0) value = 0;	// -0 and 0 are the same number
+			UInt64 bits;
+			memcpy(&bits, &value, 8);
+			state.UpdateByte('d');
+			state.UpdateWord(bits);
+			return true;
+		}
+	case Obj::e_name:
+		{
+			const char* name = obj.GetName();
+			size_t size = strlen(name);
+			state.UpdateByte('/');
+			state.UpdateWord(size);
+			state.Update(name, size);
+			return true;
+		}
+	case Obj::e_string:
+		{
+			size_t size = obj.Size();
+			state.UpdateByte('(');
+			state.UpdateWord(size);
+			if (size) state.Update(obj.GetBuffer(), size);
+			return true;
+		}
+	case Obj::e_array:
+		{
+			size_t size = obj.Size();
+			state.UpdateByte('[');
+			state.UpdateWord(size);
+			for (size_t i = 0; i < size; ++i) {
+				if (!HashChild(obj.GetAt(i), state, depth)) return false;
+			}
+			return true;
+		}
+	case Obj::e_dict:
+		state.UpdateByte('<');
+		return HashEntries(obj, state, depth, false);
+	case Obj::e_stream:
+		state.UpdateByte('s');
+		if (!HashEntries(obj, state, depth, true)) return false;
+		HashStreamData(obj, state);
+		return true;
+	}
+	return false;
+}
+
+inline bool ObjHasher::HashChild(Obj obj, State& state, int depth)
+{
+	if (!obj.IsIndirect()) return HashContent(obj, state, depth + 1);
+
+	if (m_identity_proc && m_identity_proc(obj)) {
+		state.UpdateByte('I');
+		state.UpdateWord(obj.GetObjNum());
+		state.UpdateWord(obj.GetGenNum());
+		return true;
+	}
+
+	ContentHash hash;
+	if (!HashIndirect(obj, depth + 1, hash)) return false;
+	state.UpdateByte('R');
+	state.UpdateWord(hash.h1);
+	state.UpdateWord(hash.h2);
+	return true;
+}
+
+inline bool ObjHasher::HashEntries(Obj dict, State& state, int depth, bool is_stream)
+{
+	std::vector<std::pair<std::string, Obj> > entries;
+	GetEntries(dict, is_stream, entries);
+
+	state.UpdateWord(entries.size());
+	for (size_t i = 0; i < entries.size(); ++i) {
+		state.UpdateWord(entries[i].first.size());
+		state.Update(entries[i].first.data(), entries[i].first.size());
+		if (!HashChild(entries[i].second, state, depth)) return false;
+	}
+	return true;
+}
+
+inline void ObjHasher::GetEntries(Obj dict, bool is_stream, std::vector<std::pair<std::string, Obj> >& out_entries)
+{
+	for (DictIterator itr = dict.GetDictIterator(); itr.HasNext(); itr.Next()) {
+		const char* key = itr.Key().GetName();
+		// the length of the stream data is covered by the data itself
+		if (is_stream && !strcmp(key, "Length")) continue;
+		out_entries.push_back(std::make_pair(std::string(key), itr.Value()));
+	}
+	std::sort(out_entries.begin(), out_entries.end(), CompareKeys);
+}
+
+inline bool ObjHasher::CompareKeys(const std::pair<std::string, Obj>& lhs, const std::pair<std::string, Obj>& rhs)
+{
+	return lhs.first < rhs.first;
+}
+
+inline void ObjHasher::HashStreamData(Obj stream, State& state)
+{
+	if (m_buf.empty()) m_buf.resize(64 * 1024);
+
+	Filters::Filter filter = stream.GetRawStream(true);
+	Filters::FilterReader reader(filter);
+	UInt64 size = 0;
+	size_t read;
+	while ((read = reader.Read(&m_buf[0], m_buf.size())) > 0) {
+		state.Update(&m_buf[0], read);
+		size += read;
+	}
+	state.UpdateWord(size);
+	m_stream_bytes += size;
+}
+
+inline bool ObjHasher::EqualIndirect(Obj a, Obj b, int depth)
+{
+	UInt32 num_a = a.GetObjNum(), num_b = b.GetObjNum();
+	if (num_a == num_b) return true;
+	ObjPair key = num_a < num_b ? ObjPair(num_a, num_b) : ObjPair(num_b, num_a);
+	if (m_equal.count(key)) return true;
+
+	// comparing a pair again while it is being compared is a cycle
+	if (!m_comparing.insert(key).second) return false;
+	bool equal = EqualContent(a, b, depth);
+	m_comparing.erase(key);
+
+	if (equal) m_equal.insert(key);
+	return equal;
+}
+
+inline bool ObjHasher::EqualContent(Obj a, Obj b, int depth)
+{
+	if (depth > k_max_depth) return false;
+	if (a.GetType() != b.GetType()) return false;
+
+	switch (a.GetType()) {
+	case Obj::e_null:
+		return true;
+	case Obj::e_bool:
+		return a.GetBool() == b.GetBool();
+	case Obj::e_number:
+		return a.GetNumber() == b.GetNumber();
+	case Obj::e_name:
+		return !strcmp(a.GetName(), b.GetName());
+	case Obj::e_string:
+		{
+			size_t size = a.Size();
+			if (b.Size() != size) return false;
+			return !size || !memcmp(a.GetBuffer(), b.GetBuffer(), size);
+		}
+	case Obj::e_array:
+		{
+			size_t size = a.Size();
+			if (b.Size() != size) return false;
+			for (size_t i = 0; i < size; ++i) {
+				if (!EqualChild(a.GetAt(i), b.GetAt(i), depth)) return false;
+			}
+			return true;
+		}
+	case Obj::e_dict:
+		return EqualEntries(a, b, depth, false);
+	case Obj::e_stream:
+		return EqualEntries(a, b, depth, true) && EqualStreamData(a, b);
+	}
+	return false;
+}
+
+inline bool ObjHasher::EqualChild(Obj a, Obj b, int depth)
+{
+	if (a.IsIndirect() != b.IsIndirect()) return false;
+	if (!a.IsIndirect()) return EqualContent(a, b, depth + 1);
+
+	if (m_identity_proc && (m_identity_proc(a) || m_identity_proc(b))) {
+		return a.GetObjNum() == b.GetObjNum() && a.GetGenNum() == b.GetGenNum();
+	}
+	return EqualIndirect(a, b, depth + 1);
+}
+
+inline bool ObjHasher::EqualEntries(Obj a, Obj b, int depth, bool is_stream)
+{
+	std::vector<std::pair<std::string, Obj> > entries_a, entries_b;
+	GetEntries(a, is_stream, entries_a);
+	GetEntries(b, is_stream, entries_b);
+	if (entries_a.size() != entries_b.size()) return false;
+
+	for (size_t i = 0; i < entries_a.size(); ++i) {
+		if (entries_a[i].first != entries_b[i].first) return false;
+		if (!EqualChild(entries_a[i].second, entries_b[i].second, depth)) return false;
+	}
+	return true;
+}
+
+inline bool ObjHasher::EqualStreamData(Obj a, Obj b)
+{
+	if (m_buf.empty()) m_buf.resize(64 * 1024);
+	if (m_buf2.empty()) m_buf2.resize(64 * 1024);
+
+	Filters::Filter filter_a = a.GetRawStream(true);
+	Filters::Filter filter_b = b.GetRawStream(true);
+	Filters::FilterReader reader_a(filter_a);
+	Filters::FilterReader reader_b(filter_b);
+	for (;;) {
+		size_t read = ReadBlock(reader_a, &m_buf[0], m_buf.size());
+		if (ReadBlock(reader_b, &m_buf2[0], m_buf2.size()) != read) return false;
+		if (read && memcmp(&m_buf[0], &m_buf2[0], read)) return false;
+		if (read < m_buf.size()) return true;
+	}
+}
+
+inline size_t ObjHasher::ReadBlock(Filters::FilterReader& reader, UChar* buf, size_t size)
+{
+	// Read() may return less than requested before the end of the data
+	size_t total = 0;
+	size_t read;
+	while (total < size && (read = reader.Read(buf + total, size - total)) > 0) {
+		total += read;
+	}
+	return total;
+}
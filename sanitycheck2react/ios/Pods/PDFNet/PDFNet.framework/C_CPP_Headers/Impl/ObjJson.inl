@@ -0,0 +1,796 @@
+
+// Parses JSON into SDF objects. Each value is created directly in its
+// container (the root, a dictionary entry or the end of an array).
+class ObjJson::Parser
+{
+public:
+	Parser(const char* json, size_t size, SDFDoc* doc, ObjSet* set)
+		: m_begin(json), m_pos(json), m_end(json + size), mp_doc(doc), mp_set(set), mp_temp(0) {}
+
+	~Parser()
+	{
+		delete mp_temp;
+	}
+
+	bool ParseRoot(Obj& out_root)
+	{
+		SkipSpace();
+		if (m_pos >= m_end) return Fail("empty input");
+		if (!mp_doc && *m_pos != '{' && *m_pos != '[') return Fail("the JSON value must be an object or an array");
+		if (!ParseValue(Slot(e_root), 0, out_root)) return false;
+		SkipSpace();
+		if (m_pos != m_end) return Fail("unexpected data after the JSON value");
+		return true;
+	}
+
+	const std::string& GetError() const
+	{
+		return m_error;
+	}
+
+private:
+	enum { k_max_depth = 512 };
+
+	enum SlotType
+	{
+		e_root,
+		e_entry,
+		e_element
+	};
+
+	struct Slot
+	{
+		explicit Slot(SlotType t, Obj c = Obj(), const char* k = 0) : type(t), container(c), key(k) {}
+		SlotType type;
+		Obj container;
+		const char* key;
+	};
+
+	bool ParseValue(Slot slot, int depth, Obj& out_obj)
+	{
+		if (depth > k_max_depth) return Fail("the JSON is nested too deeply");
+		SkipSpace();
+		if (m_pos >= m_end) return Fail("unexpected end of input");
+		switch (*m_pos) {
+		case '{':
+			if (IsStreamObject()) return ParseStream(slot, depth, out_obj);
+			return MakeDict(slot, out_obj) && ParseEntries(out_obj, depth);
+		case '[':
+			return ParseArray(slot, depth, out_obj);
+		case '"':
+			return ParseStringValue(slot, out_obj);
+		case 't':
+			if (!Literal("true")) return false;
+			return StoreBool(slot, true, out_obj);
+		case 'f':
+			if (!Literal("false")) return false;
+			return StoreBool(slot, false, out_obj);
+		case 'n':
+			if (!Literal("null")) return false;
+			return StoreNull(slot, out_obj);
+		default:
+			return ParseNumber(slot, out_obj);
+		}
+	}
+
+	bool ParseEntries(Obj dict, int depth)
+	{
+		++m_pos;	// '{'
+		SkipSpace();
+		if (m_pos < m_end && *m_pos == '}') {
+			++m_pos;
+			return true;
+		}
+
+		std::string key;
+		for (;;) {
+			SkipSpace();
+			if (!ParseString(m_str)) return false;
+			ToLatin1(m_str, !m_str.empty() && m_str[0] == '/' ? 1 : 0, key);
+			SkipSpace();
+			if (!Expect(':')) return false;
+			Obj value;
+			if (!ParseValue(Slot(e_entry, dict, key.c_str()), depth + 1, value)) return false;
+			SkipSpace();
+			if (m_pos < m_end && *m_pos == ',') {
+				++m_pos;
+				continue;
+			}
+			return Expect('}');
+		}
+	}
+
+	bool ParseArray(Slot slot, int depth, Obj& out_obj)
+	{
+		if (!MakeArray(slot, out_obj)) return false;
+		++m_pos;	// '['
+		SkipSpace();
+		if (m_pos < m_end && *m_pos == ']') {
+			++m_pos;
+			return true;
+		}
+
+		for (;;) {
+			Obj value;
+			if (!ParseValue(Slot(e_element, out_obj), depth + 1, value)) return false;
+			SkipSpace();
+			if (m_pos < m_end && *m_pos == ',') {
+				++m_pos;
+				continue;
+			}
+			return Expect(']');
+		}
+	}
+
+	// Checks if the object at the current position starts with the key "stream".
+	bool IsStreamObject()
+	{
+		const char* start = m_pos;
+		++m_pos;
+		SkipSpace();
+		bool result = m_pos < m_end && *m_pos == '"' && ParseString(m_str) && m_str == "stream";
+		if (result) {
+			SkipSpace();
+			result = m_pos < m_end && *m_pos == ':';
+		}
+		m_pos = start;
+		m_error.clear();
+		return result;
+	}
+
+	bool ParseStream(Slot slot, int depth, Obj& out_obj)
+	{
+		if (!mp_doc) return Fail("streams can only be created in a document");
+		if (!mp_temp) mp_temp = new ObjSet();
+
+		// the entries are collected first, because the stream can only be
+		// created once its data is known
+		Obj dict = mp_temp->CreateDict();
+		std::string data;
+		bool has_data = false;
+
+		++m_pos;	// '{'
+		for (;;) {
+			SkipSpace();
+			if (!ParseString(m_str)) return false;
+			SkipSpace();
+			if (!Expect(':')) return false;
+			SkipSpace();
+			if (m_str == "stream") {
+				if (m_pos >= m_end || *m_pos != '{') return Fail("expected the stream dictionary");
+				if (!ParseEntries(dict, depth + 1)) return false;
+			}
+			else if (m_str == "data") {
+				if (!ParseString(m_str)) return false;
+				if (!DecodeBase64(m_str, data)) return Fail("invalid base64 stream data");
+				has_data = true;
+			}
+			else {
+				return Fail("unexpected key in a stream object");
+			}
+			SkipSpace();
+			if (m_pos < m_end && *m_pos == ',') {
+				++m_pos;
+				continue;
+			}
+			if (!Expect('}')) return false;
+			break;
+		}
+
+		Obj stream = mp_doc->CreateIndirectStream(data.data(), data.size());
+		for (DictIterator itr = dict.GetDictIterator(); itr.HasNext(); itr.Next()) {
+			const char* key = itr.Key().GetName();
+			if (!strcmp(key, "Length")) continue;
+			// without data, the stream is empty and is not encoded
+			if (!has_data && (!strcmp(key, "Filter") || !strcmp(key, "DecodeParms"))) continue;
+			stream.Put(key, itr.Value());
+		}
+		return StoreObj(slot, stream, out_obj);
+	}
+
+	bool ParseStringValue(Slot slot, Obj& out_obj)
+	{
+		if (!ParseString(m_str)) return false;
+
+		if (!m_str.empty() && m_str[0] == '/') {
+			ToLatin1(m_str, 1, m_bytes);
+			return StoreName(slot, m_bytes.c_str(), out_obj);
+		}
+		if (m_str.compare(0, 2, "s:") == 0) {
+			ToLatin1(m_str, 2, m_bytes);
+			return StoreString(slot, m_bytes, out_obj);
+		}
+		if (m_str.compare(0, 2, "u:") == 0) {
+			ToUTF16(m_str, 2, m_bytes);
+			return StoreString(slot, m_bytes, out_obj);
+		}
+
+		UInt32 obj_num, gen_num;
+		if (ParseRef(m_str, obj_num, gen_num)) {
+			if (!mp_doc) return Fail("references can only be resolved in a document");
+			if (obj_num == 0 || obj_num >= mp_doc->XRefSize()) return Fail("reference to a missing object");
+			return StoreObj(slot, mp_doc->GetObj(obj_num), out_obj);
+		}
+
+		// plain JSON text
+		size_t i = 0;
+		while (i < m_str.size() && (UChar)m_str[i] < 0x80) ++i;
+		if (i == m_str.size()) return StoreString(slot, m_str, out_obj);
+		ToUTF16(m_str, 0, m_bytes);
+		return StoreString(slot, m_bytes, out_obj);
+	}
+
+	bool ParseNumber(Slot slot, Obj& out_obj)
+	{
+		char buf[64];
+		size_t size = 0;
+		while (m_pos < m_end && size + 1 < sizeof(buf) && strchr("+-.0123456789eE", *m_pos) && *m_pos) {
+			buf[size++] = *m_pos++;
+		}
+		buf[size] = 0;
+		if (!size || (buf[0] != '-' && (buf[0] < '0' || buf[0] > '9'))) return Fail("unexpected character");
+
+		char* end = 0;
+		double value = strtod(buf, &end);
+		if (end != buf + size) return Fail("invalid number");
+		return StoreNumber(slot, value, out_obj);
+	}
+
+	// Decodes a JSON string to UTF-8.
+	bool ParseString(std::string& out)
+	{
+		if (m_pos >= m_end || *m_pos != '"') return Fail("expected a string");
+		++m_pos;
+		out.clear();
+
+		for (;;) {
+			const char* run = m_pos;
+			while (m_pos < m_end && *m_pos != '"' && *m_pos != '\\' && (UChar)*m_pos >= 0x20) ++m_pos;
+			out.append(run, m_pos - run);
+			if (m_pos >= m_end) return Fail("unterminated string");
+
+			char c = *m_pos++;
+			if (c == '"') return true;
+			if (c != '\\') return Fail("control character in a string");
+			if (m_pos >= m_end) return Fail("unterminated string");
+
+			c = *m_pos++;
+			switch (c) {
+			case '"': case '\\': case '/': out += c; break;
+			case 'b': out += '\b'; break;
+			case 'f': out += '\f'; break;
+			case 'n': out += '\n'; break;
+			case 'r': out += '\r'; break;
+			case 't': out += '\t'; break;
+			case 'u':
+				{
+					UInt32 cp;
+					if (!ParseHex4(cp)) return false;
+					if (cp >= 0xD800 && cp < 0xDC00) {
+						UInt32 low;
+						if (m_end - m_pos < 6 || m_pos[0] != '\\' || m_pos[1] != 'u') return Fail("invalid surrogate pair");
+						m_pos += 2;
+						if (!ParseHex4(low)) return false;
+						if (low < 0xDC00 || low >= 0xE000) return Fail("invalid surrogate pair");
+						cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+					}
+					else if (cp >= 0xDC00 && cp < 0xE000) {
+						return Fail("invalid surrogate pair");
+					}
+					AppendUTF8(cp, out);
+					break;
+				}
+			default:
+				return Fail("invalid escape sequence");
+			}
+		}
+	}
+
+	bool ParseHex4(UInt32& out)
+	{
+		if (m_end - m_pos < 4) return Fail("invalid \\u escape");
+		out = 0;
+		for (int i = 0; i < 4; ++i) {
+			char c = *m_pos++;
+			out <<= 4;
+			if (c >= '0' && c <= '9') out |= c - '0';
+			else if (c >= 'a' && c <= 'f') out |= c - 'a' + 10;
+			else if (c >= 'A' && c <= 'F') out |= c - 'A' + 10;
+			else return Fail("invalid \\u escape");
+		}
+		return true;
+	}
+
+	bool Literal(const char* literal)
+	{
+		size_t size = strlen(literal);
+		if ((size_t)(m_end - m_pos) < size || strncmp(m_pos, literal, size)) return Fail("unexpected character");
+		m_pos += size;
+		return true;
+	}
+
+	bool MakeDict(Slot slot, Obj& out_obj)
+	{
+		switch (slot.type) {
+		case e_root: out_obj = mp_doc ? mp_doc->CreateIndirectDict() : mp_set->CreateDict(); break;
+		case e_entry: out_obj = slot.container.PutDict(slot.key); break;
+		case e_element: out_obj = slot.container.PushBackDict(); break;
+		}
+		return true;
+	}
+
+	bool MakeArray(Slot slot, Obj& out_obj)
+	{
+		switch (slot.type) {
+		case e_root: out_obj = mp_doc ? mp_doc->CreateIndirectArray() : mp_set->CreateArray(); break;
+		case e_entry: out_obj = slot.container.PutArray(slot.key); break;
+		case e_element: out_obj = slot.container.PushBackArray(); break;
+		}
+		return true;
+	}
+
+	bool StoreNumber(Slot slot, double value, Obj& out_obj)
+	{
+		switch (slot.type) {
+		case e_root: out_obj = mp_doc->CreateIndirectNumber(value); break;
+		case e_entry: out_obj = slot.container.PutNumber(slot.key, value); break;
+		case e_element: out_obj = slot.container.PushBackNumber(value); break;
+		}
+		return true;
+	}
+
+	bool StoreBool(Slot slot, bool value, Obj& out_obj)
+	{
+		switch (slot.type) {
+		case e_root: out_obj = mp_doc->CreateIndirectBool(value); break;
+		case e_entry: out_obj = slot.container.PutBool(slot.key, value); break;
+		case e_element: out_obj = slot.container.PushBackBool(value); break;
+		}
+		return true;
+	}
+
+	bool StoreNull(Slot slot, Obj& out_obj)
+	{
+		switch (slot.type) {
+		case e_root: out_obj = mp_doc->CreateIndirectNull(); break;
+		case e_entry: slot.container.PutNull(slot.key); break;
+		case e_element: out_obj = slot.container.PushBackNull(); break;
+		}
+		return true;
+	}
+
+	bool StoreName(Slot slot, const char* name, Obj& out_obj)
+	{
+		switch (slot.type) {
+		case e_root: out_obj = mp_doc->CreateIndirectName(name); break;
+		case e_entry: out_obj = slot.container.PutName(slot.key, name); break;
+		case e_element: out_obj = slot.container.PushBackName(name); break;
+		}
+		return true;
+	}
+
+	bool StoreString(Slot slot, const std::string& value, Obj& out_obj)
+	{
+		switch (slot.type) {
+		case e_root: out_obj = mp_doc->CreateIndirectString((const UChar*)value.data(), (UInt32)value.size()); break;
+		case e_entry: out_obj = slot.container.PutString(slot.key, value.data(), (int)value.size()); break;
+		case e_element: out_obj = slot.container.PushBackString(value.data(), (int)value.size()); break;
+		}
+		return true;
+	}
+
+	bool StoreObj(Slot slot, Obj obj, Obj& out_obj)
+	{
+		switch (slot.type) {
+		case e_root: out_obj = obj; break;
+		case e_entry: out_obj = slot.container.Put(slot.key, obj); break;
+		case e_element: out_obj = slot.container.PushBack(obj); break;
+		}
+		return true;
+	}
+
+	void SkipSpace()
+	{
+		while (m_pos < m_end && (*m_pos == ' ' || *m_pos == '\t' || *m_pos == '\n' || *m_pos == '\r')) ++m_pos;
+	}
+
+	bool Expect(char c)
+	{
+		if (m_pos >= m_end || *m_pos != c) {
+			char message[32];
+			snprintf(message, sizeof(message), "expected '%c'", c);
+			return Fail(message);
+		}
+		++m_pos;
+		return true;
+	}
+
+	bool Fail(const char* message)
+	{
+		char offset[32];
+		snprintf(offset, sizeof(offset), " at offset %lu", (unsigned long)(m_pos - m_begin));
+		m_error = message;
+		m_error += offset;
+		return false;
+	}
+
+	static void AppendUTF8(UInt32 cp, std::string& out)
+	{
+		if (cp < 0x80) {
+			out += (char)cp;
+		}
+		else if (cp < 0x800) {
+			out += (char)(0xC0 | (cp >> 6));
+			out += (char)(0x80 | (cp & 0x3F));
+		}
+		else if (cp < 0x10000) {
+			out += (char)(0xE0 | (cp >> 12));
+			out += (char)(0x80 | ((cp >> 6) & 0x3F));
+			out += (char)(0x80 | (cp & 0x3F));
+		}
+		else {
+			out += (char)(0xF0 | (cp >> 18));
+			out += (char)(0x80 | ((cp >> 12) & 0x3F));
+			out += (char)(0x80 | ((cp >> 6) & 0x3F));
+			out += (char)(0x80 | (cp & 0x3F));
+		}
+	}
+
+	// Decodes the UTF-8 sequence at 'pos'. Invalid bytes are returned as
+	// code points U+0080..U+00FF.
+	static UInt32 NextCodePoint(const std::string& str, size_t& pos)
+	{
+		UChar c = (UChar)str[pos++];
+		int extra = c >= 0xF0 && c < 0xF8 ? 3 : (c >= 0xE0 ? 2 : (c >= 0xC0 ? 1 : 0));
+		if (c < 0x80 || !extra || c >= 0xF8 || pos + extra > str.size()) return c;
+
+		UInt32 cp = c & (0x3F >> extra);
+		for (int i = 0; i < extra; ++i) {
+			UChar next = (UChar)str[pos + i];
+			if ((next & 0xC0) != 0x80) return c;
+			cp = cp << 6 | (next & 0x3F);
+		}
+		pos += extra;
+		return cp;
+	}
+
+	// Converts code points U+0000..U+00FF to bytes. Larger code points are
+	// kept as UTF-8.
+	static void ToLatin1(const std::string& str, size_t offset, std::string& out)
+	{
+		out.clear();
+		for (size_t pos = offset; pos < str.size(); ) {
+			size_t start = pos;
+			UInt32 cp = NextCodePoint(str, pos);
+			if (cp < 0x100) out += (char)cp;
+			else out.append(str, start, pos - start);
+		}
+	}
+
+	// Converts UTF-8 to a PDF text string (UTF-16BE with a byte order mark).
+	static void ToUTF16(const std::string& str, size_t offset, std::string& out)
+	{
+		out.assign("\xFE\xFF", 2);
+		for (size_t pos = offset; pos < str.size(); ) {
+			UInt32 cp = NextCodePoint(str, pos);
+			if (cp >= 0x10000) {
+				cp -= 0x10000;
+				UInt32 high = 0xD800 + (cp >> 10), low = 0xDC00 + (cp & 0x3FF);
+				out += (char)(high >> 8);
+				out += (char)(high & 0xFF);
+				out += (char)(low >> 8);
+				out += (char)(low & 0xFF);
+			}
+			else {
+				out += (char)(cp >> 8);
+				out += (char)(cp & 0xFF);
+			}
+		}
+	}
+
+	// Parses "<obj_num> <gen_num> R".
+	static bool ParseRef(const std::string& str, UInt32& obj_num, UInt32& gen_num)
+	{
+		size_t pos = 0;
+		if (!ParseUInt(str, pos, obj_num) || pos >= str.size() || str[pos++] != ' ') return false;
+		if (!ParseUInt(str, pos, gen_num) || pos >= str.size() || str[pos++] != ' ') return false;
+		return pos + 1 == str.size() && str[pos] == 'R';
+	}
+
+	static bool ParseUInt(const std::string& str, size_t& pos, UInt32& out)
+	{
+		size_t start = pos;
+		UInt64 value = 0;
+		while (pos < str.size() && str[pos] >= '0' && str[pos] <= '9' && pos - start < 10) {
+			value = value * 10 + (str[pos++] - '0');
+		}
+		out = (UInt32)value;
+		return pos > start && value <= 0xFFFFFFFFULL;
+	}
+
+	static bool DecodeBase64(const std::string& in, std::string& out)
+	{
+		out.clear();
+		out.reserve(in.size() / 4 * 3);
+		UInt32 bits = 0;
+		int num_bits = 0;
+		size_t pos = 0;
+		for (; pos < in.size() && in[pos] != '='; ++pos) {
+			char c = in[pos];
+			int value;
+			if (c >= 'A' && c <= 'Z') value = c - 'A';
+			else if (c >= 'a' && c <= 'z') value = c - 'a' + 26;
+			else if (c >= '0' && c <= '9') value = c - '0' + 52;
+			else if (c == '+') value = 62;
+			else if (c == '/') value = 63;
+			else return false;
+			bits = bits << 6 | value;
+			num_bits += 6;
+			if (num_bits >= 8) {
+				num_bits -= 8;
+				out += (char)((bits >> num_bits) & 0xFF);
+			}
+		}
+		for (; pos < in.size(); ++pos) {
+			if (in[pos] != '=') return false;
+		}
+		return true;
+	}
+
+	const char* m_begin;
+	const char* m_pos;
+	const char* m_end;
+	SDFDoc* mp_doc;
+	ObjSet* mp_set;
+	ObjSet* mp_temp;
+	std::string m_str;
+	std::string m_bytes;
+	std::string m_error;
+};
+
+inline void ObjJson::Write(Obj obj, std::string& out, UInt32 flags)
+{
+	std::vector<UChar> buf;
+	WriteValue(obj, out, flags, true, buf);
+}
+
+inline std::string ObjJson::ToJson(Obj obj, UInt32 flags)
+{
+	std::string out;
+	Write(obj, out, flags);
+	return out;
+}
+
+inline Obj ObjJson::Parse(ObjSet& set, const char* json, size_t size)
+{
+	Parser parser(json, size, 0, &set);
+	Obj result;
+	if (!parser.ParseRoot(result)) {
+		PDFTRON_THROW(Common::Exception("ParseRoot", __LINE__, __FILE__, "ObjJson::Parse", parser.GetError().c_str()));
+		return Obj();
+	}
+	return result;
+}
+
+inline Obj ObjJson::Parse(SDFDoc& doc, const char* json, size_t size)
+{
+	Parser parser(json, size, &doc, 0);
+	Obj result;
+	if (!parser.ParseRoot(result)) {
+		PDFTRON_THROW(Common::Exception("ParseRoot", __LINE__, __FILE__, "ObjJson::Parse", parser.GetError().c_str()));
+		return Obj();
+	}
+	return result;
+}
+
+inline void ObjJson::WriteValue(Obj obj, std::string& out, UInt32 flags, bool top_level, std::vector<UChar>& buf)
+{
+	if (!obj) {
+		out += "null";
+		return;
+	}
+	if (!top_level && obj.IsIndirect()) {
+		char ref[32];
+		snprintf(ref, sizeof(ref), "\"%u %u R\"", (unsigned)obj.GetObjNum(), (unsigned)obj.GetGenNum());
+		out += ref;
+		return;
+	}
+
+	switch (obj.GetType()) {
+	case Obj::e_null:
+		out += "null";
+		break;
+	case Obj::e_bool:
+		out += obj.GetBool() ? "true" : "false";
+		break;
+	case Obj::e_number:
+		WriteNumber(obj.GetNumber(), out);
+		break;
+	case Obj::e_name:
+		{
+			const char* name = obj.GetName();
+			WriteBytes("/", (const UChar*)name, strlen(name), out, flags);
+			break;
+		}
+	case Obj::e_string:
+		{
+			size_t size = obj.Size();
+			const UChar* data = size ? obj.GetBuffer() : 0;
+			bool is_text = size >= 2 && data[0] == 0xFE && data[1] == 0xFF;
+			if (!is_text || !WriteUTF16(data + 2, size - 2, out, flags)) {
+				WriteBytes("s:", data, size, out, flags);
+			}
+			break;
+		}
+	case Obj::e_array:
+		{
+			size_t size = obj.Size();
+			out += '[';
+			for (size_t i = 0; i < size; ++i) {
+				if (i) out += ',';
+				WriteValue(obj.GetAt(i), out, flags, false, buf);
+			}
+			out += ']';
+			break;
+		}
+	case Obj::e_dict:
+	case Obj::e_stream:
+		{
+			bool is_stream = obj.IsStream();
+			out += is_stream ? "{\"stream\":{" : "{";
+			bool first = true;
+			for (DictIterator itr = obj.GetDictIterator(); itr.HasNext(); itr.Next()) {
+				if (!first) out += ',';
+				first = false;
+				const char* key = itr.Key().GetName();
+				WriteBytes("/", (const UChar*)key, strlen(key), out, flags);
+				out += ':';
+				WriteValue(itr.Value(), out, flags, false, buf);
+			}
+			out += '}';
+			if (is_stream) {
+				if (flags & e_stream_data) {
+					out += ",\"data\":\"";
+					WriteStreamData(obj, out, buf);
+					out += '"';
+				}
+				out += '}';
+			}
+			break;
+		}
+	}
+}
+
+inline void ObjJson::WriteNumber(double value, std::string& out)
+{
+	char buf[32];
+	if (value != value || value - value != 0) {
+		out += '0';	// NaN or infinity, which PDF cannot represent either
+		return;
+	}
+	if (value == floor(value) && fabs(value) < 1e15) {
+		snprintf(buf, sizeof(buf), "%.0f", value);
+	}
+	else {
+		// the shortest representation that parses back to the same value
+		for (int precision = 15; precision <= 17; ++precision) {
+			snprintf(buf, sizeof(buf), "%.*g", precision, value);
+			if (strtod(buf, 0) == value) break;
+		}
+	}
+	out += buf;
+}
+
+inline void ObjJson::WriteBytes(const char* prefix, const UChar* data, size_t size, std::string& out, UInt32 flags)
+{
+	out += '"';
+	out += prefix;
+	for (size_t i = 0; i < size; ++i) {
+		UChar c = data[i];
+		if (c >= 0x20 && c < 0x80 && c != '"' && c != '\\') out += (char)c;
+		else WriteCodePoint(c, out, flags);
+	}
+	out += '"';
+}
+
+inline bool ObjJson::WriteUTF16(const UChar* data, size_t size, std::string& out, UInt32 flags)
+{
+	if (size % 2) return false;
+	size_t mark = out.size();
+	out += "\"u:";
+	for (size_t i = 0; i < size; i += 2) {
+		UInt32 cp = (UInt32)data[i] << 8 | data[i + 1];
+		if (cp >= 0xD800 && cp < 0xDC00 && i + 3 < size) {
+			UInt32 low = (UInt32)data[i + 2] << 8 | data[i + 3];
+			if (low >= 0xDC00 && low < 0xE000) {
+				cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+				i += 2;
+			}
+		}
+		if (cp >= 0xD800 && cp < 0xE000) {
+			// unpaired surrogate; the caller writes the bytes instead
+			out.resize(mark);
+			return false;
+		}
+		WriteCodePoint(cp, out, flags);
+	}
+	out += '"';
+	return true;
+}
+
+inline void ObjJson::WriteCodePoint(UInt32 cp, std::string& out, UInt32 flags)
+{
+	switch (cp) {
+	case '"': out += "\\\""; return;
+	case '\\': out += "\\\\"; return;
+	case '\b': out += "\\b"; return;
+	case '\f': out += "\\f"; return;
+	case '\n': out += "\\n"; return;
+	case '\r': out += "\\r"; return;
+	case '\t': out += "\\t"; return;
+	}
+
+	char buf[16];
+	if (cp < 0x20 || (cp >= 0x80 && (flags & e_ascii))) {
+		if (cp >= 0x10000) {
+			cp -= 0x10000;
+			snprintf(buf, sizeof(buf), "\\u%04x\\u%04x", (unsigned)(0xD800 + (cp >> 10)), (unsigned)(0xDC00 + (cp & 0x3FF)));
+		}
+		else {
+			snprintf(buf, sizeof(buf), "\\u%04x", (unsigned)cp);
+		}
+		out += buf;
+	}
+	else if (cp < 0x80) {
+		out += (char)cp;
+	}
+	else if (cp < 0x800) {
+		out += (char)(0xC0 | (cp >> 6));
+		out += (char)(0x80 | (cp & 0x3F));
+	}
+	else if (cp < 0x10000) {
+		out += (char)(0xE0 | (cp >> 12));
+		out += (char)(0x80 | ((cp >> 6) & 0x3F));
+		out += (char)(0x80 | (cp & 0x3F));
+	}
+	else {
+		out += (char)(0xF0 | (cp >> 18));
+		out += (char)(0x80 | ((cp >> 12) & 0x3F));
+		out += (char)(0x80 | ((cp >> 6) & 0x3F));
+		out += (char)(0x80 | (cp & 0x3F));
+	}
+}
+
+inline void ObjJson::WriteStreamData(Obj stream, std::string& out, std::vector<UChar>& buf)
+{
+	static const char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+	if (buf.empty()) buf.resize(48 * 1024);	// a multiple of 3
+
+	Filters::Filter filter = stream.GetRawStream(true);
+	Filters::FilterReader reader(filter);
+	UChar group[3];
+	size_t group_size = 0;
+	size_t read;
+	while ((read = reader.Read(&buf[0], buf.size())) > 0) {
+		for (size_t i = 0; i < read; ++i) {
+			group[group_size++] = buf[i];
+			if (group_size < 3) continue;
+			out += alphabet[group[0] >> 2];
+			out += alphabet[(group[0] & 0x03) << 4 | group[1] >> 4];
+			out += alphabet[(group[1] & 0x0F) << 2 | group[2] >> 6];
+			out += alphabet[group[2] & 0x3F];
+			group_size = 0;
+		}
+	}
+	if (group_size == 1) {
+		out += alphabet[group[0] >> 2];
+		out += alphabet[(group[0] & 0x03) << 4];
+		out += "==";
+	}
+	else if (group_size == 2) {
+		out += alphabet[group[0] >> 2];
+		out += alphabet[(group[0] & 0x03) << 4 | group[1] >> 4];
+		out += alphabet[(group[1] & 0x0F) << 2];
+		out += '=';
+	}
+}
@@ -27,8 +27,8 @@ namespace pdftron {
 	}
 
 	inline std::vector<unsigned char> PDFACompliance::SaveAs(bool linearized){
-		size_t size;
-		char* buf;
+		size_t size = 0;
+		char* buf = 0;
 		std::vector<unsigned char> result;
 		REX(TRN_PDFAComplianceSaveAsFromBuffer(mp_pdfac, (const char**)&buf, &size, BToTB(linearized)));
 		result.resize(size);
@@ -43,7 +43,7 @@ namespace pdftron {
 #endif
 
 	inline size_t PDFACompliance::GetErrorCount(){
-			int result;
+			int result = 0;
 			REX(TRN_PDFAComplianceGetErrorCount(mp_pdfac, &result));
 			return (size_t)result;
 	}
@@ -56,20 +56,20 @@ namespace pdftron {
 
 	inline size_t PDFACompliance::GetRefObjCount(ErrorCode id)
 	{
-			int result;
+			int result = 0;
 			REX(TRN_PDFAComplianceGetRefObjCount(mp_pdfac, (enum TRN_PDFAComplianceErrorCode)id, &result));
 			return (size_t)result;
 	}
 
 	inline size_t PDFACompliance::GetRefObj(ErrorCode id, size_t err_idx){
-			int result;
+			int result = 0;
 			REX(TRN_PDFAComplianceGetRefObj(mp_pdfac, (enum TRN_PDFAComplianceErrorCode)id, (int)err_idx, &result));
 			return (size_t)result;
 	}
 
 	inline const char* PDFACompliance::GetPDFAErrorMessage(ErrorCode id)
 	{
-		const char* result;
+		const char* result = 0;
 		REX(TRN_PDFAComplianceGetPDFAErrorMessage((enum TRN_PDFAComplianceErrorCode)id, &result));
 		return result;
 	}
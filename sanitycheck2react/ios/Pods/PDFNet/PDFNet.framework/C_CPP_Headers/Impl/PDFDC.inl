@@ -1,5 +1,5 @@
 
-inline PDFDC::PDFDC()
+inline PDFDC::PDFDC() : m_pdfdc(0)
 {
 	REX(TRN_PDFDcCreate(&m_pdfdc));
 }
@@ -17,7 +17,7 @@ inline void PDFDC::Destroy()
 
 inline HDC PDFDC::Begin( Page in_page, const Rect in_bbox, bool in_preserveAspectRatio )
 {
-	HDC result;
+	HDC result = 0;
 	REX(TRN_PDFDcBegin (m_pdfdc, in_page.mp_page, (const TRN_Rect)in_bbox, in_preserveAspectRatio, &result));
 	return result;
 }
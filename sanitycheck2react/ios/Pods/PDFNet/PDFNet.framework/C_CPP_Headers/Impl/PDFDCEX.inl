@@ -1,6 +1,6 @@
 
 
-inline PDFDCEX::PDFDCEX()
+inline PDFDCEX::PDFDCEX() : m_pdfDcEx(0)
 {
 	REX(TRN_PDFDCEXCreate(&m_pdfDcEx));
 }
@@ -18,7 +18,7 @@ inline void PDFDCEX::Destroy()
 
 inline HDC PDFDCEX::Begin(PDFDoc & in_pdfdoc, const Point& page_dimension)
 {
-	HDC result;
+	HDC result = 0;
 	REX(TRN_PDFDCEXBegin(m_pdfDcEx, in_pdfdoc.mp_doc, (const TRN_Point*)&page_dimension, &result));
 	return result;
 }
@@ -26,18 +26,18 @@ namespace pdftron {
 // Bookmark --------------------------------------------------------
 
 inline Bookmark Bookmark::Create(PDFDoc& in_doc, const UString& in_title) {
-	TRN_Bookmark result;
+	TRN_Bookmark result = 0;
 	REX(TRN_BookmarkCreate(in_doc.mp_doc,in_title.mp_impl,&result));
 	return Bookmark(result);
 }
 
 inline Bookmark::Bookmark() : mp_obj(0) {}
 
-inline Bookmark::Bookmark(SDF::Obj in_bookmark_dict) {
+inline Bookmark::Bookmark(SDF::Obj in_bookmark_dict) : mp_obj(0) {
 	REX(TRN_BookmarkCreateFromObj(in_bookmark_dict.mp_obj,&mp_obj));
 }
 
-inline Bookmark::Bookmark(const Bookmark& in_bookmark) {
+inline Bookmark::Bookmark(const Bookmark& in_bookmark) : mp_obj(0) {
 	REX(TRN_BookmarkCopy(in_bookmark.mp_obj,&mp_obj));
 }
 
@@ -47,61 +47,61 @@ inline Bookmark& Bookmark::operator=(const Bookmark& in_bookmark) {
 }
 
 inline bool Bookmark::operator==(const Bookmark& in_bookmark) {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_BookmarkCompare(mp_obj,in_bookmark.mp_obj,&result));
 	return TBToB(result);
 }
 
 inline bool Bookmark::IsValid() const {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_BookmarkIsValid(mp_obj, &result));
 	return TBToB(result);
 }
 
 inline bool Bookmark::HasChildren() {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_BookmarkHasChildren(mp_obj, &result));
 	return TBToB(result);
 }
 
 inline Bookmark Bookmark::GetNext() {
-	TRN_Bookmark result;
+	TRN_Bookmark result = 0;
 	REX(TRN_BookmarkGetNext(mp_obj, &result));
 	return Bookmark(result);
 }
 
 inline Bookmark Bookmark::GetPrev() {
-	TRN_Bookmark result;
+	TRN_Bookmark result = 0;
 	REX(TRN_BookmarkGetPrev(mp_obj, &result))
 	return Bookmark(result);
 }
 
 inline Bookmark Bookmark::GetFirstChild() {
-	TRN_Bookmark result;
+	TRN_Bookmark result = 0;
 	REX(TRN_BookmarkGetFirstChild(mp_obj, &result));
 	return Bookmark(result);
 }
 
 inline Bookmark Bookmark::GetLastChild() {
-	TRN_Bookmark result;
+	TRN_Bookmark result = 0;
 	REX(TRN_BookmarkGetLastChild(mp_obj, &result));
 	return Bookmark(result);
 }
 
 inline Bookmark Bookmark::GetParent() {
-	TRN_Bookmark result;
+	TRN_Bookmark result = 0;
 	REX(TRN_BookmarkGetParent(mp_obj, &result));
 	return Bookmark(result);
 }
 
 inline Bookmark Bookmark::Find(const UString& in_title) {
-	TRN_Bookmark result;
+	TRN_Bookmark result = 0;
 	REX(TRN_BookmarkFind(mp_obj, in_title.mp_impl,&result))
 	return Bookmark(result);
 }
 
 inline Bookmark Bookmark::AddChild(const UString& in_title) {
-	TRN_Bookmark result;
+	TRN_Bookmark result = 0;
 	REX(TRN_BookmarkAddNewChild(mp_obj, in_title.mp_impl,&result));
 	return Bookmark(result);
 }
@@ -112,7 +112,7 @@ inline Bookmark Bookmark::AddChild(Bookmark in_bookmark) {
 }
 
 inline Bookmark Bookmark::AddNext(const UString& in_title) {
-	TRN_Bookmark result;
+	TRN_Bookmark result = 0;
 	REX(TRN_BookmarkAddNewNext(mp_obj, in_title.mp_impl,&result));
 	return Bookmark(result);
 }
@@ -122,7 +122,7 @@ inline void Bookmark::AddNext(Bookmark in_bookmark) {
 }
 
 inline Bookmark Bookmark::AddPrev(const UString& in_title) {
-	TRN_Bookmark result;
+	TRN_Bookmark result = 0;
 	REX(TRN_BookmarkAddNewPrev(mp_obj,in_title.mp_impl,&result));
 	return Bookmark(result);
 }
@@ -140,13 +140,13 @@ inline void Bookmark::Unlink() {
 }
 
 inline int Bookmark::GetIndent() {
-	int result;
+	int result = 0;
 	REX(TRN_BookmarkGetIndent(mp_obj, &result));
 	return result;
 }
 
 inline bool Bookmark::IsOpen() {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_BookmarkIsOpen(mp_obj,&result));
 	return TBToB(result);
 }
@@ -156,19 +156,19 @@ inline void Bookmark::SetOpen(bool in_open) {
 }
 
 inline int Bookmark::GetOpenCount() {
-	int result;
+	int result = 0;
 	REX(TRN_BookmarkGetOpenCount(mp_obj, &result));
 	return result;
 }
 
 inline UString Bookmark::GetTitle() {
-	TRN_UString result;
+	TRN_UString result = 0;
 	REX(TRN_BookmarkGetTitle(mp_obj, &result));
 	return UString(result);
 }
 
 inline SDF::Obj Bookmark::GetTitleObj() {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_BookmarkGetTitleObj(mp_obj, &result));
 	return SDF::Obj(result);
 }
@@ -178,7 +178,7 @@ inline void Bookmark::SetTitle(const UString& title) {
 }
 
 inline Action Bookmark::GetAction() {
-	TRN_Action result;
+	TRN_Action result = 0;
 	REX(TRN_BookmarkGetAction(mp_obj, &result));
 	return Action(result);
 }
@@ -192,7 +192,7 @@ inline void Bookmark::RemoveAction() {
 }
 
 inline int Bookmark::GetFlags() {
-	int result;
+	int result = 0;
 	REX(TRN_BookmarkGetFlags(mp_obj,&result));
 	return result;
 }
@@ -202,9 +202,9 @@ inline void Bookmark::SetFlags(int in_flags) {
 }
 
 inline std::vector<double> Bookmark::GetColor() {
-	double out_r;
-	double out_g;
-	double out_b;
+	double out_r = 0;
+	double out_g = 0;
+	double out_b = 0;
 	std::vector<double> arr(3); 
 	REX(TRN_BookmarkGetColor(mp_obj, &out_r,&out_g,&out_b));
 	arr[0] = out_r;
@@ -224,7 +224,7 @@ inline void Bookmark::SetColor(double in_r, double in_g, double in_b) {
 }
 
 inline SDF::Obj Bookmark::GetSDFObj() const {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_BookmarkGetSDFObj(mp_obj,&result));
 	return SDF::Obj(result);
 }
@@ -244,16 +244,16 @@ inline ptrdiff_t Bookmark::GetHandleInternal() {
 
 // PDFDoc --------------------------------------------------------
 
-inline PDFDoc::PDFDoc () {
+inline PDFDoc::PDFDoc () : mp_doc(0) {
 	REX(TRN_PDFDocCreate(&mp_doc));
 }
 
-inline PDFDoc::PDFDoc (SDF::SDFDoc& sdfdoc) {
+inline PDFDoc::PDFDoc (SDF::SDFDoc& sdfdoc) : mp_doc(0) {
 	REX(TRN_PDFDocCreateFromSDFDoc(sdfdoc.mp_doc,&mp_doc));
 }
 
-inline PDFDoc::PDFDoc(const PDFDoc& other) {
-	REX(TRN_PDFDocCreateShallowCopy(other.mp_doc, &mp_doc));
+inline PDFDoc::PDFDoc(const PDFDoc& other) : mp_doc(0) {
+	if (other.mp_doc) REX(TRN_PDFDocCreateShallowCopy(other.mp_doc, &mp_doc));
 }
 
 inline PDFDoc& PDFDoc::operator =(const PDFDoc& other) {
@@ -268,23 +268,72 @@ inline PDFDoc& PDFDoc::operator =(const PDFDoc& other) {
 	return *this;
 }
 
+#ifdef PDFTRON_CPP11
+inline PDFDoc::PDFDoc(PDFDoc&& other) noexcept : mp_doc(other.mp_doc)
+{
+	other.mp_doc = 0;
+}
+
+inline PDFDoc& PDFDoc::operator=(PDFDoc&& other) noexcept
+{
+	std::swap(mp_doc, other.mp_doc);
+	return *this;
+}
+#endif
+
 
-inline PDFDoc::PDFDoc (const UString& filepath) {
+inline PDFDoc::PDFDoc (const UString& filepath) : mp_doc(0) {
 	REX(TRN_PDFDocCreateFromUFilePath(filepath.mp_impl,&mp_doc));
 }
 
-inline PDFDoc::PDFDoc (const char* filepath) {
+inline PDFDoc::PDFDoc (const char* filepath) : mp_doc(0) {
 	REX(TRN_PDFDocCreateFromFilePath(filepath,&mp_doc));
 }
 
-inline PDFDoc::PDFDoc (Filters::Filter stream) 
+inline PDFDoc::PDFDoc (const UString& filepath, UInt32 open_flags, OpenStats* out_stats) : mp_doc(0) {
+#ifdef PDFTRON_CPP11
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+#endif
+	size_t file_size = 0;
+	if (open_flags & e_open_mapped) {
+		Filters::MappedFile file(filepath);
+		file_size = file.FileSize();
+		file.m_owner = false;
+		REX(TRN_PDFDocCreateFromFilter(file.m_impl,&mp_doc));
+		file.m_impl = 0;
+	}
+	else {
+		REX(TRN_PDFDocCreateFromUFilePath(filepath.mp_impl,&mp_doc));
+	}
+
+	PDFTRON_TRY {
+		if (open_flags & e_open_no_disk_cache) {
+			GetSDFDoc().EnableDiskCaching(false);
+		}
+		if (out_stats) {
+			out_stats->file_size = file_size;
+			out_stats->linearized = IsLinearized();
+#ifdef PDFTRON_CPP11
+			out_stats->open_time_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+#else
+			out_stats->open_time_ms = -1;
+#endif
+		}
+	}
+	PDFTRON_CATCH(...) {
+		DREX(mp_doc, TRN_PDFDocDestroy(mp_doc));
+		PDFTRON_RETHROW;
+	}
+}
+
+inline PDFDoc::PDFDoc (Filters::Filter stream) : mp_doc(0) 
 {
 	stream.m_owner = false;
 	REX(TRN_PDFDocCreateFromFilter(stream.m_impl,&mp_doc));
 	stream.m_impl = 0;  
 }
 
-inline PDFDoc::PDFDoc (const UChar* buf, size_t buf_size) {
+inline PDFDoc::PDFDoc (const UChar* buf, size_t buf_size) : mp_doc(0) {
 	REX(TRN_PDFDocCreateFromBuffer((const char*)buf,buf_size,&mp_doc));
 }
 
@@ -298,7 +347,7 @@ inline void PDFDoc::Close () {
 }
 
 inline bool PDFDoc::IsEncrypted() {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_PDFDocIsEncrypted(mp_doc, &result));
 	return TBToB(result);
 }
@@ -313,33 +362,33 @@ inline bool PDFDoc::InitSecurityHandler (
 #ifndef SWIG
 	c = custom_data;
 #endif	
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_PDFDocInitSecurityHandler(mp_doc, c, &result));
 	return TBToB(result);
 }
 
 inline bool PDFDoc::InitStdSecurityHandler (const char* password, int password_sz) {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_PDFDocInitStdSecurityHandler(mp_doc,password,password_sz,&result));
 	return TBToB(result);
 }
 
 inline bool PDFDoc::InitStdSecurityHandler(const pdftron::UString& password)
 {
-    TRN_Bool result;
+    TRN_Bool result = 0;
     REX(TRN_PDFDocInitStdSecurityHandlerUString(mp_doc, password.mp_impl, &result));
     return TBToB(result);
 }
 
 inline bool PDFDoc::InitStdSecurityHandler(const std::vector<UInt8>& password_buf)
 {
-    TRN_Bool result;
+    TRN_Bool result = 0;
     REX(TRN_PDFDocInitStdSecurityHandlerBuffer(mp_doc, &(password_buf[0]), password_buf.size(), &result));
     return TBToB(result);
 }
 
 inline SDF::SecurityHandler PDFDoc::GetSecurityHandler () {
-	TRN_SecurityHandler result;
+	TRN_SecurityHandler result = 0;
 	REX(TRN_PDFDocGetSecurityHandler(mp_doc, &result));
 
 	void* derived = 0;
@@ -379,14 +428,14 @@ inline void PDFDoc::SetSecurityHandler (SDF::SecurityHandler handler) {
 
 inline bool PDFDoc::HasSignatures()
 {
-    TRN_Bool hasSig;
+    TRN_Bool hasSig = 0;
     REX(TRN_PDFDocHasSignatures(mp_doc, &hasSig));
     return (TBToB(hasSig));
 }
         
 inline bool PDFDoc::HasDownloader()
 {
-    TRN_Bool hasDown;
+    TRN_Bool hasDown = 0;
     REX(TRN_PDFDocHasDownloader(mp_doc, &hasDown));
     return (TBToB(hasDown));
 }
@@ -403,7 +452,8 @@ inline SDF::SignatureHandlerId PDFDoc::AddSignatureHandler(const SDF::SignatureH
                                 (void*) owned_handler, &sigHandler));
     if (sigHandler == NULL) {
         delete (owned_handler); // important!
-        throw (Common::Exception("Error", 0, "PDFDoc.h", "PDFDoc::AddSignatureHandler", "Failed to add SignatureHandler."));
+        PDFTRON_THROW(Common::Exception("Error", 0, "PDFDoc.h", "PDFDoc::AddSignatureHandler", "Failed to add SignatureHandler."));
+        return 0;
     }
     TRN_SignatureHandlerId result = 0;
     REX(TRN_PDFDocAddSignatureHandler(mp_doc, sigHandler, &result));
@@ -431,7 +481,7 @@ inline void PDFDoc::RemoveSignatureHandler(const SDF::SignatureHandlerId signatu
 
 inline SDF::SignatureHandler* PDFDoc::GetSignatureHandler(const SDF::SignatureHandlerId signature_handler_id)
 {
-    TRN_SignatureHandler sigHandler;
+    TRN_SignatureHandler sigHandler = 0;
     REX(TRN_PDFDocGetSignatureHandler(mp_doc, (const TRN_SignatureHandlerId) signature_handler_id, &sigHandler));
     if (sigHandler == NULL) return (NULL);
     SDF::SignatureHandler* result = NULL;
@@ -440,19 +490,19 @@ inline SDF::SignatureHandler* PDFDoc::GetSignatureHandler(const SDF::SignatureHa
 }
 
 inline bool PDFDoc::IsModified () const {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_PDFDocIsModified(mp_doc,&result));
 	return TBToB(result);
 }
 
 inline bool PDFDoc::HasRepairedXRef() const {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_PDFDocHasRepairedXRef(mp_doc, &result));
 	return TBToB(result);
 }
 
 inline bool PDFDoc::IsLinearized() const {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_PDFDocIsLinearized(mp_doc,&result));
 	return TBToB(result);
 }
@@ -468,13 +518,10 @@ inline void PDFDoc::Save(const UString& path, UInt32 flags, Common::ProgressMoni
 #endif
 
 inline std::vector<unsigned char> PDFDoc::Save(UInt32 flags) {
-	size_t size;
-	char* buf;
-	std::vector<unsigned char> result;
+	size_t size = 0;
+	char* buf = 0;
 	REX(TRN_PDFDocSaveMemoryBuffer(mp_doc, flags, (const char**)&buf, &size));
-	result.resize(size);
-	memcpy(&result[0], buf, size);
-	return result;
+	return std::vector<unsigned char>((unsigned char*)buf, (unsigned char*)buf + size);
 }
 
 #ifndef SWIG
@@ -487,14 +534,29 @@ inline void PDFDoc::Save(Filters::Filter& stream, UInt32 flags) {
 	REX(TRN_PDFDocSaveStream(mp_doc,stream.m_impl,flags));
 }
 
+#ifndef SWIG
+inline size_t PDFDoc::Save(Filters::CustomFilter::WriteProc write_proc, void* user_data, UInt32 flags) {
+	Filters::CustomFilter sink(write_proc, user_data);
+	REX(TRN_PDFDocSaveStream(mp_doc,sink.m_impl,flags));
+	sink.Flush();
+	return sink.GetBytesWritten();
+}
+#endif
+
 inline PageIterator PDFDoc::GetPageIterator(UInt32 page_number) {
-	TRN_Iterator result;
+	TRN_Iterator result = 0;
 	REX(TRN_PDFDocGetPageIterator(mp_doc, page_number, &result));
 	return Common::Iterator<Page>(result);
 }
 
+#ifdef PDFTRON_CPP11
+inline PageRange PDFDoc::Pages(UInt32 page_number) {
+	return PageRange(GetPageIterator(page_number));
+}
+#endif
+
 inline Page PDFDoc::GetPage(UInt32 page_number) {
-	TRN_Page result;
+	TRN_Page result = 0;
 	REX(TRN_PDFDocGetPage(mp_doc,page_number,&result));
 	return Page(result);
 }
@@ -593,13 +655,13 @@ inline std::vector<Page> PDFDoc::ImportPages(const std::vector<Page>& pages, boo
 }
 
 inline Page PDFDoc::PageCreate(const Rect& media_box) {
-	TRN_Page result;
+	TRN_Page result = 0;
 	REX(TRN_PDFDocPageCreate(mp_doc, (const TRN_Rect*)&media_box,&result));
 	return Page(result);
 }
 
 inline Bookmark PDFDoc::GetFirstBookmark() {
-	TRN_Bookmark result;
+	TRN_Bookmark result = 0;
 	REX(TRN_PDFDocGetFirstBookmark(mp_doc,&result));
 	return Bookmark(result);
 }
@@ -609,62 +671,68 @@ inline void PDFDoc::AddRootBookmark(Bookmark root_bookmark) {
 }
 
 inline SDF::Obj PDFDoc::GetTrailer () {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_PDFDocGetTrailer(mp_doc,&result));
 	return SDF::Obj(result);
 }
 
 inline SDF::Obj PDFDoc::GetRoot() {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_PDFDocGetRoot(mp_doc, &result));
 	return SDF::Obj(result);
 }
 
 inline SDF::Obj PDFDoc::GetPages() {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_PDFDocGetPages(mp_doc, &result));
 	return SDF::Obj(result);
 }
 
 inline int PDFDoc::GetPageCount () {
-	int result;
+	int result = 0;
 	REX(TRN_PDFDocGetPageCount(mp_doc, &result));
 	return result;
 }
         
 inline int PDFDoc::GetDownloadedByteCount () {
-    int result;
+    int result = 0;
     REX(TRN_PDFGetDownloadedByteCount(mp_doc, &result));
     return result;
 }
 
 inline int PDFDoc::GetTotalRemoteByteCount () {
-    int result;
+    int result = 0;
     REX(TRN_PDFGetTotalRemoteByteCount(mp_doc, &result));
     return result;
 }
 
 inline FieldIterator PDFDoc::GetFieldIterator() {
-	TRN_Iterator result;
+	TRN_Iterator result = 0;
 	REX(TRN_PDFDocGetFieldIteratorBegin(mp_doc, &result));
 	Common::Iterator<Field> t(result);
 	return t;
 }
 
 inline FieldIterator PDFDoc::GetFieldIterator(const UString& field_name) {
-	TRN_Iterator result;
+	TRN_Iterator result = 0;
 	REX(TRN_PDFDocGetFieldIterator(mp_doc, field_name.mp_impl, &result));
 	return Common::Iterator<Field>(result);
 }
 
+#ifdef PDFTRON_CPP11
+inline FieldRange PDFDoc::Fields() {
+	return FieldRange(GetFieldIterator());
+}
+#endif
+
 inline Field PDFDoc::GetField(const UString& field_name) {
-	TRN_Field result;
+	TRN_Field result = TRN_Field();
 	TRN_PDFDocGetField(mp_doc, field_name.mp_impl,&result);
 	return*((Field*)&result);
 }
 
 inline Field PDFDoc::FieldCreate(const UString& field_name, Field::Type type, SDF::Obj field_value, SDF::Obj def_field_value) {
-	TRN_Field result;
+	TRN_Field result = TRN_Field();
 	REX(TRN_PDFDocFieldCreate(mp_doc,field_name.mp_impl,(enum TRN_FieldType)type,
 		field_value.mp_obj,def_field_value.mp_obj,&result)); 
 	return *((Field*)&result);
@@ -672,7 +740,7 @@ inline Field PDFDoc::FieldCreate(const UString& field_name, Field::Type type, SD
 
 inline Field PDFDoc::FieldCreate(const UString& field_name, Field::Type type, const UString& field_value, const UString& def_field_value)
 {
-	TRN_Field result;
+	TRN_Field result = TRN_Field();
 	REX(TRN_PDFDocFieldCreateFromStrings(mp_doc, field_name.mp_impl, (enum TRN_FieldType)type, field_value.mp_impl, def_field_value.mp_impl,&result));
 	return *((Field*)&result);
 }
@@ -686,13 +754,13 @@ inline void PDFDoc::FlattenAnnotations(bool forms_only) {
 }
 
 inline SDF::Obj PDFDoc::GetAcroForm() {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_PDFDocGetAcroForm(mp_doc,&result));
 	return SDF::Obj(result);
 }
 
 inline Action PDFDoc::GetOpenAction() {
-	TRN_Action result;
+	TRN_Action result = 0;
 	REX(TRN_PDFDocGetOpenAction(mp_doc,&result));
 	return Action(result);
 }
@@ -706,55 +774,55 @@ inline void PDFDoc::AddFileAttachment(const UString& file_key, FileSpec embedded
 }
 
 inline SDF::Obj PDFDoc::CreateIndirectName(const char* name) {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_PDFDocCreateIndirectName(mp_doc,name,&result));
 	return SDF::Obj(result);
 }
 
 inline SDF::Obj PDFDoc::CreateIndirectArray() {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_PDFDocCreateIndirectArray(mp_doc,&result));
 	return SDF::Obj(result);
 }
 
 inline SDF::Obj PDFDoc::CreateIndirectBool(bool value) {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_PDFDocCreateIndirectBool(mp_doc,BToTB(value),&result));
 	return SDF::Obj(result);
 }
 
 inline SDF::Obj PDFDoc::CreateIndirectDict() {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_PDFDocCreateIndirectDict(mp_doc,&result));
 	return SDF::Obj(result);
 }
 
 inline SDF::Obj PDFDoc::CreateIndirectNull() {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_PDFDocCreateIndirectNull(mp_doc,&result));
 	return SDF::Obj(result);
 }
 
 inline SDF::Obj PDFDoc::CreateIndirectNumber(double value) {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_PDFDocCreateIndirectNumber(mp_doc,value,&result));
 	return SDF::Obj(result);
 }
 
 inline SDF::Obj PDFDoc::CreateIndirectString(const UChar* value, UInt32 size) {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_PDFDocCreateIndirectString(mp_doc,(const TRN_UChar*)value, size,&result));
 	return SDF::Obj(result);
 }
 
 inline SDF::Obj PDFDoc::CreateIndirectString(const UString& str) {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_PDFDocCreateIndirectStringFromUString(mp_doc,str.mp_impl,&result));
 	return SDF::Obj(result);
 }
 
 inline SDF::Obj PDFDoc::CreateIndirectStream(Filters::FilterReader& data, Filters::Filter filter_chain) {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	filter_chain.m_owner = false;
 	REX(TRN_PDFDocCreateIndirectStreamFromFilter(mp_doc,data.m_impl,filter_chain.m_impl,&result));
 	// Note: Transfer the ownership
@@ -763,7 +831,7 @@ inline SDF::Obj PDFDoc::CreateIndirectStream(Filters::FilterReader& data, Filter
 }
 
 inline SDF::Obj PDFDoc::CreateIndirectStream(const char* data, const size_t data_size, Filters::Filter filter_chain) {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	filter_chain.m_owner = false;
 	REX(TRN_PDFDocCreateIndirectStream(mp_doc,data, data_size, filter_chain.m_impl, &result));
 	// Note: Transfer the ownership
@@ -793,21 +861,21 @@ inline void PDFDoc::UnlockRead() {
 
 inline bool PDFDoc::TryLock( int milliseconds )
 {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_PDFDocTimedLock(mp_doc,milliseconds,&result));
 	return TBToB(result);
 }
 
 inline bool PDFDoc::TryLockRead( int milliseconds )
 {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_PDFDocTimedLockRead(mp_doc,milliseconds,&result));
 	return TBToB(result);
 }
 
 inline UString PDFDoc::GetFileName() const
 {
-	TRN_UString result;
+	TRN_UString result = 0;
 	REX(TRN_SDFDocGetFileName((TRN_SDFDoc)mp_doc, &result));
 	return UString(result);	
 }
@@ -826,20 +894,20 @@ inline void PDFDoc::AppendVisualDiff(Page p1, Page p2, DiffOptions* opts)
 }
 
 inline PDFDocViewPrefs PDFDoc::GetViewPrefs() {
-	TRN_PDFDocViewPrefs result;
+	TRN_PDFDocViewPrefs result = 0;
 	REX(TRN_PDFDocGetViewPrefs(mp_doc,&result));
     return PDFDocViewPrefs(result);
 }
 
 inline SDF::Obj PDFDoc::GetTriggerAction(PDFDoc::ActionTriggerEvent trigger)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_PDFDocGetTriggerAction(mp_doc, (enum TRN_PDFDocEventType)trigger, &result));
 	return SDF::Obj(result);
 }
 
 inline PageLabel PDFDoc::GetPageLabel(int page_num) {
-	TRN_PageLabel result;
+	TRN_PageLabel result = TRN_PageLabel();
 	REX(TRN_PDFDocGetPageLabel(mp_doc,page_num,&result));
 	return *((PageLabel*)(void*)&result);
 }
@@ -853,13 +921,13 @@ inline void PDFDoc::RemovePageLabel(int page_num) {
 }
 
 inline Struct::STree PDFDoc::GetStructTree() {
-	TRN_STree result;
+	TRN_STree result = 0;
 	REX(TRN_PDFDocGetStructTree(mp_doc,&result));
 	return Struct::STree(result);
 }
 
 inline bool PDFDoc::HasOC() const {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_PDFDocHasOC(mp_doc,&result));
 	return TBToB(result);
 }
@@ -869,32 +937,32 @@ inline SDF::Obj PDFDoc::GetOCGs() const {
 }
 
 inline OCG::Config PDFDoc::GetOCGConfig() const {
-	TRN_OCGConfig cfg; 
+	TRN_OCGConfig cfg = 0;
 	REX(TRN_PDFDocGetOCGConfig(mp_doc, &cfg));
 	return OCG::Config(cfg);
 }
 
 inline FDF::FDFDoc PDFDoc::FDFExtract(enum ExtractFlag flag) {
-	TRN_FDFDoc result;
+	TRN_FDFDoc result = 0;
 	REX(TRN_PDFDocFDFExtract(mp_doc, (enum TRN_PDFDocExtractFlag) flag, &result));
 	return FDF::FDFDoc(result);
 }
 
 inline FDF::FDFDoc PDFDoc::FDFExtract(PageSet& pages_to_extract, enum ExtractFlag flag) {
-	TRN_FDFDoc result;
+	TRN_FDFDoc result = 0;
 	REX(TRN_PDFDocFDFExtractPageSet(mp_doc, pages_to_extract.mp_impl, (enum TRN_PDFDocExtractFlag) flag, &result));
 	return FDF::FDFDoc(result);
 }
 
 inline FDF::FDFDoc PDFDoc::FDFExtract(const std::vector<Annot>& annotations) {
-	TRN_FDFDoc result;
+	TRN_FDFDoc result = 0;
 	REX(TRN_PDFDocFDFExtractAnnots(mp_doc, (TRN_Annot*)&(annotations[0]), int(annotations.size()), &result));
 	return FDF::FDFDoc(result);
 }
 
 inline FDF::FDFDoc PDFDoc::FDFExtract(const std::vector<Annot>& annot_added, const std::vector<Annot>& annot_modified, const std::vector<Annot>& annot_deleted)
 {
-	TRN_FDFDoc result;
+	TRN_FDFDoc result = 0;
 	TRN_Annot* annot_added_ptr = annot_added.empty() ? 0 : (TRN_Annot*)&(annot_added[0]);
 	TRN_Annot* annot_modified_ptr = annot_modified.empty() ? 0 : (TRN_Annot*)&(annot_modified[0]);
 	TRN_Annot* annot_deleted_ptr = annot_deleted.empty() ? 0 : (TRN_Annot*)&(annot_deleted[0]);
@@ -911,7 +979,7 @@ inline void PDFDoc::FDFUpdate(FDF::FDFDoc& fdf_doc) {
 }
 
 inline PDFDocInfo PDFDoc::GetDocInfo() {
-	TRN_PDFDocInfo result;
+	TRN_PDFDocInfo result = 0;
 	REX(TRN_PDFDocGetDocInfo(mp_doc,&result));
 	return PDFDocInfo(result);
 }
@@ -921,7 +989,7 @@ inline void PDFDoc::AddHighlights(const UString& hilite) {
 }
 
 inline bool PDFDoc::IsTagged() {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_PDFDocIsTagged(mp_doc, &result));
 	return TBToB(result);
 }
@@ -953,11 +1021,11 @@ namespace pdftron{
 		namespace OCG {
 
 //------------------------------------------------------------------
-inline Config::Config (SDF::Obj cfg) {
+inline Config::Config (SDF::Obj cfg) : mp_obj(0) {
 	REX(TRN_OCGConfigCreateFromObj(cfg.mp_obj,&mp_obj)); 
 }
 
-inline Config::Config (const Config& cfg)
+inline Config::Config (const Config& cfg) : mp_obj(0)
 {
 	REX(TRN_OCGConfigCopy(cfg.mp_obj,&mp_obj));
 }
@@ -968,19 +1036,19 @@ inline Config& Config::operator=(const Config& cfg) {
 }
 
 inline SDF::Obj Config::GetSDFObj () const {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_OCGConfigGetSDFObj(mp_obj,&result));
 	return SDF::Obj(result);
 }
 
 inline Config Config::Create(PDF::PDFDoc& doc, bool default_config) {
-	TRN_OCGConfig cfg;
+	TRN_OCGConfig cfg = 0;
 	REX(TRN_OCGConfigCreate(doc.mp_doc, BToTB(default_config), &cfg));
 	return Config(cfg);
 }
 
 inline SDF::Obj Config::GetOrder() const {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_OCGConfigGetOrder(mp_obj,&result));
 	return SDF::Obj(result);
 }
@@ -1006,19 +1074,19 @@ inline void Config::SetCreator(const UString& name) {
 }
 
 inline const char* Config::GetInitBaseState() const {
-	const char* result;
+	const char* result = 0;
 	REX(TRN_OCGConfigGetInitBaseState(mp_obj, &result));
 	return result;
 }
 
 inline SDF::Obj Config::GetInitOnStates() const {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_OCGConfigGetInitOnStates(mp_obj,&result));
 	return SDF::Obj(result);
 }
 
 inline SDF::Obj Config::GetInitOffStates() const {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_OCGConfigGetInitOffStates(mp_obj,&result));
 	return SDF::Obj(result);
 }
@@ -1036,7 +1104,7 @@ inline void Config::SetInitOffStates(SDF::Obj off_array) {
 }
 
 inline SDF::Obj Config::GetIntent() const  {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_OCGConfigGetIntent(mp_obj,&result));
 	return SDF::Obj(result);
 }
@@ -1046,7 +1114,7 @@ inline void Config::SetIntent(SDF::Obj intent) {
 }
 
 inline SDF::Obj Config::GetLockedOCGs() const {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_OCGConfigGetLockedOCGs(mp_obj,&result));
 	return SDF::Obj(result);
 }
@@ -1057,11 +1125,11 @@ inline void Config::SetLockedOCGs(SDF::Obj locked_ocg_array) {
 
 //------------------------------------------------------------------
 
-inline Group::Group (SDF::Obj cfg) {
+inline Group::Group (SDF::Obj cfg) : mp_obj(0) {
 	REX(TRN_OCGCreateFromObj(cfg.mp_obj, &mp_obj)); 
 }
 
-inline Group::Group (const Group& cfg)
+inline Group::Group (const Group& cfg) : mp_obj(0)
 {
 	REX(TRN_OCGCopy(cfg.mp_obj,&mp_obj));
 }
@@ -1072,19 +1140,19 @@ inline Group& Group::operator=(const Group& cfg) {
 }
 
 inline SDF::Obj Group::GetSDFObj () const {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_OCGGetSDFObj(mp_obj,&result));
 	return SDF::Obj(result);
 }
 
 inline bool Group::IsValid() const {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_OCGIsValid(mp_obj,&result));
 	return TBToB(result);
 }
 
 inline Group Group::Create(PDFDoc& doc, const UString& name) {
-	TRN_OCG g;
+	TRN_OCG g = 0;
 	REX(TRN_OCGCreate(doc.mp_doc, name.mp_impl, &g));
 	return Group(g);
 }
@@ -1098,7 +1166,7 @@ inline void Group::SetName(const UString& name) {
 }
 
 inline SDF::Obj Group::GetIntent() const  {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_OCGGetIntent(mp_obj,&result));
 	return SDF::Obj(result);
 }
@@ -1108,19 +1176,19 @@ inline void Group::SetIntent(SDF::Obj intent) {
 }
 
 inline bool Group::HasUsage() const {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_OCGHasUsage(mp_obj, &result));
 	return TBToB(result);
 }
 
 inline SDF::Obj Group::GetUsage(const char* key) const {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_OCGGetUsage(mp_obj, key, &result));
 	return SDF::Obj(result);
 }
 
 inline bool Group::GetCurrentState(const Context& context) const {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_OCGGetCurrentState(mp_obj, context.mp_obj, &result));
 	return TBToB(result);
 }
@@ -1130,7 +1198,7 @@ inline void Group::SetCurrentState(Context& context, bool state) {
 }
 
 inline bool Group::GetInitialState(const Config& config) const {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_OCGGetInitialState(mp_obj, config.mp_obj, &result));
 	return TBToB(result);
 }
@@ -1140,7 +1208,7 @@ inline void Group::SetInitialState(Config& config, bool state) {
 }
 
 inline bool Group::IsLocked(const Config& config) const {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_OCGIsLocked(mp_obj, config.mp_obj, &result));
 	return TBToB(result);
 }
@@ -1199,7 +1267,7 @@ inline Context::Context(const Config& config)
 }
 
 inline bool Context::GetState(const Group& g) const {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_OCGContextGetState(mp_obj, g.mp_obj, &result));
 	return TBToB(result);
 }
@@ -1217,7 +1285,7 @@ inline void Context::SetNonOCDrawing(bool draw_non_OC) {
 }
 
 inline bool Context::GetNonOCDrawing() const {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_OCGContextGetNonOCDrawing(mp_obj, &result));
 	return TBToB(result);
 }
@@ -1235,16 +1303,16 @@ inline Context::OCDrawMode Context::GetOCMode() const {
 //------------------------------------------------------------------
 
 inline OCMD OCMD::Create(PDFDoc& doc, SDF::Obj ocgs, VisibilityPolicyType vis_policy) {
-	TRN_OCMD g;
+	TRN_OCMD g = 0;
 	REX(TRN_OCMDCreate(doc.mp_doc, ocgs.mp_obj, (TRN_OCMDVisibilityPolicyType)vis_policy, &g));
 	return OCMD(g);
 }
 
-inline OCMD::OCMD (SDF::Obj ocmd) {
+inline OCMD::OCMD (SDF::Obj ocmd) : mp_obj(0) {
 	REX(TRN_OCMDCreateFromObj(ocmd.mp_obj, &mp_obj)); 
 }
 
-inline OCMD::OCMD (const OCMD& cfg)
+inline OCMD::OCMD (const OCMD& cfg) : mp_obj(0)
 {
 	REX(TRN_OCMDCopy(cfg.mp_obj,&mp_obj));
 }
@@ -1255,31 +1323,31 @@ inline OCMD& OCMD::operator=(const OCMD& cfg) {
 }
 
 inline SDF::Obj OCMD::GetSDFObj () const {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_OCMDGetSDFObj(mp_obj,&result));
 	return SDF::Obj(result);
 }
 
 inline SDF::Obj OCMD::GetOCGs() const {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_OCMDGetOCGs(mp_obj, &result));
 	return SDF::Obj(result);
 }
 
 inline SDF::Obj OCMD::GetVisibilityExpression() const {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_OCMDGetVisibilityExpression(mp_obj, &result));
 	return SDF::Obj(result);
 }
 
 inline bool OCMD::IsValid() const {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_OCMDIsValid(mp_obj,&result));
 	return TBToB(result);
 }
 
 inline bool OCMD::IsCurrentlyVisible(const Context& context) const {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_OCMDIsCurrentlyVisible(mp_obj, context.mp_obj, &result));
 	return TBToB(result);
 }
@@ -1302,7 +1370,7 @@ inline void OCMD::SetVisibilityPolicy(VisibilityPolicyType vis_policy) {
 namespace Struct {
 
 //ContentItem
-inline ContentItem::ContentItem(const ContentItem& c) {
+inline ContentItem::ContentItem(const ContentItem& c) : mp_item() {
 	REX(TRN_ContentItemCopy(&(c.mp_item),&mp_item));
 }
 
@@ -1318,43 +1386,43 @@ inline ContentItem::Type ContentItem::GetType() const {
 }
 
 inline SElement ContentItem::GetParent() {
-	TRN_SElement result;
+	TRN_SElement result = TRN_SElement();
 	REX(TRN_ContentItemGetParent(&(mp_item),&result));
 	return SElement(result);
 }
 
 inline Page ContentItem::GetPage() {
-	TRN_Page result;
+	TRN_Page result = 0;
 	REX(TRN_ContentItemGetPage(&mp_item,&result));
 	return Page(result);
 }
 
 inline SDF::Obj ContentItem::GetSDFObj () const {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ContentItemGetSDFObj(&mp_item,&result));
 	return SDF::Obj(result);
 }
 
 inline int ContentItem::GetMCID() const {	
-	int result;
+	int result = 0;
 	REX(TRN_ContentItemGetMCID(&mp_item,&result));
 	return result;
 }
 
 inline SDF::Obj ContentItem::GetContainingStm() const {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ContentItemGetContainingStm(&mp_item,&result));
 	return SDF::Obj(result);
 }
 
 inline SDF::Obj ContentItem::GetStmOwner() const {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ContentItemGetStmOwner(&mp_item,&result));
 	return SDF::Obj(result);
 }
 
 inline SDF::Obj ContentItem::GetRefObj() const {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ContentItemGetRefObj(&mp_item,&result));
 	return SDF::Obj(result);
 }
@@ -1364,11 +1432,11 @@ inline ContentItem::ContentItem(TRN_ContentItem impl) : mp_item(impl) {}
 
 //SElement
 
-inline SElement::SElement (SDF::Obj dict) {
+inline SElement::SElement (SDF::Obj dict) : mp_elem() {
 	REX(TRN_SElementCreate(dict.mp_obj,&mp_elem));
 }
 	
-inline SElement::SElement (const SElement& c) {
+inline SElement::SElement (const SElement& c) : mp_elem() {
 	REX(TRN_SElementAssign(&mp_elem, &(c.mp_elem)));
 }
 
@@ -1379,7 +1447,7 @@ inline SElement& SElement::operator= (const SElement& c) {
 
 inline SElement SElement::Create(PDFDoc& doc, const char* struct_type)
 {
-	TRN_SElement result;
+	TRN_SElement result = TRN_SElement();
 	REX(TRN_SElementCreateFromPDFDoc(doc.mp_doc, struct_type, &result));
 	return SElement(result);
 }
@@ -1391,7 +1459,7 @@ inline void SElement::Insert(SElement& kid, int insert_before)
 
 inline int SElement::CreateContentItem(PDFDoc& doc, Page& page, int insert_before)
 {
-	int result;
+	int result = 0;
 	REX(TRN_SElementCreateContentItem(&mp_elem, doc.mp_doc, page.mp_page, insert_before, &result));
 	return result;
 }
@@ -1403,93 +1471,93 @@ inline bool SElement::IsValid() const {
 }
 
 inline const char* SElement::GetType() const {
-	const char* result;
+	const char* result = 0;
 	REX(TRN_SElementGetType(&mp_elem,&result));
 	return result;
 }
 
 inline int SElement::GetNumKids() const {
-	int result;
+	int result = 0;
 	REX(TRN_SElementGetNumKids(&mp_elem,&result));
 	return result;
 }
 
 inline bool SElement::IsContentItem(int index) const
 {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_SElementIsContentItem(&mp_elem,index,&result));
 	return TBToB(result);
 }
 
 inline ContentItem SElement::GetAsContentItem(int index) const
 {
-	TRN_ContentItem result;
+	TRN_ContentItem result = TRN_ContentItem();
 	REX(TRN_SElementGetAsContentItem(&mp_elem,index,&result));
 	return ContentItem(result);
 }
 
 inline SElement SElement::GetAsStructElem(int index) const {
-	TRN_SElement result;
+	TRN_SElement result = TRN_SElement();
 	REX(TRN_SElementGetAsStructElem(&mp_elem,index,&result));
 	return SElement(result);
 }
 
 inline SElement SElement::GetParent() const {
-	TRN_SElement result;
+	TRN_SElement result = TRN_SElement();
 	REX(TRN_SElementGetParent(&mp_elem,&result));
 	return SElement(result);
 }
 
 inline STree SElement::GetStructTreeRoot() const {
-	TRN_STree result;
+	TRN_STree result = 0;
 	REX(TRN_SElementGetStructTreeRoot(&mp_elem,&result));
 	return STree(result);
 }
 
 inline bool SElement::HasTitle() const {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_SElementHasTitle(&mp_elem,&result));
 	return TBToB(result);
 }
 
 inline UString SElement::GetTitle() const {
-	TRN_UString result;
+	TRN_UString result = 0;
 	REX(TRN_SElementGetTitle(&mp_elem,&result));
 	return UString(result);
 }
 
 inline SDF::Obj SElement::GetID() const {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_SElementGetID(&mp_elem, &result));
 	return SDF::Obj(result);
 }
 
 inline bool SElement::HasActualText() const {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_SElementHasActualText(&mp_elem, &result));
 	return TBToB(result);
 }
 
 inline UString SElement::GetActualText() const {
-	TRN_UString result;
+	TRN_UString result = 0;
 	REX(TRN_SElementGetActualText(&mp_elem,&result));
 	return UString(result);
 }
 
 inline bool SElement::HasAlt() const {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_SElementHasAlt(&mp_elem,&result));
 	return TBToB(result);
 }
 
 inline UString SElement::GetAlt() const {
-	TRN_UString result;
+	TRN_UString result = 0;
 	REX(TRN_SElementGetAlt(&mp_elem,&result));
 	return UString(result);
 }
 
 inline SDF::Obj SElement::GetSDFObj() const {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_SElementGetSDFObj(&mp_elem,&result));
 	return SDF::Obj(result);
 }
@@ -1500,10 +1568,10 @@ inline SElement::SElement(TRN_SElement impl) : mp_elem(impl) {}
 
 //STree
 
-inline STree::STree (SDF::Obj struct_dict) {
+inline STree::STree (SDF::Obj struct_dict) : mp_tree(0) {
 	REX(TRN_STreeCreate(struct_dict.mp_obj,&mp_tree));
 }
-inline STree::STree (const STree& c) {
+inline STree::STree (const STree& c) : mp_tree(0) {
 	REX(TRN_STreeCopy(c.mp_tree,&mp_tree));
 }
 
@@ -1514,7 +1582,7 @@ inline STree& STree::operator= (const STree& c) {
 
 inline STree STree::Create(PDF::PDFDoc& doc)
 {
-	TRN_STree result;
+	TRN_STree result = 0;
 	REX(TRN_STreeCreateFromPDFDoc(doc.mp_doc, &result));
 	return STree(result);
 }
@@ -1533,25 +1601,25 @@ inline int STree::GetNumKids() {
 }
 
 inline SElement STree::GetKid(int index) {
-	TRN_SElement result;
+	TRN_SElement result = TRN_SElement();
 	REX(TRN_STreeGetKid(mp_tree,index,&result));
 	return SElement(result);
 }
 
 inline SElement STree::GetElement(const char* id_buf, int id_buf_sz) {
-	TRN_SElement result;
+	TRN_SElement result = TRN_SElement();
 	REX(TRN_STreeGetElement(mp_tree,id_buf,id_buf_sz,&result));
 	return result;
 }
 
 inline RoleMap STree::GetRoleMap() const {
-	TRN_RoleMap result;
+	TRN_RoleMap result = 0;
 	REX(TRN_STreeGetRoleMap(mp_tree,&result));
 	return RoleMap(result);
 }
 
 inline ClassMap STree::GetClassMap() const {
-	TRN_ClassMap result;
+	TRN_ClassMap result = 0;
 	REX(TRN_STreeGetClassMap(mp_tree,&result));
 	return ClassMap(result);
 }
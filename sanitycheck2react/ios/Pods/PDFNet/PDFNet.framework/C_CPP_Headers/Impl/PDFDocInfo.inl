@@ -1,14 +1,14 @@
 
 inline UString PDFDocInfo::GetTitle()
 {
-	TRN_UString result;
+	TRN_UString result = 0;
 	REX(TRN_PDFDocInfoGetTitle(mp_info,&result));
 	return UString(result);
 }
 
 inline SDF::Obj PDFDocInfo::GetTitleObj()
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_PDFDocInfoGetTitleObj(mp_info,&result))
 	return SDF::Obj(result);
 }
@@ -20,14 +20,14 @@ inline void PDFDocInfo::SetTitle(const UString& title)
 
 inline UString PDFDocInfo::GetAuthor()
 {
-	TRN_UString result;
+	TRN_UString result = 0;
 	REX(TRN_PDFDocInfoGetAuthor(mp_info, &result));
 	return UString(result);
 }
 
 inline SDF::Obj PDFDocInfo::GetAuthorObj()
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_PDFDocInfoGetAuthorObj(mp_info, &result));
 	return SDF::Obj(result);
 }
@@ -39,14 +39,14 @@ inline void PDFDocInfo::SetAuthor(const UString& author)
 
 inline UString PDFDocInfo::GetSubject()
 {
-	TRN_UString result;
+	TRN_UString result = 0;
 	REX(TRN_PDFDocInfoGetSubject(mp_info, &result));
 	return UString(result);
 }
 
 inline SDF::Obj PDFDocInfo::GetSubjectObj()
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_PDFDocInfoGetSubjectObj(mp_info, &result));
 	return SDF::Obj(result);
 }
@@ -58,14 +58,14 @@ inline void PDFDocInfo::SetSubject(const UString& subject)
 
 inline UString PDFDocInfo::GetKeywords()
 {
-	TRN_UString result;
+	TRN_UString result = 0;
 	REX(TRN_PDFDocInfoGetKeywords(mp_info, &result));
 	return UString(result);
 }
 
 inline SDF::Obj PDFDocInfo::GetKeywordsObj()
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_PDFDocInfoGetKeywordsObj(mp_info, &result));
 	return SDF::Obj(result);
 }
@@ -77,14 +77,14 @@ inline void PDFDocInfo::SetKeywords(const UString& keywords)
 
 inline UString PDFDocInfo::GetCreator()
 {
-	TRN_UString result;
+	TRN_UString result = 0;
 	REX(TRN_PDFDocInfoGetCreator(mp_info, &result));
 	return UString(result);
 }
 
 inline SDF::Obj PDFDocInfo::GetCreatorObj()
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_PDFDocInfoGetCreatorObj(mp_info, &result));
 	return SDF::Obj(result);
 }
@@ -96,14 +96,14 @@ inline void PDFDocInfo::SetCreator(const UString& creator)
 
 inline UString PDFDocInfo::GetProducer()
 {
-	TRN_UString result;
+	TRN_UString result = 0;
 	REX(TRN_PDFDocInfoGetProducer(mp_info, &result));
 	return UString(result);
 }
 
 inline SDF::Obj PDFDocInfo::GetProducerObj()
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_PDFDocInfoGetProducerObj(mp_info, &result));
 	return SDF::Obj(result);
 }
@@ -115,7 +115,7 @@ inline void PDFDocInfo::SetProducer(const UString& producer)
 
 inline Date PDFDocInfo::GetCreationDate()
 {
-	TRN_Date result;
+	TRN_Date result = TRN_Date();
 	REX(TRN_PDFDocInfoGetCreationDate(mp_info, &result));
 	return *((Date*)&result);
 }
@@ -127,7 +127,7 @@ inline void PDFDocInfo::SetCreationDate(const Date& creation_date)
 
 inline Date PDFDocInfo::GetModDate()
 {
-	TRN_Date result;
+	TRN_Date result = TRN_Date();
 	REX(TRN_PDFDocInfoGetModDate(mp_info, &result));
 	return *((Date*)&result);
 }
@@ -139,17 +139,17 @@ inline void PDFDocInfo::SetModDate(const Date& mod_date)
 
 inline SDF::Obj PDFDocInfo::GetSDFObj()
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_PDFDocInfoGetSDFObj(mp_info,&result));
 	return SDF::Obj(result);
 }
 
-inline PDFDocInfo::PDFDocInfo (SDF::Obj tr)
+inline PDFDocInfo::PDFDocInfo (SDF::Obj tr) : mp_info(0)
 {
 	REX(TRN_PDFDocInfoCreate(tr.mp_obj,&mp_info))
 }
 
-inline PDFDocInfo::PDFDocInfo (const PDFDocInfo& c)
+inline PDFDocInfo::PDFDocInfo (const PDFDocInfo& c) : mp_info(0)
 {
 	REX(TRN_PDFDocInfoCopy(c.mp_info,&mp_info));
 }
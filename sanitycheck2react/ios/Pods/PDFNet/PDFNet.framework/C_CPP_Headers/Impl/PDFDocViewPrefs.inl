@@ -35,7 +35,7 @@ inline void PDFDocViewPrefs::SetPref(PDFDocViewPrefs::ViewerPref pref, bool valu
 
 inline bool PDFDocViewPrefs::GetPref(PDFDocViewPrefs::ViewerPref pref)
 {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_PDFDocViewPrefsGetPref(mp_prefs, (enum TRN_PDFDocViewPrefsViewerPref)pref,&result));
 	return TBToB(result);
 }
@@ -59,7 +59,7 @@ inline void PDFDocViewPrefs::SetDirection(bool left_to_right)
 
 inline bool PDFDocViewPrefs::GetDirection()
 {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_PDFDocViewPrefsGetDirection(mp_prefs,&result));
 	return TBToB(result);
 }
@@ -118,17 +118,17 @@ inline Page::Box PDFDocViewPrefs::GetPrintClip()
 
 inline SDF::Obj PDFDocViewPrefs::GetSDFObj()
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_PDFDocViewPrefsGetSDFObj(mp_prefs, &result));
 	return SDF::Obj(result);
 }
 
-inline PDFDocViewPrefs::PDFDocViewPrefs (SDF::Obj tr)
+inline PDFDocViewPrefs::PDFDocViewPrefs (SDF::Obj tr) : mp_prefs(0)
 {
 	REX(TRN_PDFDocViewPrefsCreate(tr.mp_obj,&mp_prefs));
 }
 
-inline PDFDocViewPrefs::PDFDocViewPrefs (const PDFDocViewPrefs& p)
+inline PDFDocViewPrefs::PDFDocViewPrefs (const PDFDocViewPrefs& p) : mp_prefs(0)
 {
 	REX(TRN_PDFDocViewPrefsCopy(p.mp_prefs,&mp_prefs));
 }
@@ -1,5 +1,5 @@
 
-inline PDFDraw::PDFDraw(double dpi)
+inline PDFDraw::PDFDraw(double dpi) : mp_draw(0)
 {
 	REX(TRN_PDFDrawCreate(dpi,&mp_draw));
 }
@@ -9,6 +9,19 @@ inline PDFDraw::~PDFDraw()
 	DREX(mp_draw, TRN_PDFDrawDestroy(mp_draw));
 }
 
+#ifdef PDFTRON_CPP11
+inline PDFDraw::PDFDraw(PDFDraw&& other) noexcept : mp_draw(other.mp_draw)
+{
+	other.mp_draw = 0;
+}
+
+inline PDFDraw& PDFDraw::operator=(PDFDraw&& other) noexcept
+{
+	std::swap(mp_draw, other.mp_draw);
+	return *this;
+}
+#endif
+
 inline void PDFDraw::Destroy()
 {
 	REX(TRN_PDFDrawDestroy(mp_draw));
@@ -133,7 +146,7 @@ inline void PDFDraw::Export(Page page, Filters::Filter& stream, const char* form
 #ifdef __DOTNET
 inline System::Drawing::Bitmap* PDFDraw::GetBitmap(Page page)
 {
-	TRN_SystemDrawingBitmap result;
+	TRN_SystemDrawingBitmap result = 0;
 	REX(TRN_PDFDrawGetBitmapDotNet(mp_draw,page.mp_page,&result));
 	(System::Drawing::Bitmap*) result;
 }
@@ -145,13 +158,13 @@ inline void PDFDraw::DrawInRect(Page& page, void* hdc, const Rect& rect)
 }
 #endif
 
-inline const BitmapInfo PDFDraw::GetBitmap(Page page, PixelFormat pix_fmt, bool demult)
+inline BitmapInfo PDFDraw::GetBitmap(Page page, PixelFormat pix_fmt, bool demult)
 {
-	const TRN_UChar* result;
-	int width;
-	int height;
-	int stride;
-	double dpi;
+	const TRN_UChar* result = 0;
+	int width = 0;
+	int height = 0;
+	int stride = 0;
+	double dpi = 0;
 	REX(TRN_PDFDrawGetBitmap(mp_draw,page.mp_page,&width,&height,&stride,&dpi,
 		(enum TRN_PDFDrawPixelFormat)pix_fmt, demult, &result));
 	BitmapInfo bmp(width,height,stride,dpi,(char*)result);
@@ -159,10 +172,22 @@ inline const BitmapInfo PDFDraw::GetBitmap(Page page, PixelFormat pix_fmt, bool
 }
 
 #ifndef SWIG
+inline void PDFDraw::GetBitmap(Page page, BitmapInfo& out_bmp, PixelFormat pix_fmt, bool demult)
+{
+	const TRN_UChar* result = 0;
+	int width = 0;
+	int height = 0;
+	int stride = 0;
+	double dpi = 0;
+	REX(TRN_PDFDrawGetBitmap(mp_draw,page.mp_page,&width,&height,&stride,&dpi,
+		(enum TRN_PDFDrawPixelFormat)pix_fmt, demult, &result));
+	out_bmp.Assign(width,height,stride,dpi,(const char*)result);
+}
+
 inline const UChar* PDFDraw::GetBitmap(Page page, int& out_width, int& out_height, int& out_stride, double& out_dpi, 
 									   PixelFormat pix_fmt, bool demult)
 {
-	const TRN_UChar* result;
+	const TRN_UChar* result = 0;
 	REX(TRN_PDFDrawGetBitmap(mp_draw,page.mp_page,&out_width,&out_height,&out_stride,&out_dpi,
 		(enum TRN_PDFDrawPixelFormat)pix_fmt, demult, &result));
 	return result;
@@ -11,14 +11,14 @@ inline void PDFNet::EnableJavaScript(bool enable)
 
 inline bool PDFNet::IsJavaScriptEnabled()
 {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_PDFNetIsJavaScriptEnabled(&result));
 	return TBToB(result);
 }
 
 inline PDFNet::CloudErrorCode PDFNet::ConnectToCloud(const char* username, const char* password, bool demo_mode)
 {
-	TRN_PDFNetCloudErrorCode result; 
+	TRN_PDFNetCloudErrorCode result = TRN_PDFNetCloudErrorCode();
 	REX(TRN_PDFNetConnectToCloudEx(username, password, demo_mode, &result));
 	return (CloudErrorCode)result;
 }
@@ -33,7 +33,7 @@ inline void PDFNet::Terminate()
 
 inline bool PDFNet::SetResourcesPath(const UString& path)
 {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_PDFNetSetResourcesPath(path.mp_impl,&result));
 	return TBToB(result);
 }
@@ -111,7 +111,7 @@ inline void PDFNet::RegisterSecurityHandler(const char* handler_name, const char
 
 inline PDFNet::SecurityDescriptorIterator PDFNet::GetSecHdlrInfoIterator()
 {
-	TRN_Iterator result;
+	TRN_Iterator result = 0;
 	REX(TRN_PDFNetGetSecHdlrInfoIterator(&result));
 	return PDFNet::SecurityDescriptorIterator(result);
 }
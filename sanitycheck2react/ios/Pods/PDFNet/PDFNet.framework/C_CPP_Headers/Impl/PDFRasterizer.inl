@@ -1,5 +1,5 @@
 
-inline PDFRasterizer::PDFRasterizer(PDFRasterizer::Type type)
+inline PDFRasterizer::PDFRasterizer(PDFRasterizer::Type type) : mp_rast(0)
 {
 	REX(TRN_PDFRasterizerCreate((enum TRN_PDFRasterizerType)type,&mp_rast));
 }
@@ -9,6 +9,19 @@ inline PDFRasterizer::~PDFRasterizer()
 	DREX(mp_rast, TRN_PDFRasterizerDestroy(mp_rast));
 }
 
+#ifdef PDFTRON_CPP11
+inline PDFRasterizer::PDFRasterizer(PDFRasterizer&& other) noexcept : mp_rast(other.mp_rast)
+{
+	other.mp_rast = 0;
+}
+
+inline PDFRasterizer& PDFRasterizer::operator=(PDFRasterizer&& other) noexcept
+{
+	std::swap(mp_rast, other.mp_rast);
+	return *this;
+}
+#endif
+
 inline void PDFRasterizer::Destroy()
 {
 	REX(TRN_PDFRasterizerDestroy(mp_rast));
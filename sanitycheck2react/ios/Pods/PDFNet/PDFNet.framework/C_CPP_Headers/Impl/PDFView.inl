@@ -1,4 +1,4 @@
-inline PDFView::PDFView()
+inline PDFView::PDFView() : mp_view(0)
 {
 	REX(TRN_PDFViewCreate(&mp_view));
 	mp_findtexthandler = NULL;
@@ -27,7 +27,7 @@ inline void PDFView::CloseDoc()
 
 inline PDFDoc* PDFView::GetDoc()
 {
-    TRN_PDFDoc localTempDoc;
+    TRN_PDFDoc localTempDoc = 0;
 	REX(TRN_PDFViewGetDoc(mp_view,&localTempDoc));
 	if(localTempDoc)
     {
@@ -215,7 +215,7 @@ inline Point PDFView::ConvScreenPtToCanvasPt(const Point& pt) const
 
 inline void PDFView::ExecuteAction(Action& action)
 {
-	TRN_ActionParameter action_param;
+	TRN_ActionParameter action_param = 0;
 	REX(TRN_ActionParameterCreate(action.mp_action, &action_param));
 	REX(TRN_PDFViewDoAction(mp_view, action_param));
 }
@@ -464,7 +464,7 @@ inline void PDFView::UpdateBuffer()
 #ifdef SWIG
 inline std::vector<unsigned char> PDFView::GetBuffer() const
 {
-	char* arr;
+	char* arr = 0;
 	int height, stride;
 	TRN_PDFViewGetBufferHeight(mp_view,&height);
 	TRN_PDFViewGetBufferStride(mp_view,&stride);
@@ -642,7 +642,7 @@ inline void PDFView::ClearSelection()
 
 inline Selection PDFView::GetSelection( int ipage ) const
 {
-	TRN_PDFViewSelection result;
+	TRN_PDFViewSelection result = 0;
 	REX(TRN_PDFViewGetSelection(mp_view, ipage, &result));
 	return Selection(result);
 }
@@ -751,7 +751,7 @@ inline void PDFView::SetOCGContext(const OCG::Context& ctx)
 }
 
 inline OCG::Context PDFView::GetOCGContext() {
-	TRN_OCGContext result; 
+	TRN_OCGContext result = 0;
 	REX(TRN_PDFViewGetOCGContext(mp_view, &result));
 	return OCG::Context(result);
 }
@@ -782,7 +782,7 @@ inline Rect PDFView::GetScreenRectForAnnot(PDF::Annot annot, int page_num /* = -
 
 inline Annot PDFView::GetAnnotationAt(int x, int y, double distanceThreshold, double minimumLineWeight)
 {
-	TRN_Annot result;
+	TRN_Annot result = 0;
 	REX(TRN_PDFViewGetAnnotationAt(mp_view, x, y, distanceThreshold, minimumLineWeight, &result));
 	return Annot(result);
 }
@@ -823,14 +823,14 @@ inline PDFView::HTTPRequestOptions::HTTPRequestOptions()
 
 inline void PDFView::HTTPRequestOptions::AddHeader(const UString& header, const UString& val)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	std::string temp(header.ConvertToUtf8());
 	REX(TRN_ObjPutText(m_obj, temp.c_str(), val.mp_impl, &result));
 }
 
 inline void PDFView::HTTPRequestOptions::RestrictDownloadUsage(bool restrict)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ObjPutBool(m_obj,"MINIMAL_DOWNLOAD", BToTB(restrict), &result));
 }
 
@@ -979,7 +979,7 @@ inline void PDFView::SetPartDownloadedProc(PartDownloadedProc proc, void* user_d
 
 inline void PDFView::GetPageRects(const Rect& rect, std::vector<double>& page_rects_info) const
 {
-	int size;
+	int size = 0;
 	REX(TRN_PDFViewGetPageRects(mp_view, &rect, 0, &size));
 	page_rects_info.resize(size);
 	REX(TRN_PDFViewGetPageRects(mp_view, &rect, &page_rects_info.front(), &size));
@@ -987,7 +987,7 @@ inline void PDFView::GetPageRects(const Rect& rect, std::vector<double>& page_re
 
 inline void PDFView::GetPageRectsOnCanvas(std::vector<double>& page_rects_info, int canvasNumber) const
 {
-	int size;
+	int size = 0;
 	REX(TRN_PDFViewGetPageRectsOnCanvas(mp_view, 0, canvasNumber, &size));
 	page_rects_info.resize(size);
 	REX(TRN_PDFViewGetPageRectsOnCanvas(mp_view, &page_rects_info.front(), canvasNumber, &size));
@@ -1039,7 +1039,7 @@ inline void PDFView::GetThumbAsync(int page_num, ThumbAsyncHandler thumb_async_h
 
 inline size_t PDFView::GetThumbInCacheSize(int page_num)
 {
-	size_t result;
+	size_t result = 0;
 	REX(TRN_PDFViewGetThumbInCacheSize(mp_view,page_num,&result));
 	return result;
 }
@@ -1,4 +1,4 @@
-inline PDFViewCtrl::PDFViewCtrl(void* parent_hwnd, void* hinstance, bool compatibility) :	m_findtext_proc(0), m_findtext_data(0)
+inline PDFViewCtrl::PDFViewCtrl(void* parent_hwnd, void* hinstance, bool compatibility) : mp_view(0), m_findtext_proc(0), m_findtext_data(0)
 {
 	REX(TRN_PDFViewCtrlCreate(parent_hwnd, hinstance, compatibility, &mp_view));
 }
@@ -432,7 +432,7 @@ inline void PDFViewCtrl::ClearSelection()
 
 inline Selection PDFViewCtrl::GetSelection( int ipage ) const
 {
-	TRN_PDFViewSelection result;
+	TRN_PDFViewSelection result = 0;
 	REX(TRN_PDFViewCtrlGetSelection(mp_view, ipage, &result));
 	return Selection(result);
 }
@@ -530,7 +530,7 @@ inline void PDFViewCtrl::SetOCGContext(const OCG::Context& ctx)
 }
 
 inline OCG::Context PDFViewCtrl::GetOCGContext() {
-	TRN_OCGContext result; 
+	TRN_OCGContext result = 0;
 	REX(TRN_PDFViewCtrlGetOCGContext(mp_view, &result));
 	return OCG::Context(result);
 }
@@ -612,7 +612,7 @@ inline Rect PDFViewCtrl::GetScreenRectForAnnot(Annot annot, int page_num)
 
 inline Annot PDFViewCtrl::GetAnnotationAt(int x, int y)
 {
-	TRN_Annot result;
+	TRN_Annot result = 0;
 	REX(TRN_PDFViewCtrlGetAnnotationAt(mp_view, x, y, &result));
 	return Annot(result);
 }
@@ -636,7 +636,7 @@ inline void PDFViewCtrl::SetEnabledPanels(UInt32 panels)
 
 inline UInt32 PDFViewCtrl::GetEnabledPanels() const
 {
-	TRN_UInt32 result;
+	TRN_UInt32 result = 0;
 	REX(TRN_PDFViewCtrlGetEnabledPanels(mp_view, &result));
 	return result;
 }
@@ -754,7 +754,7 @@ inline 	void  PDFViewCtrl::SaveCurrentConfiguration( const UString & path, Commo
 
 inline 	Annot  PDFViewCtrl::GetDefaultAnnotation( const char* type ) 
 {
-	TRN_Annot an;
+	TRN_Annot an = 0;
 	REX( TRN_PDFViewCtrlGetDefaultAnnotation(mp_view,type, &an ));
 	return an;
 }
@@ -904,7 +904,7 @@ inline HTTPRequestOptions::HTTPRequestOptions()
 
 inline void HTTPRequestOptions::AddHeader(const UString& header, const UString& val)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	std::string temp(header.ConvertToUtf8());
 	REX(TRN_ObjPutText(m_obj, temp.c_str(), val.mp_impl, &result));
 }
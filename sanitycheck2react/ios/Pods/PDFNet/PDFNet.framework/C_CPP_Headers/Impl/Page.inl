@@ -19,65 +19,65 @@ namespace pdftron {
 
 inline Destination Destination::CreateXYZ(Page page, double left, double top, double zoom)
 {
-	TRN_Destination result;
+	TRN_Destination result = 0;
 	REX(TRN_DestinationCreateXYZ(page.mp_page,left,top,zoom,&result))
 	return Destination(result);
 }
 inline Destination Destination::CreateFit(Page page)
 {
-	TRN_Destination result;
+	TRN_Destination result = 0;
 	REX(TRN_DestinationCreateFit(page.mp_page,&result));
 	return Destination(result);
 }
 
 inline Destination Destination::CreateFitH(Page page, double top)
 {
-	TRN_Destination result;
+	TRN_Destination result = 0;
 	REX(TRN_DestinationCreateFitH(page.mp_page,top,&result));
 	return Destination(result);
 }
 
 inline Destination Destination::CreateFitV(Page page, double left)
 {
-	TRN_Destination result;
+	TRN_Destination result = 0;
 	REX(TRN_DestinationCreateFitV(page.mp_page,left,&result));
 	return Destination(result);
 }
 
 inline Destination Destination::CreateFitR(Page page, double left, double bottom,	double right, double top)
 {
-	TRN_Destination result;
+	TRN_Destination result = 0;
 	REX(TRN_DestinationCreateFitR(page.mp_page,left,bottom,right,top,&result));
 	return Destination(result);
 }
 
 inline Destination Destination::CreateFitB(Page page)
 {
-	TRN_Destination result;
+	TRN_Destination result = 0;
 	REX(TRN_DestinationCreateFitB(page.mp_page,&result));
 	return Destination(result);
 }
 
 inline Destination Destination::CreateFitBH(Page page, double top)
 {
-	TRN_Destination result;
+	TRN_Destination result = 0;
 	REX(TRN_DestinationCreateFitBH(page.mp_page,top,&result));
 	return Destination(result);
 }
 
 inline Destination Destination::CreateFitBV(Page page, double left)
 {
-	TRN_Destination result;
+	TRN_Destination result = 0;
 	REX(TRN_DestinationCreateFitBV(page.mp_page,left,&result))
 	return Destination(result);
 }
 
-inline Destination::Destination (SDF::Obj dest)
+inline Destination::Destination (SDF::Obj dest) : mp_dest(0)
 {
 	REX(TRN_DestinationCreate(dest.mp_obj,&mp_dest));
 }
 
-inline Destination::Destination (const Destination& d)
+inline Destination::Destination (const Destination& d) : mp_dest(0)
 {
 	REX(TRN_DestinationCopy(d.mp_dest,&mp_dest));
 }
@@ -89,7 +89,7 @@ inline Destination& Destination::operator=(const Destination& d)
 }
 inline bool Destination::IsValid() const
 {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_DestinationIsValid(mp_dest,&result));
 	return TBToB(result);
 }
@@ -103,7 +103,7 @@ inline Destination::FitType Destination::GetFitType()
 
 inline Page Destination::GetPage()
 {
-	TRN_Page result;
+	TRN_Page result = 0;
 	REX(TRN_DestinationGetPage(mp_dest,&result));
 	return Page(result);
 }
@@ -115,14 +115,14 @@ inline void Destination::SetPage(Page page)
 
 inline SDF::Obj Destination::GetSDFObj () const
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_DestinationGetSDFObj(mp_dest,&result));
 	return SDF::Obj(result);
 }
 
 inline SDF::Obj Destination::GetExplicitDestObj ()
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_DestinationGetExplicitDestObj(mp_dest,&result));
 	return SDF::Obj(result);
 }
@@ -142,12 +142,12 @@ inline Field::Field ()
     mp_field.builder = 0;
 }
 
-inline Field::Field (SDF::Obj field_dict)
+inline Field::Field (SDF::Obj field_dict) : mp_field()
 {
 	REX(TRN_FieldCreate(field_dict.mp_obj,&mp_field));
 }
 
-inline Field::Field (const Field& p)
+inline Field::Field (const Field& p) : mp_field()
 {
 	REX(TRN_FieldAssign(&mp_field,&(p.mp_field)));
 }
@@ -171,7 +171,7 @@ inline void Field::Destroy ()
 
 inline bool Field::IsValid() const
 {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_FieldIsValid(&mp_field,&result));
 	return TBToB(result);
 }
@@ -185,7 +185,7 @@ inline Field::Type Field::GetType() const
 
 inline SDF::Obj Field::GetValue()
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_FieldGetValue(&mp_field,&result));
 	return SDF::Obj(result);
 }
@@ -197,21 +197,21 @@ inline UString Field::GetValueAsString()
 
 inline ViewChangeCollection Field::SetValue(SDF::Obj value)
 {
-	TRN_ViewChangeCollection result;
+	TRN_ViewChangeCollection result = 0;
 	REX(TRN_FieldSetValue(&mp_field,value.mp_obj,&result));
 	return ViewChangeCollection(result);
 }
 
 inline ViewChangeCollection Field::SetValue(const UString& value)
 {
-	TRN_ViewChangeCollection result;
+	TRN_ViewChangeCollection result = 0;
 	REX(TRN_FieldSetValueAsString(&mp_field,value.mp_impl,&result));
 	return ViewChangeCollection(result);
 }
 
 inline ViewChangeCollection Field::SetValue(const char* value)
 {
-	TRN_ViewChangeCollection result;
+	TRN_ViewChangeCollection result = 0;
 	UString v(value, -1, UString::e_utf8);
 	REX(TRN_FieldSetValueAsString(&mp_field,v.mp_impl,&result));
 	return ViewChangeCollection(result);
@@ -219,21 +219,21 @@ inline ViewChangeCollection Field::SetValue(const char* value)
 
 inline ViewChangeCollection Field::SetValue(bool is_checked)
 {
-	TRN_ViewChangeCollection result;
+	TRN_ViewChangeCollection result = 0;
 	REX(TRN_FieldSetValueAsBool(&mp_field,is_checked,&result));
 	return ViewChangeCollection(result);
 }
 
 inline SDF::Obj Field::GetTriggerAction(Field::ActionTriggerEvent trigger)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_FieldGetTriggerAction(&mp_field, (enum TRN_FieldEventType)trigger, &result ));
 	return SDF::Obj(result);
 }
 
 inline bool Field::GetValueAsBool()
 {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_FieldGetValueAsBool(&mp_field,&result));
 	return TBToB(result);
 }
@@ -250,7 +250,7 @@ inline void Field::EraseAppearance()
 
 inline SDF::Obj Field::GetDefaultValue()
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_FieldGetDefaultValue(&mp_field,&result));
 	return SDF::Obj(result);
 }
@@ -262,14 +262,14 @@ inline UString Field::GetDefaultValueAsString()
 
 inline UString Field::GetName()
 {
-	TRN_UString result;
+	TRN_UString result = 0;
 	REX(TRN_FieldGetName(&mp_field,&result));
 	return UString(result);
 }
 
 inline UString Field::GetPartialName()
 {
-	TRN_UString result;
+	TRN_UString result = 0;
 	REX(TRN_FieldGetPartialName(&mp_field,&result));
 	return UString(result);
 }
@@ -281,14 +281,14 @@ inline void Field::Rename(const UString& field_name)
 
 inline bool Field::IsAnnot() const
 {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_FieldIsAnnot(&mp_field,&result));
 	return TBToB(result);
 }
 
 inline bool Field::GetFlag(Flag flag) const
 {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_FieldGetFlag(&mp_field,(enum TRN_FieldFlag)flag, &result));
 	return TBToB(result);
 }
@@ -316,28 +316,28 @@ inline void Field::SetMaxLen(int max_len)
 
 inline int Field::GetMaxLen() const
 {
-	int result;
+	int result = 0;
 	REX(TRN_FieldGetMaxLen(&mp_field,&result));
 	return result;
 }
 
 inline UString Field::GetOpt(int index)
 {
-	TRN_UString result;
+	TRN_UString result = 0;
 	REX(TRN_FieldGetOpt(&mp_field,index,&result));
 	return UString(result);
 }
 
 inline int Field::GetOptCount() const
 {
-	int result;
+	int result = 0;
 	REX(TRN_FieldGetOptCount(&mp_field, &result));
 	return result;
 }
 
 inline GState Field::GetDefaultAppearance()
 {
-	TRN_GState result;
+	TRN_GState result = 0;
 	REX(TRN_FieldGetDefaultAppearance(&mp_field,&result));
 	return GState(result);
 }
@@ -354,14 +354,14 @@ inline Rect Field::GetUpdateRect() const
 
 inline SDF::Obj Field::FindInheritedAttribute (const char* attrib) const
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_FieldFindInheritedAttribute(&mp_field,attrib,&result));
 	return SDF::Obj(result);
 }
 
 inline SDF::Obj Field::GetSDFObj () const
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_FieldGetSDFObj(&mp_field,&result));
 	return SDF::Obj(result);
 }
@@ -376,14 +376,14 @@ inline SDF::Obj Field::UseSignatureHandler(const SDF::SignatureHandlerId signatu
 //Action
 inline Action Action::CreateGoto(Destination dest)
 {
-	TRN_Action result;
+	TRN_Action result = 0;
 	REX(TRN_ActionCreateGoto(dest.mp_dest,&result));
 	return Action(result);
 }
 
 inline Action Action::CreateGoto(const UChar* key, int key_sz, Destination dest)
 {
-	TRN_Action result;
+	TRN_Action result = 0;
 	TRN_String keyString = { (const char*)key, (unsigned int)key_sz };
 	REX(TRN_ActionCreateGotoWithKey(keyString,dest.mp_dest,&result));
 	return Action(result);
@@ -391,80 +391,80 @@ inline Action Action::CreateGoto(const UChar* key, int key_sz, Destination dest)
 
 inline Action Action::CreateGotoRemote(const FileSpec& file, int page_num)
 {
-	TRN_Action result;
+	TRN_Action result = 0;
 	REX(TRN_ActionCreateGotoRemote(file.mp_impl,page_num,&result));
 	return Action(result);
 }
 
 inline Action Action::CreateGotoRemote(const FileSpec& file, int page_num, bool new_window)
 {
-	TRN_Action result;
+	TRN_Action result = 0;
 	REX(TRN_ActionCreateGotoRemoteSetNewWindow(file.mp_impl,page_num,BToTB(new_window),&result));
 	return Action(result);
 }
 
 inline Action Action::CreateURI(SDF::SDFDoc& doc, const char* uri)
 {
-	TRN_Action result;
+	TRN_Action result = 0;
 	REX(TRN_ActionCreateURI(doc.mp_doc, uri, &result));
 	return Action(result);
 }
 
 inline Action Action::CreateURI(SDF::SDFDoc& doc, UString& uri)
 {
-	TRN_Action result;
+	TRN_Action result = 0;
 	REX(TRN_ActionCreateURIWithUString(doc.mp_doc, uri.mp_impl, &result));
 	return Action(result);
 }
 
 inline Action Action::CreateSubmitForm(const FileSpec& url)
 {
-	TRN_Action result;
+	TRN_Action result = 0;
 	REX(TRN_ActionCreateSubmitForm(url.mp_impl, &result));
 	return Action(result);
 }
 
 inline Action Action::CreateLaunch(SDF::SDFDoc& doc, const char* path)
 {
-	TRN_Action result;
+	TRN_Action result = 0;
 	REX(TRN_ActionCreateLaunch(doc.mp_doc, path, &result));
 	return Action(result);
 }
 
 inline Action Action::CreateHideField(SDF::SDFDoc& doc, int list_length, const char** field_list)
 {
-	TRN_Action result;
+	TRN_Action result = 0;
 	REX(TRN_ActionCreateHideField(doc.mp_doc, list_length, field_list, &result));
 	return Action(result);
 }
 
 inline Action Action::CreateImportData(SDF::SDFDoc& doc, const char* path)
 {
-	TRN_Action result;
+	TRN_Action result = 0;
 	REX(TRN_ActionCreateImportData(doc.mp_doc, path, &result));
 	return Action(result);
 }
 
 inline Action Action::CreateResetForm(SDF::SDFDoc& doc)
 {
-	TRN_Action result;
+	TRN_Action result = 0;
 	REX(TRN_ActionCreateResetForm(doc.mp_doc, &result));
 	return Action(result);
 }
 
 inline Action Action::CreateJavaScript(SDF::SDFDoc& doc, const char* script)
 {
-	TRN_Action result;
+	TRN_Action result = 0;
 	REX(TRN_ActionCreateJavaScript(doc.mp_doc, script, &result));
 	return Action(result);
 }
 
-inline Action::Action (SDF::Obj in_obj)
+inline Action::Action (SDF::Obj in_obj) : mp_action(0)
 {
 	REX(TRN_ActionCreate(in_obj.mp_obj,&mp_action));
 }
 
-inline Action::Action (const Action& in_action)
+inline Action::Action (const Action& in_action) : mp_action(0)
 {
 	REX(TRN_ActionCopy(in_action.mp_action,&mp_action));
 }
@@ -477,14 +477,14 @@ inline Action& Action::operator=(const Action& in_action)
 
 inline bool Action::operator==(const Action& in_action)
 {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_ActionCompare(mp_action,in_action.mp_action,&result));
 	return TBToB(result);
 }
 
 inline bool Action::IsValid() const
 {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_ActionIsValid(mp_action,&result));
 	return TBToB(result);
 }
@@ -498,21 +498,21 @@ inline Action::Type Action::GetType() const
 
 inline SDF::Obj Action::GetNext() const
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ActionGetNext(mp_action,&result));
 	return SDF::Obj(result);
 }
 
 inline Destination Action::GetDest()
 {
-	TRN_Destination result;
+	TRN_Destination result = 0;
 	REX(TRN_ActionGetDest(mp_action,&result))
 	return Destination(result);
 }
 
 inline SDF::Obj Action::GetSDFObj () const
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ActionGetSDFObj(mp_action,&result));
 	return SDF::Obj(result);
 }
@@ -537,21 +537,21 @@ inline void Action::Execute()
 
 inline KeyStrokeActionResult Action::ExecuteKeyStrokeAction(const KeyStrokeEventData& data)
 {
-	TRN_KeyStrokeActionResult result;
+	TRN_KeyStrokeActionResult result = 0;
 	REX(TRN_ActionExecuteKeyStrokeAction(mp_action, data.mp_data, &result));
 	return KeyStrokeActionResult(result);
 }
 
 inline bool Action::NeedsWriteLock()
 {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_ActionNeedsWriteLock(mp_action, &result));
 	return TBToB(result);
 }
 
 inline bool  Action::GetFormActionFlag( FormActionFlag flag ) const 
 {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_Action_GetFormActionFlag(mp_action, static_cast<TRN_ActionFormActionFlag>(flag), &result));
 	return static_cast<bool>(result != 0);
 }
@@ -569,11 +569,11 @@ inline void  Action::SetFormActionFlag( FormActionFlag flag, bool value )
 
 //Page
 
-inline Page::Page (SDF::Obj page_dict)
+inline Page::Page (SDF::Obj page_dict) : mp_page(0)
 {
 	REX(TRN_PageCreate(page_dict.mp_obj,&mp_page));
 }
-inline Page::Page (const Page& p)
+inline Page::Page (const Page& p) : mp_page(0)
 {
 	REX(TRN_PageCopy(p.mp_page,&mp_page));
 }
@@ -585,21 +585,21 @@ inline Page& Page::operator= (const Page& p)
 
 inline bool Page::IsValid() const
 {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_PageIsValid(mp_page,&result));
 	return TBToB(result);
 }
 
 inline int Page::GetIndex() const
 {
-	int result;
+	int result = 0;
 	REX(TRN_PageGetIndex(mp_page,&result));
 	return result;
 }
 
 inline Rect Page::GetBox(Box type) const
 {
-	TRN_Rect result;
+	TRN_Rect result = TRN_Rect();
 	REX(TRN_PageGetBox(mp_page,(enum TRN_PageBox)type,&result));
 	return *((Rect*)&result);
 }
@@ -611,7 +611,7 @@ inline void Page::SetBox(Box type, const Rect& box) const
 
 inline Rect Page::GetCropBox() const
 {
-	TRN_Rect result;
+	TRN_Rect result = TRN_Rect();
 	REX(TRN_PageGetCropBox(mp_page,&result));
 	return *((Rect*)&result);
 }
@@ -623,7 +623,7 @@ inline void Page::SetCropBox(const Rect& box)
 
 inline Rect Page::GetMediaBox() const
 {
-	TRN_Rect result;
+	TRN_Rect result = TRN_Rect();
 	REX(TRN_PageGetMediaBox(mp_page,&result));
 	return *((Rect*)&result);
 }
@@ -635,7 +635,7 @@ inline void Page::SetMediaBox(const Rect& box)
 
 inline Rect Page::GetVisibleContentBox() const
 {
-	TRN_Rect result;
+	TRN_Rect result = TRN_Rect();
 	REX(TRN_PageGetVisibleContentBox(mp_page,&result));
 	return *((Rect*)&result);
 }
@@ -655,21 +655,21 @@ inline void Page::SetRotation(Rotate angle)
 
 inline double Page::GetPageWidth(Box box_type)
 {
-	double result;
+	double result = 0;
 	REX(TRN_PageGetPageWidth(mp_page,(enum TRN_PageBox)box_type,&result));
 	return result;
 }
 
 inline double Page::GetPageHeight(Box box_type)
 {
-	double result;
+	double result = 0;
 	REX(TRN_PageGetPageHeight(mp_page,(enum TRN_PageBox)box_type,&result));
 	return result;
 }
 
 inline Common::Matrix2D Page::GetDefaultMatrix(bool flip_y, Box box_type, Rotate angle) const
 {
-	TRN_Matrix2D result;
+	TRN_Matrix2D result = TRN_Matrix2D();
 	REX(TRN_PageGetDefaultMatrix(mp_page,BToTB(flip_y),
 		(enum TRN_PageBox)box_type, (enum TRN_PageRotate)angle,&result));
 	return *((Common::Matrix2D*)&result);
@@ -677,28 +677,28 @@ inline Common::Matrix2D Page::GetDefaultMatrix(bool flip_y, Box box_type, Rotate
 
 inline SDF::Obj Page::GetAnnots() const
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_PageGetAnnots(mp_page,&result));
 	return SDF::Obj(result);
 }
 
 inline UInt32 Page::GetNumAnnots() const
 {
-	UInt32 result;
+	UInt32 result = 0;
 	REX(TRN_PageGetNumAnnots(mp_page,&result));
 	return result;
 }
 
 inline Annot Page::GetAnnot(UInt32 index) const
 {
-	TRN_Annot result;
+	TRN_Annot result = 0;
 	REX(TRN_PageGetAnnot(mp_page,index,&result));
 	return Annot(result);
 }
 
 inline SDF::Obj Page::GetTriggerAction(Page::ActionTriggerEvent trigger)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_PageGetTriggerAction(mp_page, (enum TRN_PageEventType)trigger, &result));
 	return SDF::Obj(result);
 }
@@ -740,14 +740,14 @@ inline void Page::FlattenField(Field field_to_flatten)
 
 inline bool Page::HasTransition() const
 {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_PageHasTransition(mp_page, &result));
 	return TBToB(result);
 }
 
 inline double Page::GetUserUnitSize() const
 {
-	double result;
+	double result = 0;
 	REX(TRN_PageGetUserUnitSize(mp_page, &result));
 	return result;
 }
@@ -759,35 +759,35 @@ inline void Page::SetUserUnitSize(double unit_size)
 
 inline SDF::Obj Page::GetResourceDict () const
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_PageGetResourceDict(mp_page, &result));
 	return SDF::Obj(result);
 }
 
 inline SDF::Obj Page::GetContents () const
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_PageGetContents(mp_page,&result));
 	return SDF::Obj(result);
 }
 
 inline SDF::Obj Page::GetThumb() const 
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_PageGetThumb(mp_page,&result));
 	return SDF::Obj(result);
 }
 
 inline SDF::Obj Page::GetSDFObj () const
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_PageGetSDFObj(mp_page,&result));
 	return SDF::Obj(result);
 }
 
 inline SDF::Obj Page::FindInheritedAttribute (const char* attrib) const
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_PageFindInheritedAttribute(mp_page,attrib,&result));
 	return SDF::Obj(result);
 }
@@ -810,7 +810,7 @@ inline Page::Rotate Page::SubtractRotations(Page::Rotate r0, Page::Rotate r1)
 
 inline int Page::RotationToDegree(Page::Rotate r)
 {
-	int result;
+	int result = 0;
 	REX(TRN_PageRotationToDegree((enum TRN_PageRotate)r, &result));
 	return result;
 }
@@ -832,12 +832,12 @@ inline ptrdiff_t Annot::GetHandleInternal() {
     return (ptrdiff_t) mp_annot;
 }
 
-inline Annot::Annot (SDF::Obj d)
+inline Annot::Annot (SDF::Obj d) : mp_annot(0)
 {
 	REX(TRN_AnnotCreateFromObj(d.mp_obj,&mp_annot));
 }
 
-inline Annot::Annot (const Annot& d)
+inline Annot::Annot (const Annot& d) : mp_annot(0)
 {
 	REX(TRN_AnnotCopy(d.mp_annot,&mp_annot));
 }
@@ -848,13 +848,13 @@ inline Annot& Annot::operator=(const Annot& d) {
 }
 
 inline bool Annot::operator==(const Annot& d) {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_AnnotCompare(mp_annot,d.mp_annot,&result));
 	return TBToB(result);
 }
 
 inline bool Annot::IsValid() const {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_AnnotIsValid(mp_annot,&result));
 	return TBToB(result);
 }
@@ -866,25 +866,25 @@ inline Annot::Type Annot::GetType() const {
 }
 
 inline SDF::Obj Annot::GetSDFObj () const {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_AnnotGetSDFObj(mp_annot,&result));
 	return SDF::Obj(result);
 }
 
 inline Rect Annot::GetRect() const {
-	TRN_Rect result;
+	TRN_Rect result = TRN_Rect();
 	REX(TRN_AnnotGetRect(mp_annot,&result));
 	return *((Rect*)&result);
 }
 
 inline Rect Annot::GetVisibleContentBox() const {
-	TRN_Rect result;
+	TRN_Rect result = TRN_Rect();
 	REX(TRN_AnnotGetVisibleContentBox(mp_annot, &result));
 	return *((Rect*)&result);
 }
 
 inline bool Annot::IsMarkup() const {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_AnnotIsMarkup(mp_annot,&result));
 	return (result!=0);
 }
@@ -894,7 +894,7 @@ inline void Annot::SetRect(const Rect& p) {
 }
 
 inline bool Annot::GetFlag(Flag flag) const {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_AnnotGetFlag(mp_annot,(enum TRN_AnnotFlag)flag,&result));
 	return TBToB(result);
 }
@@ -905,13 +905,13 @@ inline void Annot::SetFlag(Flag flag, bool value) {
 
 inline SDF::Obj Annot::GetTriggerAction(Annot::ActionTriggerEvent trigger)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_AnnotGetTriggerAction(mp_annot, (enum TRN_AnnotEventType)trigger, &result));
 	return SDF::Obj(result);
 }
 
 inline Date Annot::GetDate() const {
-	TRN_Date result;
+	TRN_Date result = TRN_Date();
 	REX(TRN_AnnotGetDate(mp_annot,&result));
 	return *((Date*)&result);
 }
@@ -921,7 +921,7 @@ inline void Annot::SetDate(const Date& date) {
 }
 
 inline SDF::Obj Annot::GetUniqueID() const {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_AnnotGetUniqueID(mp_annot,&result));
 	return SDF::Obj(result);
 }
@@ -952,7 +952,7 @@ inline void Annot::SetColor(const ColorPt& c, int comp_num){
 
 inline int Annot::GetColorCompNum() const
 {
-	int result;
+	int result = 0;
 	REX(TRN_AnnotGetColorCompNum(mp_annot, &result));
 	return result;
 }
@@ -960,7 +960,7 @@ inline int Annot::GetColorCompNum() const
 //State
 inline UString Annot::GetContents() const
 {
-	TRN_UString result;
+	TRN_UString result = 0;
 	REX(TRN_AnnotGetContents(mp_annot,&result));
 	return UString(result);	
 }
@@ -977,18 +977,18 @@ inline void Annot::Resize(const Rect& p) {
 
 
 // BorderStyle
-inline BorderStyle::BorderStyle(Style s, double b_width, double b_hr, double b_vr)
+inline BorderStyle::BorderStyle(Style s, double b_width, double b_hr, double b_vr) : mp_bs(0)
 {
 	REX(TRN_AnnotBorderStyleCreate((enum TRN_AnnotBorderStyleStyle)s, b_width,b_hr,b_vr,&mp_bs));
 }
 
-inline BorderStyle::BorderStyle(Style s, double b_width, double b_hr, double b_vr, const std::vector<double>& b_dash)
+inline BorderStyle::BorderStyle(Style s, double b_width, double b_hr, double b_vr, const std::vector<double>& b_dash) : mp_bs(0)
 {
 	size_t sz = b_dash.size();
 	REX(TRN_AnnotBorderStyleCreateWithDashPattern((enum TRN_AnnotBorderStyleStyle)s, b_width, b_hr, b_vr, (double*)(sz<1 ? 0 : &b_dash[0]), int(sz), &mp_bs));
 }
 
-inline BorderStyle::BorderStyle(const BorderStyle& bs)
+inline BorderStyle::BorderStyle(const BorderStyle& bs) : mp_bs(0)
 {
 	REX(TRN_AnnotBorderStyleCopy(bs.mp_bs, &mp_bs));
 }
@@ -1020,7 +1020,7 @@ inline BorderStyle& BorderStyle::operator=(const BorderStyle& bs) {
 
 inline bool operator==( const  BorderStyle& a, const  BorderStyle& b )
 {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX( TRN_AnnotBorderStyleCompare( a.mp_bs, b.mp_bs, &result ) );
 	return result!=0;
 }
@@ -1028,7 +1028,7 @@ inline bool operator==( const  BorderStyle& a, const  BorderStyle& b )
 
 inline BorderStyle Annot::GetBorderStyle() const
 {
-	TRN_AnnotBorderStyle result;
+	TRN_AnnotBorderStyle result = 0;
 	REX(TRN_AnnotGetBorderStyle(mp_annot, &result));
 	return BorderStyle(result);
 }
@@ -1040,7 +1040,7 @@ inline void Annot::SetBorderStyle(const BorderStyle& bs, bool oldStyleOnly )
 
 inline BorderStyle::Style BorderStyle::GetStyle() const
 {
-	TRN_AnnotBorderStyleStyle result;
+	TRN_AnnotBorderStyleStyle result = TRN_AnnotBorderStyleStyle();
 	REX(TRN_AnnotBorderStyleGetStyle( mp_bs, &result));
 	return (BorderStyle::Style)result;	
 }
@@ -1052,7 +1052,7 @@ inline void BorderStyle::SetStyle( BorderStyle::Style style)
 
 inline double BorderStyle::GetHR() const
 {
-	double result;
+	double result = 0;
 	REX(TRN_AnnotBorderStyleGetHR(mp_bs,&result));
 	return result;
 }
@@ -1063,7 +1063,7 @@ inline void BorderStyle::SetHR(double hr)
 
 inline double BorderStyle::GetVR() const
 {
-	double result;
+	double result = 0;
 	REX(TRN_AnnotBorderStyleGetVR(mp_bs,&result));
 	return result;
 }
@@ -1073,7 +1073,7 @@ inline void BorderStyle::SetVR(double vr)
 }
 inline double BorderStyle::GetWidth() const
 {
-	double result;
+	double result = 0;
 	REX(TRN_AnnotBorderStyleGetWidth(mp_bs,&result));
 	return result;
 }
@@ -1106,7 +1106,7 @@ inline BorderStyle::BorderStyle(TRN_AnnotBorderStyle impl) { mp_bs=impl; }
 
 inline SDF::Obj Annot::GetAppearance(Annot::AnnotationState as, const char* app_state)
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_AnnotGetAppearance(mp_annot,(enum TRN_AnnotState)as, app_state, &result));
 	return SDF::Obj(result);
 }
@@ -1130,7 +1130,7 @@ inline void Annot::Flatten(Page pg)
 
 inline Page Annot::GetPage() const
 {
-	TRN_Page result;
+	TRN_Page result = 0;
 	REX(TRN_AnnotGetPage(mp_annot, &result));
 	return Page(result);
 }
@@ -1144,7 +1144,7 @@ inline void Annot::SetPage(const Page& page)
 
 inline const char* Annot::GetActiveAppearanceState() const
 {
-	const char* result;
+	const char* result = 0;
 	REX(TRN_AnnotGetActiveAppearanceState(mp_annot, &result));
 	return result;
 }
@@ -1157,7 +1157,7 @@ inline void Annot::SetActiveAppearanceState(const char* astate)
 
 inline int Annot::GetStructParent() const
 {
-	int result;
+	int result = 0;
 	REX(TRN_AnnotGetStructParent(mp_annot, &result)); 
 	return result;
 }
@@ -1169,7 +1169,7 @@ inline void Annot::SetStructParent(const int parkeyval)
 
 inline SDF::Obj Annot::GetOptionalContent() const
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_AnnotGetOptionalContent(mp_annot, &result));
 	return SDF::Obj(result);
 }
@@ -1181,14 +1181,14 @@ inline void Annot::SetOptionalContent(SDF::Obj oc)
 
 // --------------------------------------------
 inline Annot Annot::Create(SDF::SDFDoc& doc, Annot::Type type, const Rect& pos){
-	TRN_Annot result;
+	TRN_Annot result = 0;
 	REX(TRN_AnnotCreate(doc.mp_doc,  static_cast<TRN_AnnotType>(type),(const TRN_Rect*)&pos, &result));
 	return Annot(result);
 }
 
 inline int Annot::GetRotation() const
 {
-	int result;
+	int result = 0;
 	REX(TRN_AnnotGetRotation(mp_annot, &result));
 	return result;
 }
@@ -1219,13 +1219,13 @@ namespace Annots
 
 inline Caret Caret::Create(SDF::SDFDoc& doc, const Rect& pos)
 {
-	TRN_Annot result;
+	TRN_Annot result = 0;
 	REX(TRN_CaretAnnotCreate(doc.mp_doc,(const TRN_Rect*)&pos, &result));
 	return Caret(result);
 }
 inline Caret Caret::Create(SDF::SDFDoc& doc, const Rect& pos, Rect padding)
 {
-	TRN_Annot result;
+	TRN_Annot result = 0;
 	REX(TRN_CaretAnnotCreate(doc.mp_doc,(const TRN_Rect*)&pos, &result));
 	REX(TRN_MarkupAnnotSetPadding(result, (const TRN_Rect*)&padding ));
 	return Caret(result);
@@ -1235,7 +1235,7 @@ inline Caret Caret::Create(SDF::SDFDoc& doc, const Rect& pos, Rect padding)
 //Sy
 inline const char* Caret::GetSymbol() const
 {
-	const char* result;
+	const char* result = 0;
 	REX(TRN_CaretAnnotGetSymbol(mp_annot,&result));
 	return result;
 }
@@ -1259,7 +1259,7 @@ inline Circle::Circle(SDF::Obj d):Markup(d)
 
 inline Circle Circle::Create(SDF::SDFDoc& doc, const Rect& pos)
 {
-	TRN_Annot result;
+	TRN_Annot result = 0;
 	REX(TRN_CircleAnnotCreate(doc.mp_doc,(const TRN_Rect*)&pos, &result));
 	return Circle(result);
 }
@@ -1277,26 +1277,26 @@ inline FileAttachment::FileAttachment(SDF::Obj d):Markup(d)
 }
 
 inline FileAttachment FileAttachment::Create(SDF::SDFDoc& doc, const Rect& pos, FileSpec fs, Icon icon_name ) {
-	TRN_Annot result;
+	TRN_Annot result = 0;
 	REX(TRN_FileAttachmentAnnotCreateWithFileSpec(doc.mp_doc,(const TRN_Rect*)&pos, fs.mp_impl, static_cast<TRN_FileAttachmentAnnotIcon>(icon_name), &result));
 	return FileAttachment(result);
 }
 
 inline FileAttachment FileAttachment::Create(SDF::SDFDoc& doc, const Rect& pos, const UString& path, FileAttachment::Icon icon_name) {
-	TRN_Annot result;
+	TRN_Annot result = 0;
 	REX(TRN_FileAttachmentAnnotCreateWithIcon(doc.mp_doc,(const TRN_Rect*)&pos, path.mp_impl, static_cast<TRN_FileAttachmentAnnotIcon>(icon_name), &result));
 	return FileAttachment(result);
 }
 
 inline FileAttachment FileAttachment::Create(SDF::SDFDoc& doc, const Rect& pos, const UString& path, const char* icon_name) {
-	TRN_Annot result;
+	TRN_Annot result = 0;
 	REX(TRN_FileAttachmentAnnotCreate(doc.mp_doc,(const TRN_Rect*)&pos, path.mp_impl, icon_name, &result));
 	return FileAttachment(result);
 }
 
 //FS
 inline FileSpec FileAttachment::GetFileSpec() const {
-	TRN_FileSpec result;
+	TRN_FileSpec result = 0;
 	REX(TRN_FileAttachmentAnnotGetFileSpec(mp_annot, &result));
 	return FileSpec(result);
 }
@@ -1307,7 +1307,7 @@ inline void FileAttachment::SetFileSpec(const FileSpec& fs) {
 }
 
 inline bool FileAttachment::Export(const UString& save_as) const {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_FileAttachmentAnnotExport(mp_annot, save_as.mp_impl,&result));
 	return TBToB(result);
 }
@@ -1323,7 +1323,7 @@ inline FileAttachment::Icon FileAttachment::GetIcon() const
 
 inline const char* FileAttachment::GetIconName() const
 {
-	const char* result;
+	const char* result = 0;
 	REX(TRN_FileAttachmentAnnotGetIconName(mp_annot,&result));
 	return result;
 }
@@ -1352,7 +1352,7 @@ inline FreeText::FreeText(SDF::Obj d):Markup(d)
 
 inline FreeText FreeText::Create(SDF::SDFDoc& doc, const Rect& pos)
 {
-	TRN_Annot result;
+	TRN_Annot result = 0;
 	REX(TRN_FreeTextAnnotCreate(doc.mp_doc,(const TRN_Rect*)&pos, &result));
 	return FreeText(result);
 }
@@ -1371,7 +1371,7 @@ inline void FreeText::SetDefaultAppearance(const char* app_str)
 //Q   
 inline int FreeText::GetQuaddingFormat() const
 {
-	int result;
+	int result = 0;
 	REX(TRN_FreeTextAnnotGetQuaddingFormat(mp_annot, &result)); 
 	return result;
 }
@@ -1506,7 +1506,7 @@ inline void FreeText::SetFontSize( double font_size )
 
 inline double FreeText::GetFontSize()
 {
-	double font_size;
+	double font_size = 0;
 	REX(TRN_FreeTextAnnotGetFontSize(mp_annot, &font_size));
 	return font_size;
 }
@@ -1533,7 +1533,7 @@ inline Highlight::Highlight(SDF::Obj d):TextMarkup(d)
 
 inline Highlight Highlight::Create(SDF::SDFDoc& doc, const Rect& pos)
 {
-		TRN_Annot result;
+		TRN_Annot result = 0;
 		REX(TRN_HighlightAnnotCreate(doc.mp_doc,(const TRN_Rect*)&pos, &result));
 		return Highlight(result); 
 }
@@ -1550,7 +1550,7 @@ inline Ink::Ink(SDF::Obj d):Markup(d)
 
 inline Ink Ink::Create(SDF::SDFDoc& doc, const Rect& pos)
 {
-	TRN_Annot result;
+	TRN_Annot result = 0;
 	REX(TRN_InkAnnotCreate(doc.mp_doc,(const TRN_Rect*)&pos, &result));
 	return Ink(result);
 }
@@ -1559,21 +1559,21 @@ inline Ink Ink::Create(SDF::SDFDoc& doc, const Rect& pos)
 //InkList
 inline int Ink::GetPathCount()const
 {
-	int result;
+	int result = 0;
 	REX(TRN_InkAnnotGetPathCount(mp_annot, &result));
 	return result;
 }
 
 inline int Ink::GetPointCount(unsigned int pathindex)const
 {
-	int result;
+	int result = 0;
 	REX(TRN_InkAnnotGetPointCount(mp_annot, pathindex, &result));
 	return result;
 }
 
 inline Point Ink::GetPoint(unsigned int pathindex, unsigned int pointindex)const
 {
-	TRN_Point result;
+	TRN_Point result = TRN_Point();
 	REX(TRN_InkAnnotGetPoint(mp_annot, pathindex, pointindex, &result));
 	return *((Point*)&result);
 }
@@ -1585,7 +1585,7 @@ inline void Ink::SetPoint(unsigned int pathindex, unsigned int pointindex, const
 
 inline bool Ink::Erase(const Point& pt1, const Point& pt2, double width)
 {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_InkAnnotErase(mp_annot, (const TRN_Point*)&pt1, (const TRN_Point*)&pt2, width, &result));
 	return TBToB(result);
 }
@@ -1603,7 +1603,7 @@ inline Line::Line(SDF::Obj d):Markup(d)
 
 inline Line Line::Create(SDF::SDFDoc& doc, const Rect& pos)
 {
-	TRN_Annot result;
+	TRN_Annot result = 0;
 	REX(TRN_LineAnnotCreate(doc.mp_doc,(const TRN_Rect*)&pos, &result));
 	return Line(result);
 }
@@ -1611,7 +1611,7 @@ inline Line Line::Create(SDF::SDFDoc& doc, const Rect& pos)
 
 inline Point Line::GetStartPoint() const
 {
-	TRN_Point result;
+	TRN_Point result = TRN_Point();
 	REX(TRN_LineAnnotGetStartPoint(mp_annot, &result));
 	return *((Point*)&result);
 }
@@ -1624,7 +1624,7 @@ inline void Line::SetStartPoint(const Point& sp)
 
 inline Point Line::GetEndPoint () const
 {
-	TRN_Point result;
+	TRN_Point result = TRN_Point();
 	REX(TRN_LineAnnotGetEndPoint(mp_annot, &result));
 	return *((Point*)&result);
 }
@@ -1664,7 +1664,7 @@ inline void Line::SetEndStyle(EndingStyle est)
 //LL //Only required if LLE presents. 
 inline double Line::GetLeaderLineLength() const
 {
-	double result;
+	double result = 0;
 	REX(TRN_LineAnnotGetLeaderLineLength(mp_annot, &result)); 
 	return result;
 }
@@ -1677,7 +1677,7 @@ inline void Line::SetLeaderLineLength(const double& ll)
 //LLE
 inline double Line::GetLeaderLineExtensionLength() const
 {
-	double result;
+	double result = 0;
 	REX(TRN_LineAnnotGetLeaderLineExtensionLength(mp_annot, &result)); 
 	return result;
 }
@@ -1690,7 +1690,7 @@ inline void Line::SetLeaderLineExtensionLength(const double& ll)
 //Cap
 inline bool Line::GetShowCaption() const
 {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_LineAnnotGetShowCaption(mp_annot, &result));
 	return TBToB(result);
 }
@@ -1716,7 +1716,7 @@ inline void Line::SetIntentType(IntentType style)
 //LLO
 inline double Line::GetLeaderLineOffset() const
 {
-	double result;
+	double result = 0;
 	REX(TRN_LineAnnotGetLeaderLineOffset(mp_annot, &result)); 
 	return result;
 }
@@ -1741,7 +1741,7 @@ inline void Line::SetCaptionPosition(const CapPos& style)
 
 inline double Line::GetTextHOffset() const
 {
-	double result;
+	double result = 0;
 	REX(TRN_LineAnnotGetTextHOffset(mp_annot, &result)); 
 	return result;
 }
@@ -1753,7 +1753,7 @@ inline void Line::SetTextHOffset(double offset)
 
 inline double Line::GetTextVOffset() const
 {
-	double result;
+	double result = 0;
 	REX(TRN_LineAnnotGetTextVOffset(mp_annot, &result)); 
 	return result;
 }
@@ -1775,14 +1775,14 @@ inline Link::Link(SDF::Obj d):Annot(d)
 }
 
 inline Link Link::Create(SDF::SDFDoc& doc, const Rect& pos){
-	TRN_Annot result;
+	TRN_Annot result = 0;
 	REX(TRN_LinkAnnotCreate(doc.mp_doc,(const TRN_Rect*)&pos, &result));
 	return Link(result);
 }
 
 inline Link Link::Create(SDF::SDFDoc& doc, const Rect& pos, const Action& action)
 {
-	TRN_Annot result;
+	TRN_Annot result = 0;
 	REX(TRN_LinkAnnotCreate(doc.mp_doc,(const TRN_Rect*)&pos, &result));
 	REX(TRN_LinkAnnotSetAction(result, action.mp_action ));
 	return Link(result);
@@ -1795,7 +1795,7 @@ inline void Link::RemoveAction(){
 
 inline UString Link::GetNormalizedUrl(const UString& url)
 {
-    TRN_UString result;
+    TRN_UString result = 0;
     REX(TRN_GetNormalizedUrl(url.mp_impl, &result));
     return UString(result);
 }
@@ -1803,7 +1803,7 @@ inline UString Link::GetNormalizedUrl(const UString& url)
  //A
 inline Action Link::GetAction() const
  {
-	TRN_Action result;
+	TRN_Action result = 0;
 	REX(TRN_LinkAnnotGetAction(mp_annot,&result));
 	return Action(result);
  }
@@ -1828,14 +1828,14 @@ inline void Link::SetHighlightingMode(HighlightingMode mode)
 
 inline int Link::GetQuadPointCount() const
 {
-	int result;
+	int result = 0;
 	REX(TRN_LinkAnnotGetQuadPointCount(mp_annot, &result));
 	return result;		
 }
 
 inline QuadPoint Link::GetQuadPoint(int idx) const
 {
-	TRN_QuadPoint result;
+	TRN_QuadPoint result = TRN_QuadPoint();
 	REX(TRN_LinkAnnotGetQuadPoint(mp_annot, idx, &result));
 	return *((QuadPoint*)&result);
 }
@@ -1859,7 +1859,7 @@ inline Movie::Movie(SDF::Obj d):Annot(d)
 
 inline Movie Movie::Create(SDF::SDFDoc& doc, const Rect& pos)
 {
-	TRN_Annot result;
+	TRN_Annot result = 0;
 	REX(TRN_MovieAnnotCreate(doc.mp_doc,(const TRN_Rect*)&pos, &result));
 	return Movie(result);
 }
@@ -1878,7 +1878,7 @@ inline void Movie::SetTitle(const UString& title)
 
 inline bool Movie::IsToBePlayed() const
 {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_MovieAnnotIsToBePlayed(mp_annot,&result));
 	return TBToB(result);
 }
@@ -1903,7 +1903,7 @@ inline PolyLine::PolyLine(SDF::Obj d): Line(d)
 
 inline PolyLine PolyLine::Create(SDF::SDFDoc& doc, const Rect& pos)
 {
-	TRN_Annot result;
+	TRN_Annot result = 0;
 	REX(TRN_PolyLineAnnotCreate(doc.mp_doc,(const TRN_Rect*)&pos, &result));
 	return PolyLine(result);
 }
@@ -1916,14 +1916,14 @@ inline PolyLine::PolyLine(TRN_Annot polyline) : Line(polyline)
 
 inline int PolyLine::GetVertexCount() const
 {
-	int result;
+	int result = 0;
 	REX(TRN_PolyLineAnnotGetVertexCount(mp_annot, &result));
 	return result;
 }
 
 inline Point PolyLine::GetVertex(int idx) const
 {
-	TRN_Point result;
+	TRN_Point result = TRN_Point();
 	REX(TRN_PolyLineAnnotGetVertex(mp_annot, idx, &result));
 	return *((Point*)&result);
 }
@@ -1959,7 +1959,7 @@ inline Polygon::Polygon(SDF::Obj d): PolyLine(d)
 
 inline Polygon Polygon::Create(SDF::SDFDoc& doc, const Rect& pos)
 {
-	TRN_Annot result;
+	TRN_Annot result = 0;
 	REX(TRN_PolygonAnnotCreate(doc.mp_doc,(const TRN_Rect*)&pos, &result));
 	return Polygon(result);
 }
@@ -1979,7 +1979,7 @@ inline Popup::Popup(SDF::Obj d):Annot(d)
 
 inline Popup Popup::Create(SDF::SDFDoc& doc, const Rect& pos)
 {
-	TRN_Annot result;
+	TRN_Annot result = 0;
 	REX(TRN_PopupAnnotCreate(doc.mp_doc,(const TRN_Rect*)&pos, &result));
 	return Popup(result);
 }
@@ -1988,7 +1988,7 @@ inline Popup Popup::Create(SDF::SDFDoc& doc, const Rect& pos)
 //Parent
 inline Annot Popup::GetParent() const
 {
-	TRN_Annot result;
+	TRN_Annot result = 0;
 	REX(TRN_PopupAnnotGetParent(mp_annot,&result));
 	return Annot(result);	
 }
@@ -2002,7 +2002,7 @@ inline void Popup::SetParent(const Annot& parent)
 //Open
 inline bool Popup::IsOpen() const
 {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_PopupAnnotIsOpen(mp_annot,&result));
 	return TBToB(result);	
 }
@@ -2025,21 +2025,21 @@ inline Redaction::Redaction(SDF::Obj d):Markup(d)
 }
 inline Redaction Redaction::Create(SDF::SDFDoc& doc, const Rect& pos)
 {
-	TRN_Annot result;
+	TRN_Annot result = 0;
 	REX(TRN_RedactionAnnotCreate(doc.mp_doc,(const TRN_Rect*)&pos, &result));
 	return Redaction(result);
 }
 
 inline int Redaction::GetQuadPointCount()
 {
-	int result;
+	int result = 0;
 	REX(TRN_RedactionAnnotGetQuadPointCount(mp_annot, &result));
 	return result;				
 }
 
 inline QuadPoint Redaction::GetQuadPoint(int idx) const
 {
-	TRN_QuadPoint result;
+	TRN_QuadPoint result = TRN_QuadPoint();
 	REX(TRN_RedactionAnnotGetQuadPoint(mp_annot, idx, &result));
 	return *((QuadPoint*)&result);
 }
@@ -2054,7 +2054,7 @@ inline void Redaction::SetQuadPoint(int idx, const QuadPoint& qp)
 //RO //According to Ivan, just using SDF::Obj
 inline SDF::Obj Redaction::GetAppFormXO()const
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_RedactionAnnotGetAppFormXO(mp_annot,&result));
 	return SDF::Obj(result);
 }
@@ -2067,7 +2067,7 @@ inline void Redaction::SetAppFormXO(SDF::Obj formxo)
 //OverlayText
 inline UString Redaction::GetOverlayText() const
 {
-	TRN_UString result;
+	TRN_UString result = 0;
 	REX(TRN_RedactionAnnotGetOverlayText(mp_annot,&result));
 	return UString(result);	
 }
@@ -2079,7 +2079,7 @@ inline void Redaction::SetOverlayText(const UString& title)
 //Repeat
 inline bool Redaction::GetUseRepeat() const
 {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_RedactionAnnotGetUseRepeat(mp_annot,&result));
 	return TBToB(result);
 }
@@ -2092,7 +2092,7 @@ inline void Redaction::SetUseRepeat(bool repeat)
 //DA
 inline UString Redaction::GetOverlayTextAppearance() const
 {
-	TRN_UString result;
+	TRN_UString result = 0;
 	REX(TRN_RedactionAnnotGetOverlayTextAppearance(mp_annot,&result));
 	return UString(result);
 }
@@ -2128,7 +2128,7 @@ inline RubberStamp::RubberStamp(SDF::Obj d):Markup(d)
 
 inline RubberStamp RubberStamp::Create(SDF::SDFDoc& doc, const Rect& pos, Icon icon)
 {
-	TRN_Annot result;
+	TRN_Annot result = 0;
 	REX(TRN_RubberStampAnnotCreate(doc.mp_doc,(const TRN_Rect*)&pos, &result));
 	return RubberStamp(result);
 }
@@ -2147,7 +2147,7 @@ inline void RubberStamp::SetIcon(Icon type)
 }
 inline const char* RubberStamp::GetIconName() const
 {
-	const char* result;
+	const char* result = 0;
 	REX(TRN_RubberStampAnnotGetIconName(mp_annot, &result));
 	return result;
 }
@@ -2172,7 +2172,7 @@ inline Sound::Sound(SDF::Obj d):Markup(d)
 
 inline Sound Sound::Create(SDF::SDFDoc& doc, const Rect& pos, Sound::Icon icon)
 {
-	TRN_Annot result;
+	TRN_Annot result = 0;
 	REX(TRN_SoundAnnotCreate(doc.mp_doc,(const TRN_Rect*)&pos, &result));
 	REX(TRN_SoundAnnotSetIcon( result, (TRN_SoundAnnotIcon)icon ) );
 	return Sound(result);
@@ -2180,7 +2180,7 @@ inline Sound Sound::Create(SDF::SDFDoc& doc, const Rect& pos, Sound::Icon icon)
 
 inline Sound Sound::Create(SDF::SDFDoc& doc, const Point& pos, Sound::Icon icon)
 {
-	TRN_Annot result;
+	TRN_Annot result = 0;
 	REX(TRN_SoundAnnotCreateAtPoint(doc.mp_doc,(const TRN_Point*)&pos, &result));
 	REX(TRN_SoundAnnotSetIcon( result, (TRN_SoundAnnotIcon)icon ) );
 	return Sound(result);
@@ -2191,7 +2191,7 @@ inline Sound Sound::Create(SDF::SDFDoc& doc, const Point& pos, Sound::Icon icon)
 //Sound
 inline SDF::Obj Sound::GetSoundStream() const
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_SoundAnnotGetSoundStream(mp_annot, &result));
 	return SDF::Obj(result);
 }
@@ -2214,7 +2214,7 @@ inline void Sound::SetIcon(Icon type)
 
 inline const char* Sound::GetIconName() const
 {
-	const char* result;
+	const char* result = 0;
 	REX(TRN_SoundAnnotGetIconName(mp_annot, &result));
 	return result;
 }
@@ -2236,7 +2236,7 @@ inline Square::Square(SDF::Obj d):Markup(d)
 
 inline Square Square::Create(SDF::SDFDoc& doc, const Rect& pos)
 {
-	TRN_Annot result;
+	TRN_Annot result = 0;
 	REX(TRN_SquareAnnotCreate(doc.mp_doc,(const TRN_Rect*)&pos, &result));
 	return Square(result);
 }
@@ -2254,7 +2254,7 @@ inline Squiggly::Squiggly(SDF::Obj d):TextMarkup(d)
 
 inline Squiggly Squiggly::Create(SDF::SDFDoc& doc, const Rect& pos)
 {
-	TRN_Annot result;
+	TRN_Annot result = 0;
 	REX(TRN_SquigglyAnnotCreate(doc.mp_doc,(const TRN_Rect*)&pos, &result));
 	return Squiggly(result); 
 }
@@ -2271,7 +2271,7 @@ inline StrikeOut::StrikeOut(SDF::Obj d):TextMarkup(d)
 
 inline StrikeOut StrikeOut::Create(SDF::SDFDoc& doc, const Rect& pos)
 {
-	TRN_Annot result;
+	TRN_Annot result = 0;
 	REX(TRN_StrikeOutAnnotCreate(doc.mp_doc,(const TRN_Rect*)&pos, &result));
 	return StrikeOut(result); 
 }
@@ -2296,7 +2296,7 @@ inline Text::Text(SDF::Obj d):Markup(d)
 
 inline Text Text::Create(SDF::SDFDoc& doc, const Rect& pos, const UString& contents)
 {
-	TRN_Annot result;
+	TRN_Annot result = 0;
 	REX(TRN_TextAnnotCreate(doc.mp_doc,(const TRN_Rect*)&pos, &result));
 	REX(TRN_AnnotSetContents(result, contents.mp_impl));
 	return Text(result);
@@ -2304,7 +2304,7 @@ inline Text Text::Create(SDF::SDFDoc& doc, const Rect& pos, const UString& conte
 
 inline Text Text::Create(SDF::SDFDoc& doc, const Point& pos, const UString& contents)
 {
-	TRN_Annot result;
+	TRN_Annot result = 0;
 	REX(TRN_TextAnnotCreateAtPoint(doc.mp_doc,(const TRN_Point*)&pos, &result));
 	if( contents.GetLength() > 0 )
 		REX(TRN_AnnotSetContents(result, contents.mp_impl));
@@ -2313,7 +2313,7 @@ inline Text Text::Create(SDF::SDFDoc& doc, const Point& pos, const UString& cont
 
 inline bool Text::IsOpen() const
 {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_TextAnnotIsOpen(mp_annot,&result));
 	return TBToB(result);
 }
@@ -2337,7 +2337,7 @@ inline void Text::SetIcon(Icon type)
 
 inline const char* Text::GetIconName() const
 {
-	const char* result;
+	const char* result = 0;
 	REX(TRN_TextAnnotGetIconName(mp_annot, &result));
 	return result;
 }
@@ -2350,7 +2350,7 @@ inline void Text::SetIcon(const char* icon)
 //State
 inline UString Text::GetState() const
 {
-	TRN_UString result;
+	TRN_UString result = 0;
 	REX(TRN_TextAnnotGetState(mp_annot,&result));
 	return UString(result);	
 }
@@ -2363,7 +2363,7 @@ inline void Text::SetState(const UString& state)
 //StateModel
 inline UString Text::GetStateModel() const
 {
-	TRN_UString result;
+	TRN_UString result = 0;
 	REX(TRN_TextAnnotGetStateModel(mp_annot,&result));
 	return UString(result);	
 }
@@ -2387,14 +2387,14 @@ inline TextMarkup::TextMarkup(SDF::Obj d):Markup(d)
 
 inline int TextMarkup::GetQuadPointCount()
 {
-	int result;
+	int result = 0;
 	REX(TRN_TextMarkupAnnotGetQuadPointCount(mp_annot, &result));
 	return result;					
 }
 
 inline QuadPoint TextMarkup::GetQuadPoint(int idx) const
 {
-	TRN_QuadPoint result;
+	TRN_QuadPoint result = TRN_QuadPoint();
 	REX(TRN_TextMarkupAnnotGetQuadPoint(mp_annot, idx, &result));
 	return *((QuadPoint*)&result);
 }
@@ -2417,7 +2417,7 @@ inline Underline::Underline(SDF::Obj d):TextMarkup(d)
 
 inline Underline Underline::Create(SDF::SDFDoc& doc, const Rect& pos)
 {
-	TRN_Annot result;
+	TRN_Annot result = 0;
 	REX(TRN_UnderlineAnnotCreate(doc.mp_doc,(const TRN_Rect*)&pos, &result));
 	return Underline(result); 
 }
@@ -2435,7 +2435,7 @@ inline Watermark::Watermark(SDF::Obj d):Annot(d)
 
 inline Watermark Watermark::Create(SDF::SDFDoc& doc, const Rect& pos)
 {
-	TRN_Annot result;
+	TRN_Annot result = 0;
 	REX(TRN_WatermarkAnnotCreate(doc.mp_doc,(const TRN_Rect*)&pos, &result));
 	return Watermark(result); 
 }
@@ -0,0 +1,153 @@
+
+inline PageIndex::PageIndex() : mp_doc(0)
+{
+}
+
+inline PageIndex::PageIndex(PDFDoc& doc) : mp_doc(0)
+{
+	Build(doc);
+}
+
+inline void PageIndex::Build(PDFDoc& doc)
+{
+	mp_doc = &doc;
+	m_pages.clear();
+	m_pages.reserve(doc.GetPageCount());
+	for (PageIterator itr = doc.GetPageIterator(); itr.HasNext(); itr.Next()) {
+		m_pages.push_back(itr.Current().GetSDFObj().mp_obj);
+	}
+}
+
+inline PDFDoc* PageIndex::GetDoc() const
+{
+	return mp_doc;
+}
+
+inline int PageIndex::GetPageCount() const
+{
+	return (int)m_pages.size();
+}
+
+inline Page PageIndex::GetPage(UInt32 page_number) const
+{
+	return Page(GetPageObj(page_number));
+}
+
+inline SDF::Obj PageIndex::GetPageObj(UInt32 page_number) const
+{
+	if (page_number < 1 || page_number > m_pages.size()) return SDF::Obj(0);
+	return SDF::Obj(m_pages[page_number - 1]);
+}
+
+inline void PageIndex::PageInsert(UInt32 insert_before_page_number, Page page)
+{
+	BASE_ASSERT_RET_VOID(mp_doc, "Empty PageIndex");
+	int pos = ClampInsertPos((int)insert_before_page_number);
+	if (pos > GetPageCount()) {
+		mp_doc->PagePushBack(page);
+	}
+	else {
+		PageIterator where = mp_doc->GetPageIterator(pos);
+		mp_doc->PageInsert(where, page);
+	}
+	LoadRange(pos, 1);
+}
+
+inline void PageIndex::PagePushFront(Page page)
+{
+	BASE_ASSERT_RET_VOID(mp_doc, "Empty PageIndex");
+	mp_doc->PagePushFront(page);
+	LoadRange(1, 1);
+}
+
+inline void PageIndex::PagePushBack(Page page)
+{
+	BASE_ASSERT_RET_VOID(mp_doc, "Empty PageIndex");
+	mp_doc->PagePushBack(page);
+	LoadRange(GetPageCount() + 1, 1);
+}
+
+inline void PageIndex::PageRemove(UInt32 page_number)
+{
+	BASE_ASSERT_RET_VOID(mp_doc, "Empty PageIndex");
+	BASE_ASSERT_RET_VOID(page_number >= 1 && page_number <= m_pages.size(), "Invalid page number");
+	mp_doc->PageRemove(mp_doc->GetPageIterator(page_number));
+	EraseRange((int)page_number, 1);
+}
+
+inline void PageIndex::InsertPages(int insert_before_page_number, PDFDoc& src_doc, int start_page, int end_page,
+	PDFDoc::InsertFlag flag)
+{
+	BASE_ASSERT_RET_VOID(mp_doc, "Empty PageIndex");
+	int pos = ClampInsertPos(insert_before_page_number);
+	int count_before = mp_doc->GetPageCount();
+	mp_doc->InsertPages(insert_before_page_number, src_doc, start_page, end_page, flag);
+	LoadRange(pos, mp_doc->GetPageCount() - count_before);
+}
+
+inline void PageIndex::MovePages(int move_before_page_number, PDFDoc& src_doc, int start_page, int end_page,
+	PDFDoc::InsertFlag flag, PageIndex* src_index)
+{
+	BASE_ASSERT_RET_VOID(mp_doc, "Empty PageIndex");
+	if (&src_doc == mp_doc) {
+		// pages are moved within the document; the positions of the pages
+		// between the source and the destination range change as well
+		mp_doc->MovePages(move_before_page_number, src_doc, start_page, end_page, flag);
+		Build(*mp_doc);
+		if (src_index && src_index != this) src_index->Build(src_doc);
+		return;
+	}
+
+	int pos = ClampInsertPos(move_before_page_number);
+	int count_before = mp_doc->GetPageCount();
+	int src_count_before = src_doc.GetPageCount();
+	mp_doc->MovePages(move_before_page_number, src_doc, start_page, end_page, flag);
+	LoadRange(pos, mp_doc->GetPageCount() - count_before);
+	if (src_index) {
+		src_index->EraseRange(start_page < 1 ? 1 : start_page, src_count_before - src_doc.GetPageCount());
+	}
+}
+
+inline void PageIndex::Lookup(PDFDoc& doc, const std::vector<int>& page_nums, std::vector<SDF::Obj>& out_pages)
+{
+	out_pages.clear();
+	out_pages.reserve(page_nums.size());
+	if (page_nums.size() * 8 >= (size_t)doc.GetPageCount()) {
+		PageIndex index(doc);
+		for (size_t i = 0; i < page_nums.size(); ++i) {
+			out_pages.push_back(index.GetPageObj(page_nums[i]));
+		}
+	}
+	else {
+		for (size_t i = 0; i < page_nums.size(); ++i) {
+			Page page = doc.GetPage(page_nums[i]);
+			out_pages.push_back(page.IsValid() ? page.GetSDFObj() : SDF::Obj(0));
+		}
+	}
+}
+
+inline int PageIndex::ClampInsertPos(int insert_before_page_number) const
+{
+	if (insert_before_page_number < 1) return 1;
+	if (insert_before_page_number > GetPageCount()) return GetPageCount() + 1;
+	return insert_before_page_number;
+}
+
+inline void PageIndex::LoadRange(int first_page, int count)
+{
+	if (count <= 0) return;
+	std::vector<TRN_Obj> pages;
+	pages.reserve(count);
+	PageIterator itr = mp_doc->GetPageIterator(first_page);
+	for (int i = 0; i < count && itr.HasNext(); ++i, itr.Next()) {
+		pages.push_back(itr.Current().GetSDFObj().mp_obj);
+	}
+	m_pages.insert(m_pages.begin() + (first_page - 1), pages.begin(), pages.end());
+}
+
+inline void PageIndex::EraseRange(int first_page, int count)
+{
+	if (count <= 0 || first_page > GetPageCount()) return;
+	if (first_page - 1 + count > GetPageCount()) count = GetPageCount() - first_page + 1;
+	m_pages.erase(m_pages.begin() + (first_page - 1), m_pages.begin() + (first_page - 1 + count));
+}
@@ -5,7 +5,7 @@ inline PageLabel::PageLabel(const TRN_PageLabel& l) : TRN_PageLabel(l)
 
 inline PageLabel PageLabel::Create(SDF::SDFDoc& doc, Style style, const UString& prefix, int start_at)
 {
-	TRN_PageLabel result;
+	TRN_PageLabel result = TRN_PageLabel();
 	REX(TRN_PageLabelCreate(doc.mp_doc,(enum TRN_PageLabelStyle)style,prefix.mp_impl,start_at,&result));
 	return result;
 }
@@ -1,14 +1,14 @@
-inline PageSet::PageSet( )
+inline PageSet::PageSet( ) : mp_impl(0)
 {
 	REX( TRN_PageSetCreate(&mp_impl) );
 }
 
-inline PageSet::PageSet( int one_page )
+inline PageSet::PageSet( int one_page ) : mp_impl(0)
 {
 	REX(TRN_PageSetCreateSinglePage(one_page, &mp_impl));
 }  
 
-inline PageSet::PageSet( int range_start, int range_end, Filter filter )
+inline PageSet::PageSet( int range_start, int range_end, Filter filter ) : mp_impl(0)
 {
 	REX(TRN_PageSetCreateFilteredRange(range_start, range_end, (TRN_PageSetFilter)filter, &mp_impl));
 }
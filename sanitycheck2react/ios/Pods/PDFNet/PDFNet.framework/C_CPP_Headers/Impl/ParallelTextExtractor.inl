@@ -0,0 +1,70 @@
+inline ParallelTextExtractor::ParallelTextExtractor(int num_threads)
+	: m_scheduler(num_threads), m_flags(0), m_rtl(false), m_has_clip(false)
+{
+}
+
+inline int ParallelTextExtractor::GetThreadCount() const
+{
+	return m_scheduler.GetThreadCount();
+}
+
+inline void ParallelTextExtractor::SetProcessingFlags(UInt32 flags)
+{
+	m_flags = flags;
+}
+
+inline void ParallelTextExtractor::SetRightToLeftLanguage(bool rtl)
+{
+	m_rtl = rtl;
+}
+
+inline void ParallelTextExtractor::SetClipRect(const Rect* clip)
+{
+	m_has_clip = clip != 0;
+	if (clip) m_clip = *clip;
+}
+
+inline void ParallelTextExtractor::Process(PDFDoc& doc, const std::vector<int>& page_nums, const PageProc& proc)
+{
+	int num_workers = m_scheduler.GetThreadCount();
+	if (num_workers > (int)page_nums.size()) num_workers = (int)page_nums.size();
+
+	// one extractor per worker, created lazily on the worker's thread
+	std::vector<std::unique_ptr<TextExtractor> > extractors(num_workers);
+	const Rect* clip = m_has_clip ? &m_clip : 0;
+
+	// resolve all pages up front, so that the workers do not walk the page tree
+	std::vector<SDF::Obj> pages;
+	{
+		DocReadGuard guard(doc, "ParallelTextExtractor::Process (page lookup)");
+		PageIndex::Lookup(doc, page_nums, pages);
+	}
+
+	m_scheduler.Run((int)page_nums.size(), [&](int idx, int worker) {
+		if (!extractors[worker]) {
+			extractors[worker].reset(new TextExtractor());
+			extractors[worker]->SetRightToLeftLanguage(m_rtl);
+		}
+		TextExtractor& te = *extractors[worker];
+
+		DocReadGuard guard(doc, "ParallelTextExtractor::Process (extract)");
+		te.Begin(Page(pages[idx]), clip, m_flags);
+		proc(idx, page_nums[idx], te);
+	});
+}
+
+inline void ParallelTextExtractor::ExtractText(PDFDoc& doc, const std::vector<int>& page_nums, std::vector<UString>& out_text, bool dehyphen)
+{
+	out_text.resize(page_nums.size());
+	Process(doc, page_nums, [&](int idx, int, TextExtractor& te) {
+		te.GetAsText(out_text[idx], dehyphen);
+	});
+}
+
+inline void ParallelTextExtractor::ExtractPageData(PDFDoc& doc, const std::vector<int>& page_nums, std::vector<PageTextData>& out_data, UInt32 flags)
+{
+	out_data.resize(page_nums.size());
+	Process(doc, page_nums, [&](int idx, int, TextExtractor& te) {
+		te.GetPageData(out_data[idx], flags);
+	});
+}
@@ -1,20 +1,42 @@
 
-inline PatternColor::PatternColor (SDF::Obj pattern)
+inline PatternColor::PatternColor (SDF::Obj pattern) : mp_pc(0)
 {
 	REX(TRN_PatternColorCreate(pattern.mp_obj,&mp_pc));
 }
 
-inline PatternColor::PatternColor(const PatternColor& c)
+inline PatternColor::PatternColor(const PatternColor& c) : mp_pc(0)
 {
+	if (!c.mp_pc) return;	// a copy of a moved-from pattern is null
 	REX(TRN_PatternColorCreate(0,&mp_pc));
 	REX(TRN_PatternColorAssign(mp_pc,c.mp_pc));
 }
 inline PatternColor& PatternColor::operator=(const PatternColor& c)
 {
+	if (!c.mp_pc) {
+		DREX(mp_pc, TRN_PatternColorDestroy(mp_pc));
+		return *this;
+	}
+	if (!mp_pc) {
+		// moved-from target
+		REX(TRN_PatternColorCreate(0,&mp_pc));
+	}
 	REX(TRN_PatternColorAssign(mp_pc,c.mp_pc));
 	return *this;
 }
 
+#ifdef PDFTRON_CPP11
+inline PatternColor::PatternColor(PatternColor&& other) noexcept : mp_pc(other.mp_pc)
+{
+	other.mp_pc = 0;
+}
+
+inline PatternColor& PatternColor::operator=(PatternColor&& other) noexcept
+{
+	std::swap(mp_pc, other.mp_pc);
+	return *this;
+}
+#endif
+
 inline PatternColor::~PatternColor()
 {
 	DREX(mp_pc, TRN_PatternColorDestroy(mp_pc));
@@ -52,7 +74,7 @@ inline Common::Matrix2D PatternColor::GetMatrix()
 
 inline Shading PatternColor::GetShading()
 {
-	TRN_Shading result;
+	TRN_Shading result = 0;
 	REX(TRN_PatternColorGetShading(mp_pc,&result));
 	return Shading(result);
 }
@@ -84,7 +106,7 @@ inline PatternColor::PatternColor(TRN_PatternColor impl) : mp_pc(impl)
 {
 }
 
-inline PatternColor::PatternColor()
+inline PatternColor::PatternColor() : mp_pc(0)
 {
 	REX(TRN_PatternColorCreate(0,&mp_pc));
 }
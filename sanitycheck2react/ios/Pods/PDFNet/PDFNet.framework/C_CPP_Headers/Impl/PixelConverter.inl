@@ -0,0 +1,358 @@
+
+inline void PixelConverter::SwapRedBlue(const UChar* src, int src_stride, UChar* dst, int dst_stride, int width, int height)
+{
+	for (int y = 0; y < height; ++y) {
+		SwapRedBlueRow(src + (ptrdiff_t)y * src_stride, dst + (ptrdiff_t)y * dst_stride, width);
+	}
+}
+
+inline void PixelConverter::Premultiply(const UChar* src, int src_stride, UChar* dst, int dst_stride, int width, int height)
+{
+	for (int y = 0; y < height; ++y) {
+		PremultiplyRow(src + (ptrdiff_t)y * src_stride, dst + (ptrdiff_t)y * dst_stride, width);
+	}
+}
+
+inline void PixelConverter::Demultiply(const UChar* src, int src_stride, UChar* dst, int dst_stride, int width, int height)
+{
+	for (int y = 0; y < height; ++y) {
+		DemultiplyRow(src + (ptrdiff_t)y * src_stride, dst + (ptrdiff_t)y * dst_stride, width);
+	}
+}
+
+inline void PixelConverter::BGRAToRGB(const UChar* src, int src_stride, UChar* dst, int dst_stride, int width, int height)
+{
+	for (int y = 0; y < height; ++y) {
+		BGRAToRGBRow(src + (ptrdiff_t)y * src_stride, dst + (ptrdiff_t)y * dst_stride, width);
+	}
+}
+
+inline void PixelConverter::BGRAToGray(const UChar* src, int src_stride, UChar* dst, int dst_stride, int width, int height)
+{
+	for (int y = 0; y < height; ++y) {
+		BGRAToGrayRow(src + (ptrdiff_t)y * src_stride, dst + (ptrdiff_t)y * dst_stride, width);
+	}
+}
+
+inline void PixelConverter::BGRAToI420(const UChar* src, int src_stride,
+	UChar* dst_y, int y_stride, UChar* dst_u, int u_stride, UChar* dst_v, int v_stride,
+	int width, int height)
+{
+	for (int y = 0; y < height; y += 2) {
+		const UChar* row0 = src + (ptrdiff_t)y * src_stride;
+		const UChar* row1 = y + 1 < height ? row0 + src_stride : row0;
+		BGRAToYRow(row0, dst_y + (ptrdiff_t)y * y_stride, width);
+		if (y + 1 < height) {
+			BGRAToYRow(row1, dst_y + (ptrdiff_t)(y + 1) * y_stride, width);
+		}
+		BGRAToUVRow(row0, row1, dst_u + (ptrdiff_t)(y / 2) * u_stride, dst_v + (ptrdiff_t)(y / 2) * v_stride, width);
+	}
+}
+
+// Row kernels -------------------------------------------------------------------------
+// Each kernel processes as many pixels as possible with SIMD instructions and
+// finishes the row with the portable code, which defines the exact results.
+
+inline void PixelConverter::SwapRedBlueRow(const UChar* src, UChar* dst, int width)
+{
+	int x = 0;
+#if defined(PDFTRON_PIXEL_AVX2)
+	const __m256i mask256 = _mm256_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15,
+		2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+	for (; x + 8 <= width; x += 8) {
+		__m256i v = _mm256_loadu_si256((const __m256i*)(src + x * 4));
+		_mm256_storeu_si256((__m256i*)(dst + x * 4), _mm256_shuffle_epi8(v, mask256));
+	}
+#endif
+#if defined(PDFTRON_PIXEL_SSSE3)
+	const __m128i mask = _mm_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+	for (; x + 4 <= width; x += 4) {
+		__m128i v = _mm_loadu_si128((const __m128i*)(src + x * 4));
+		_mm_storeu_si128((__m128i*)(dst + x * 4), _mm_shuffle_epi8(v, mask));
+	}
+#endif
+	for (; x < width; ++x) {
+		const UChar* s = src + x * 4;
+		UChar* d = dst + x * 4;
+		UChar c0 = s[0], c2 = s[2];
+		d[0] = c2;
+		d[1] = s[1];
+		d[2] = c0;
+		d[3] = s[3];
+	}
+}
+
+inline void PixelConverter::PremultiplyRow(const UChar* src, UChar* dst, int width)
+{
+	int x = 0;
+#if defined(PDFTRON_PIXEL_AVX2)
+	{
+		const __m256i zero = _mm256_setzero_si256();
+		const __m256i round = _mm256_set1_epi16(128);
+		const __m256i alpha_mask = _mm256_set1_epi32((int)0xFF000000);
+		for (; x + 8 <= width; x += 8) {
+			__m256i v = _mm256_loadu_si256((const __m256i*)(src + x * 4));
+			__m256i lo = _mm256_unpacklo_epi8(v, zero);
+			__m256i hi = _mm256_unpackhi_epi8(v, zero);
+			__m256i alo = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(lo, 0xFF), 0xFF);
+			__m256i ahi = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(hi, 0xFF), 0xFF);
+			lo = _mm256_add_epi16(_mm256_mullo_epi16(lo, alo), round);
+			hi = _mm256_add_epi16(_mm256_mullo_epi16(hi, ahi), round);
+			lo = _mm256_srli_epi16(_mm256_add_epi16(lo, _mm256_srli_epi16(lo, 8)), 8);
+			hi = _mm256_srli_epi16(_mm256_add_epi16(hi, _mm256_srli_epi16(hi, 8)), 8);
+			__m256i r = _mm256_packus_epi16(lo, hi);
+			r = _mm256_or_si256(_mm256_andnot_si256(alpha_mask, r), _mm256_and_si256(alpha_mask, v));
+			_mm256_storeu_si256((__m256i*)(dst + x * 4), r);
+		}
+	}
+#endif
+#if defined(PDFTRON_PIXEL_SSSE3)
+	{
+		const __m128i zero = _mm_setzero_si128();
+		const __m128i round = _mm_set1_epi16(128);
+		const __m128i alpha_mask = _mm_set1_epi32((int)0xFF000000);
+		for (; x + 4 <= width; x += 4) {
+			__m128i v = _mm_loadu_si128((const __m128i*)(src + x * 4));
+			__m128i lo = _mm_unpacklo_epi8(v, zero);
+			__m128i hi = _mm_unpackhi_epi8(v, zero);
+			__m128i alo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(lo, 0xFF), 0xFF);
+			__m128i ahi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(hi, 0xFF), 0xFF);
+			lo = _mm_add_epi16(_mm_mullo_epi16(lo, alo), round);
+			hi = _mm_add_epi16(_mm_mullo_epi16(hi, ahi), round);
+			lo = _mm_srli_epi16(_mm_add_epi16(lo, _mm_srli_epi16(lo, 8)), 8);
+			hi = _mm_srli_epi16(_mm_add_epi16(hi, _mm_srli_epi16(hi, 8)), 8);
+			__m128i r = _mm_packus_epi16(lo, hi);
+			r = _mm_or_si128(_mm_andnot_si128(alpha_mask, r), _mm_and_si128(alpha_mask, v));
+			_mm_storeu_si128((__m128i*)(dst + x * 4), r);
+		}
+	}
+#endif
+	for (; x < width; ++x) {
+		const UChar* s = src + x * 4;
+		UChar* d = dst + x * 4;
+		unsigned a = s[3];
+		for (int c = 0; c < 3; ++c) {
+			unsigned t = s[c] * a + 128;
+			d[c] = (UChar)((t + (t >> 8)) >> 8);
+		}
+		d[3] = (UChar)a;
+	}
+}
+
+inline void PixelConverter::DemultiplyRow(const UChar* src, UChar* dst, int width)
+{
+	// c' = (c * 255 + a / 2) / a. The SIMD code performs the division in single
+	// precision, which is exact for these operands.
+	int x = 0;
+#if defined(PDFTRON_PIXEL_AVX2)
+	{
+		const __m256i zero = _mm256_setzero_si256();
+		const __m256i c255 = _mm256_set1_epi16(255);
+		const __m256i alpha_mask = _mm256_set1_epi32((int)0xFF000000);
+		for (; x + 8 <= width; x += 8) {
+			__m256i v = _mm256_loadu_si256((const __m256i*)(src + x * 4));
+			__m256i res16[2];
+			for (int h = 0; h < 2; ++h) {
+				__m256i c = h ? _mm256_unpackhi_epi8(v, zero) : _mm256_unpacklo_epi8(v, zero);
+				__m256i a = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(c, 0xFF), 0xFF);
+				__m256i n = _mm256_add_epi16(_mm256_mullo_epi16(c, c255), _mm256_srli_epi16(a, 1));
+				__m256i q[2];
+				for (int k = 0; k < 2; ++k) {
+					__m256i n32 = k ? _mm256_unpackhi_epi16(n, zero) : _mm256_unpacklo_epi16(n, zero);
+					__m256i a32 = k ? _mm256_unpackhi_epi16(a, zero) : _mm256_unpacklo_epi16(a, zero);
+					__m256i r = _mm256_cvttps_epi32(_mm256_div_ps(_mm256_cvtepi32_ps(n32), _mm256_cvtepi32_ps(a32)));
+					q[k] = _mm256_andnot_si256(_mm256_cmpeq_epi32(a32, zero), r);
+				}
+				res16[h] = _mm256_packs_epi32(q[0], q[1]);
+			}
+			__m256i r = _mm256_packus_epi16(res16[0], res16[1]);
+			r = _mm256_or_si256(_mm256_andnot_si256(alpha_mask, r), _mm256_and_si256(alpha_mask, v));
+			_mm256_storeu_si256((__m256i*)(dst + x * 4), r);
+		}
+	}
+#endif
+#if defined(PDFTRON_PIXEL_SSSE3)
+	{
+		const __m128i zero = _mm_setzero_si128();
+		const __m128i c255 = _mm_set1_epi16(255);
+		const __m128i alpha_mask = _mm_set1_epi32((int)0xFF000000);
+		for (; x + 4 <= width; x += 4) {
+			__m128i v = _mm_loadu_si128((const __m128i*)(src + x * 4));
+			__m128i res16[2];
+			for (int h = 0; h < 2; ++h) {
+				__m128i c = h ? _mm_unpackhi_epi8(v, zero) : _mm_unpacklo_epi8(v, zero);
+				__m128i a = _mm_shufflehi_epi16(_mm_shufflelo_epi16(c, 0xFF), 0xFF);
+				__m128i n = _mm_add_epi16(_mm_mullo_epi16(c, c255), _mm_srli_epi16(a, 1));
+				__m128i q[2];
+				for (int k = 0; k < 2; ++k) {
+					__m128i n32 = k ? _mm_unpackhi_epi16(n, zero) : _mm_unpacklo_epi16(n, zero);
+					__m128i a32 = k ? _mm_unpackhi_epi16(a, zero) : _mm_unpacklo_epi16(a, zero);
+					__m128i r = _mm_cvttps_epi32(_mm_div_ps(_mm_cvtepi32_ps(n32), _mm_cvtepi32_ps(a32)));
+					q[k] = _mm_andnot_si128(_mm_cmpeq_epi32(a32, zero), r);
+				}
+				res16[h] = _mm_packs_epi32(q[0], q[1]);
+			}
+			__m128i r = _mm_packus_epi16(res16[0], res16[1]);
+			r = _mm_or_si128(_mm_andnot_si128(alpha_mask, r), _mm_and_si128(alpha_mask, v));
+			_mm_storeu_si128((__m128i*)(dst + x * 4), r);
+		}
+	}
+#endif
+	for (; x < width; ++x) {
+		const UChar* s = src + x * 4;
+		UChar* d = dst + x * 4;
+		unsigned a = s[3];
+		for (int c = 0; c < 3; ++c) {
+			unsigned q = a ? (s[c] * 255 + a / 2) / a : 0;
+			d[c] = (UChar)(q > 255 ? 255 : q);
+		}
+		d[3] = (UChar)a;
+	}
+}
+
+inline void PixelConverter::BGRAToRGBRow(const UChar* src, UChar* dst, int width)
+{
+	// The SIMD loops store 4 (or 8) bytes past the converted pixels, which are
+	// overwritten by the next iteration, so they stop early enough to stay
+	// within the destination row.
+	int x = 0;
+#if defined(PDFTRON_PIXEL_AVX2)
+	{
+		const __m256i mask = _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+			2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+		const __m256i perm = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7);
+		for (; x + 11 <= width; x += 8) {
+			__m256i v = _mm256_loadu_si256((const __m256i*)(src + x * 4));
+			v = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(v, mask), perm);
+			_mm256_storeu_si256((__m256i*)(dst + x * 3), v);
+		}
+	}
+#endif
+#if defined(PDFTRON_PIXEL_SSSE3)
+	{
+		const __m128i mask = _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+		for (; x + 6 <= width; x += 4) {
+			__m128i v = _mm_loadu_si128((const __m128i*)(src + x * 4));
+			_mm_storeu_si128((__m128i*)(dst + x * 3), _mm_shuffle_epi8(v, mask));
+		}
+	}
+#endif
+	for (; x < width; ++x) {
+		const UChar* s = src + x * 4;
+		UChar* d = dst + x * 3;
+		d[0] = s[2];
+		d[1] = s[1];
+		d[2] = s[0];
+	}
+}
+
+#if defined(PDFTRON_PIXEL_SSSE3)
+// Computes (w0 * B + w1 * G + w2 * R) for 4 BGRA pixels.
+#define PDFTRON_PIXEL_DOT4(ptr, weights) \
+	_mm_hadd_epi32( \
+		_mm_madd_epi16(_mm_unpacklo_epi8(_mm_loadu_si128((const __m128i*)(ptr)), _mm_setzero_si128()), weights), \
+		_mm_madd_epi16(_mm_unpackhi_epi8(_mm_loadu_si128((const __m128i*)(ptr)), _mm_setzero_si128()), weights))
+#endif
+
+inline void PixelConverter::BGRAToGrayRow(const UChar* src, UChar* dst, int width)
+{
+	int x = 0;
+#if defined(PDFTRON_PIXEL_SSSE3)
+	{
+		const __m128i weights = _mm_setr_epi16(29, 150, 77, 0, 29, 150, 77, 0);
+		const __m128i round = _mm_set1_epi32(128);
+		for (; x + 16 <= width; x += 16) {
+			const UChar* s = src + x * 4;
+			__m128i g0 = _mm_srli_epi32(_mm_add_epi32(PDFTRON_PIXEL_DOT4(s, weights), round), 8);
+			__m128i g1 = _mm_srli_epi32(_mm_add_epi32(PDFTRON_PIXEL_DOT4(s + 16, weights), round), 8);
+			__m128i g2 = _mm_srli_epi32(_mm_add_epi32(PDFTRON_PIXEL_DOT4(s + 32, weights), round), 8);
+			__m128i g3 = _mm_srli_epi32(_mm_add_epi32(PDFTRON_PIXEL_DOT4(s + 48, weights), round), 8);
+			__m128i r = _mm_packus_epi16(_mm_packs_epi32(g0, g1), _mm_packs_epi32(g2, g3));
+			_mm_storeu_si128((__m128i*)(dst + x), r);
+		}
+	}
+#endif
+	for (; x < width; ++x) {
+		const UChar* s = src + x * 4;
+		dst[x] = (UChar)((29 * s[0] + 150 * s[1] + 77 * s[2] + 128) >> 8);
+	}
+}
+
+inline void PixelConverter::BGRAToYRow(const UChar* src, UChar* dst, int width)
+{
+	int x = 0;
+#if defined(PDFTRON_PIXEL_SSSE3)
+	{
+		const __m128i weights = _mm_setr_epi16(25, 129, 66, 0, 25, 129, 66, 0);
+		const __m128i round = _mm_set1_epi32(128);
+		const __m128i offset = _mm_set1_epi16(16);
+		for (; x + 16 <= width; x += 16) {
+			const UChar* s = src + x * 4;
+			__m128i y0 = _mm_srli_epi32(_mm_add_epi32(PDFTRON_PIXEL_DOT4(s, weights), round), 8);
+			__m128i y1 = _mm_srli_epi32(_mm_add_epi32(PDFTRON_PIXEL_DOT4(s + 16, weights), round), 8);
+			__m128i y2 = _mm_srli_epi32(_mm_add_epi32(PDFTRON_PIXEL_DOT4(s + 32, weights), round), 8);
+			__m128i y3 = _mm_srli_epi32(_mm_add_epi32(PDFTRON_PIXEL_DOT4(s + 48, weights), round), 8);
+			__m128i lo = _mm_add_epi16(_mm_packs_epi32(y0, y1), offset);
+			__m128i hi = _mm_add_epi16(_mm_packs_epi32(y2, y3), offset);
+			_mm_storeu_si128((__m128i*)(dst + x), _mm_packus_epi16(lo, hi));
+		}
+	}
+#endif
+	for (; x < width; ++x) {
+		const UChar* s = src + x * 4;
+		dst[x] = (UChar)(((25 * s[0] + 129 * s[1] + 66 * s[2] + 128) >> 8) + 16);
+	}
+}
+
+inline void PixelConverter::BGRAToUVRow(const UChar* src0, const UChar* src1, UChar* dst_u, UChar* dst_v, int width)
+{
+	int x = 0;
+#if defined(PDFTRON_PIXEL_SSSE3)
+	{
+		const __m128i zero = _mm_setzero_si128();
+		const __m128i two = _mm_set1_epi16(2);
+		const __m128i u_weights = _mm_setr_epi16(112, -74, -38, 0, 112, -74, -38, 0);
+		const __m128i v_weights = _mm_setr_epi16(-18, -94, 112, 0, -18, -94, 112, 0);
+		const __m128i round = _mm_set1_epi32(128);
+		const __m128i offset = _mm_set1_epi32(128);
+		for (; x + 8 <= width; x += 8) {
+			// average 2x2 blocks: avg[0] holds output pixels 0 and 1, avg[1] pixels 2 and 3
+			__m128i avg[2];
+			for (int k = 0; k < 2; ++k) {
+				__m128i a = _mm_loadu_si128((const __m128i*)(src0 + x * 4 + k * 16));
+				__m128i b = _mm_loadu_si128((const __m128i*)(src1 + x * 4 + k * 16));
+				__m128i lo = _mm_add_epi16(_mm_unpacklo_epi8(a, zero), _mm_unpacklo_epi8(b, zero));
+				__m128i hi = _mm_add_epi16(_mm_unpackhi_epi8(a, zero), _mm_unpackhi_epi8(b, zero));
+				lo = _mm_add_epi16(lo, _mm_srli_si128(lo, 8));
+				hi = _mm_add_epi16(hi, _mm_srli_si128(hi, 8));
+				avg[k] = _mm_srli_epi16(_mm_add_epi16(_mm_unpacklo_epi64(lo, hi), two), 2);
+			}
+			__m128i u = _mm_hadd_epi32(_mm_madd_epi16(avg[0], u_weights), _mm_madd_epi16(avg[1], u_weights));
+			__m128i v = _mm_hadd_epi32(_mm_madd_epi16(avg[0], v_weights), _mm_madd_epi16(avg[1], v_weights));
+			u = _mm_add_epi32(_mm_srai_epi32(_mm_add_epi32(u, round), 8), offset);
+			v = _mm_add_epi32(_mm_srai_epi32(_mm_add_epi32(v, round), 8), offset);
+			__m128i r = _mm_packus_epi16(_mm_packs_epi32(u, v), zero);
+			int u4 = _mm_cvtsi128_si32(r);
+			int v4 = _mm_cvtsi128_si32(_mm_srli_si128(r, 4));
+			memcpy(dst_u + x / 2, &u4, 4);
+			memcpy(dst_v + x / 2, &v4, 4);
+		}
+	}
+#endif
+	for (; x < width; x += 2) {
+		int x1 = x + 1 < width ? x + 1 : x;
+		const UChar* a0 = src0 + x * 4;
+		const UChar* a1 = src0 + x1 * 4;
+		const UChar* b0 = src1 + x * 4;
+		const UChar* b1 = src1 + x1 * 4;
+		int b = (a0[0] + a1[0] + b0[0] + b1[0] + 2) >> 2;
+		int g = (a0[1] + a1[1] + b0[1] + b1[1] + 2) >> 2;
+		int r = (a0[2] + a1[2] + b0[2] + b1[2] + 2) >> 2;
+		dst_u[x / 2] = (UChar)(((112 * b - 74 * g - 38 * r + 128) >> 8) + 128);
+		dst_v[x / 2] = (UChar)(((-18 * b - 94 * g + 112 * r + 128) >> 8) + 128);
+	}
+}
+
+#if defined(PDFTRON_PIXEL_SSSE3)
+#undef PDFTRON_PIXEL_DOT4
+#endif
@@ -36,7 +36,7 @@ inline void Rect::Attach(SDF::Obj rect)
 
 inline bool Rect::Update(SDF::Obj rect)
 {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_RectUpdate(this,rect.mp_obj,&result));
 	return TBToB(result);
 }
@@ -58,27 +58,27 @@ inline void Rect::Set(double x1, double y1, double x2, double y2)
 
 inline double Rect::Width() const
 {
-	double result;
+	double result = 0;
 	REX(TRN_RectWidth(this, &result));
 	return result;
 }
 
 inline double Rect::Height() const
 {
-	double result;
+	double result = 0;
 	REX(TRN_RectHeight(this, &result));
 	return result;
 }
 inline bool Rect::Contains(double x, double y) const
 {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_RectContains(this, x,y,&result));
 	return TBToB(result);
 }
 
 inline bool Rect::IntersectRect(const Rect& rect1, const Rect& rect2)
 {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_RectIntersectRect(this, &rect1, &rect2, &result));
 	return TBToB(result);
 }
@@ -9,7 +9,7 @@ namespace pdftron {
 inline Redaction::Redaction(int page_num,
 	const Rect& bbox,
 	bool negative,
-	const UString& text)
+	const UString& text) : mp_imp(0)
 {
 	REX(TRN_Redactor_RedactionCreate(page_num,
 		(const TRN_Rect*)&bbox,
@@ -29,7 +29,7 @@ inline void Redaction::Destroy() {
 	mp_imp=0;
 }
 
-inline Redaction::Redaction(const Redaction& other) {
+inline Redaction::Redaction(const Redaction& other) : mp_imp(0) {
 	REX(TRN_Redactor_RedactionCopy(other.mp_imp, &mp_imp));
 }
 
@@ -75,7 +75,7 @@ inline void Redactor::Redact(PDFDoc& doc, const std::vector<Redaction>& red_arr,
 	TRN_Exception ret = TRN_RedactorRedact(doc.mp_doc, (TRN_Redaction*)&(red_arr[0]), static_cast<int>(red_arr.size()), trn_app, BToTB(ext_neg_mode), BToTB(page_coord_sys));
 	REX(TRN_RedactionAppearanceDestroy(trn_app));
 
-	if(ret!=0) throw Common::Exception(ret);
+	if(ret!=0) PDFTRON_THROW(Common::Exception(ret));
 }
 
 #ifdef SWIG
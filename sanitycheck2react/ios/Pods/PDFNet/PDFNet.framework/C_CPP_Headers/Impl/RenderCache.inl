@@ -0,0 +1,431 @@
+
+inline RenderSettings::RenderSettings()
+	: dpi(92), width(0), height(0), preserve_aspect_ratio(true),
+	page_box(Page::e_crop), rotate(Page::e_0), flip_y(false),
+	draw_annotations(true), highlight_fields(false), anti_aliasing(true),
+	path_hinting(true), image_smoothing(true), hq_image_resampling(false),
+	gamma(1), print_mode(false), page_transparent(false),
+	pix_fmt(PDFDraw::e_bgra), demult(false)
+{
+	page_color[0] = page_color[1] = page_color[2] = 255;
+}
+
+inline void RenderSettings::Apply(PDFDraw& draw) const
+{
+	if (width > 0 && height > 0) {
+		draw.SetImageSize(width, height, preserve_aspect_ratio);
+	}
+	else {
+		draw.SetDPI(dpi);
+	}
+	draw.SetPageBox(page_box);
+	draw.SetRotate(rotate);
+	draw.SetFlipYAxis(flip_y);
+	draw.SetDrawAnnotations(draw_annotations);
+	draw.SetHighlightFields(highlight_fields);
+	draw.SetAntiAliasing(anti_aliasing);
+	draw.SetPathHinting(path_hinting);
+	draw.SetImageSmoothing(image_smoothing, hq_image_resampling);
+	draw.SetGamma(GetGamma());
+	draw.SetPrintMode(print_mode);
+	draw.SetPageTransparent(page_transparent);
+	draw.SetDefaultPageColor(page_color[0], page_color[1], page_color[2]);
+}
+
+inline double RenderSettings::GetGamma() const
+{
+	return gamma > 0 ? gamma : 1;
+}
+
+inline std::string RenderSettings::GetKey() const
+{
+	UInt32 flags = (preserve_aspect_ratio ? 0x01 : 0) | (flip_y ? 0x02 : 0)
+		| (draw_annotations ? 0x04 : 0) | (highlight_fields ? 0x08 : 0)
+		| (anti_aliasing ? 0x10 : 0) | (path_hinting ? 0x20 : 0)
+		| (image_smoothing ? 0x40 : 0) | (hq_image_resampling ? 0x80 : 0)
+		| (print_mode ? 0x100 : 0) | (page_transparent ? 0x200 : 0)
+		| (demult ? 0x400 : 0);
+	Int32 ints[6] = { width > 0 && height > 0 ? width : 0, width > 0 && height > 0 ? height : 0,
+		(Int32)page_box, (Int32)rotate, (Int32)pix_fmt, (Int32)flags };
+	double dbls[2] = { width > 0 && height > 0 ? 0 : dpi, GetGamma() };
+
+	std::string key;
+	key.reserve(sizeof(ints) + sizeof(dbls) + sizeof(page_color));
+	key.append((const char*)ints, sizeof(ints));
+	key.append((const char*)dbls, sizeof(dbls));
+	key.append((const char*)page_color, sizeof(page_color));
+	return key;
+}
+
+
+inline RenderCache::RenderCache(size_t max_memory_bytes)
+	: m_max_memory_bytes(max_memory_bytes), m_memory_bytes(0),
+	m_max_disk_bytes(0), m_disk_bytes(0), m_file_prefix(MakeFilePrefix()), m_file_counter(0),
+	m_memory_hits(0), m_disk_hits(0), m_misses(0), m_evictions(0)
+{
+}
+
+inline RenderCache::~RenderCache()
+{
+	Clear();
+}
+
+inline void RenderCache::SetDiskCache(const std::string& directory, UInt64 max_disk_bytes)
+{
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_disk_dir = directory;
+	m_max_disk_bytes = directory.empty() ? 0 : max_disk_bytes;
+	FileOps ops;
+	TrimDiskLocked(ops);
+	RunFileOps(lock, ops);
+}
+
+inline std::shared_ptr<const BitmapInfo> RenderCache::GetBitmap(PDFDraw& draw, const std::string& doc_id,
+	Page page, const RenderSettings& settings)
+{
+	std::string key = MakeKey(doc_id, page, settings);
+	std::shared_ptr<const BitmapInfo> result = Lookup(key);
+	if (result) return result;
+
+	std::shared_ptr<BitmapInfo> bmp(new BitmapInfo());
+	settings.Apply(draw);
+	draw.GetBitmap(page, *bmp, settings.pix_fmt, settings.demult);
+
+	std::unique_lock<std::mutex> lock(m_mutex);
+	FileOps ops;
+	InsertLocked(key, doc_id.size(), bmp, ops);
+	RunFileOps(lock, ops);
+	return bmp;
+}
+
+inline std::shared_ptr<const BitmapInfo> RenderCache::Find(const std::string& doc_id,
+	Page page, const RenderSettings& settings)
+{
+	return Lookup(MakeKey(doc_id, page, settings));
+}
+
+inline void RenderCache::Insert(const std::string& doc_id, Page page, const RenderSettings& settings,
+	const std::shared_ptr<const BitmapInfo>& bmp)
+{
+	std::string key = MakeKey(doc_id, page, settings);
+	std::unique_lock<std::mutex> lock(m_mutex);
+	FileOps ops;
+	InsertLocked(key, doc_id.size(), bmp, ops);
+	RunFileOps(lock, ops);
+}
+
+inline void RenderCache::Remove(const std::string& doc_id)
+{
+	std::unique_lock<std::mutex> lock(m_mutex);
+	FileOps ops;
+	for (EntryList::iterator itr = m_entries.begin(); itr != m_entries.end(); ) {
+		if (itr->doc_id_len == doc_id.size() && itr->key.compare(0, doc_id.size(), doc_id) == 0) {
+			m_memory_bytes -= itr->bytes;
+			m_index.erase(itr->key);
+			itr = m_entries.erase(itr);
+		}
+		else ++itr;
+	}
+	for (DiskEntryList::iterator itr = m_disk_entries.begin(); itr != m_disk_entries.end(); ) {
+		DiskEntryList::iterator cur = itr++;
+		if (cur->doc_id_len == doc_id.size() && cur->key.compare(0, doc_id.size(), doc_id) == 0) {
+			EraseDiskLocked(cur, ops);
+		}
+	}
+	// spills in progress are discarded when they complete, see RunFileOps()
+	for (std::unordered_map<std::string, Spill>::iterator itr = m_spilling.begin(); itr != m_spilling.end(); ) {
+		if (itr->second.doc_id_len == doc_id.size() && itr->first.compare(0, doc_id.size(), doc_id) == 0) {
+			itr = m_spilling.erase(itr);
+		}
+		else ++itr;
+	}
+	RunFileOps(lock, ops);
+}
+
+inline void RenderCache::Clear()
+{
+	std::unique_lock<std::mutex> lock(m_mutex);
+	FileOps ops;
+	m_entries.clear();
+	m_index.clear();
+	m_memory_bytes = 0;
+	m_spilling.clear();
+	while (!m_disk_entries.empty()) {
+		EraseDiskLocked(m_disk_entries.begin(), ops);
+	}
+	RunFileOps(lock, ops);
+}
+
+inline RenderCache::Stats RenderCache::GetStats() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	Stats result;
+	result.memory_hits = m_memory_hits;
+	result.disk_hits = m_disk_hits;
+	result.misses = m_misses;
+	result.evictions = m_evictions;
+	result.memory_entries = m_entries.size();
+	result.memory_bytes = m_memory_bytes;
+	result.disk_entries = m_disk_entries.size();
+	result.disk_bytes = m_disk_bytes;
+	return result;
+}
+
+inline std::string RenderCache::GetDocumentFingerprint(PDFDoc& doc)
+{
+	std::string result = doc.GetFileName().ConvertToUtf8();
+	bool has_id = false;
+	SDF::Obj id = doc.GetTrailer().FindObj("ID");
+	if (id && id.IsArray()) {
+		for (size_t i = 0, sz = id.Size(); i < sz; ++i) {
+			SDF::Obj part = id.GetAt(i);
+			if (!part.IsString()) continue;
+			result += '\0';
+			result.append((const char*)part.GetBuffer(), part.Size());
+			has_id = true;
+		}
+	}
+	if (!has_id && doc.GetFileName().Empty()) {
+		// Every such document would get the same fingerprint.
+		PDFTRON_THROW(Common::Exception("fingerprint", __LINE__, __FILE__, "RenderCache::GetDocumentFingerprint",
+			"The document has no file name and no file identifier"));
+		return std::string();
+	}
+	return result;
+}
+
+inline std::string RenderCache::MakeKey(const std::string& doc_id, Page& page, const RenderSettings& settings)
+{
+	SDF::Obj page_obj = page.GetSDFObj();
+	UInt32 ref[2] = { page_obj.GetObjNum(), page_obj.GetGenNum() };
+	std::string key(doc_id);
+	key.append((const char*)ref, sizeof(ref));
+	key += settings.GetKey();
+	return key;
+}
+
+inline std::shared_ptr<const BitmapInfo> RenderCache::Lookup(const std::string& key)
+{
+	std::unique_lock<std::mutex> lock(m_mutex);
+	FileOps ops;
+	DiskEntry disk_entry;
+	std::shared_ptr<const BitmapInfo> result = FindLocked(key, ops, disk_entry);
+	if (!result && !disk_entry.path.empty()) {
+		// The entry was taken out of the disk tier; reload it without
+		// holding the lock.
+		lock.unlock();
+		result = ReadFile(disk_entry.path);
+		remove(disk_entry.path.c_str());
+		lock.lock();
+		if (result) {
+			++m_disk_hits;
+			if (m_index.find(key) == m_index.end()) {
+				InsertLocked(key, disk_entry.doc_id_len, result, ops);
+			}
+		}
+	}
+	if (!result) ++m_misses;
+	RunFileOps(lock, ops);
+	return result;
+}
+
+inline std::shared_ptr<const BitmapInfo> RenderCache::FindLocked(const std::string& key, FileOps& ops, DiskEntry& out_disk_entry)
+{
+	std::unordered_map<std::string, EntryList::iterator>::iterator itr = m_index.find(key);
+	if (itr != m_index.end()) {
+		m_entries.splice(m_entries.begin(), m_entries, itr->second);
+		++m_memory_hits;
+		return itr->second->bmp;
+	}
+
+	std::unordered_map<std::string, Spill>::iterator sitr = m_spilling.find(key);
+	if (sitr != m_spilling.end()) {
+		// Still being written to disk: move it back to the memory tier. The
+		// file is deleted when the write completes.
+		std::shared_ptr<const BitmapInfo> bmp = sitr->second.bmp;
+		++m_memory_hits;
+		InsertLocked(key, sitr->second.doc_id_len, bmp, ops);
+		return bmp;
+	}
+
+	std::unordered_map<std::string, DiskEntryList::iterator>::iterator ditr = m_disk_index.find(key);
+	if (ditr == m_disk_index.end()) return std::shared_ptr<const BitmapInfo>();
+
+	// Take the entry out of the disk tier; the caller reads and deletes the file.
+	DiskEntryList::iterator entry = ditr->second;
+	out_disk_entry = *entry;
+	m_disk_bytes -= entry->bytes;
+	m_disk_index.erase(ditr);
+	m_disk_entries.erase(entry);
+	return std::shared_ptr<const BitmapInfo>();
+}
+
+inline void RenderCache::InsertLocked(const std::string& key, size_t doc_id_len, const std::shared_ptr<const BitmapInfo>& bmp, FileOps& ops)
+{
+	std::unordered_map<std::string, DiskEntryList::iterator>::iterator ditr = m_disk_index.find(key);
+	if (ditr != m_disk_index.end()) EraseDiskLocked(ditr->second, ops);
+	m_spilling.erase(key);
+
+	size_t bytes = bmp->GetSize() + sizeof(BitmapInfo) + key.size();
+	std::unordered_map<std::string, EntryList::iterator>::iterator itr = m_index.find(key);
+	if (itr != m_index.end()) {
+		m_memory_bytes -= itr->second->bytes;
+		itr->second->bmp = bmp;
+		itr->second->bytes = bytes;
+		m_entries.splice(m_entries.begin(), m_entries, itr->second);
+	}
+	else {
+		Entry entry;
+		entry.key = key;
+		entry.doc_id_len = doc_id_len;
+		entry.bmp = bmp;
+		entry.bytes = bytes;
+		m_entries.push_front(entry);
+		m_index[key] = m_entries.begin();
+	}
+	m_memory_bytes += bytes;
+	TrimMemoryLocked(ops);
+}
+
+inline void RenderCache::TrimMemoryLocked(FileOps& ops)
+{
+	while (m_memory_bytes > m_max_memory_bytes && !m_entries.empty()) {
+		Entry& victim = m_entries.back();
+		if (!m_disk_dir.empty() && victim.bmp->GetSize() <= m_max_disk_bytes) {
+			// The bitmap stays reachable through m_spilling until it is on disk.
+			char name[32];
+			snprintf(name, sizeof(name), "_%08llx.bin", (unsigned long long)m_file_counter++);
+			Spill spill;
+			spill.key = victim.key;
+			spill.doc_id_len = victim.doc_id_len;
+			spill.bmp = victim.bmp;
+			spill.path = m_disk_dir + "/rc_" + m_file_prefix + name;
+			spill.written = false;
+			m_spilling[spill.key] = spill;
+			ops.spills.push_back(spill);
+		}
+		else {
+			++m_evictions;
+		}
+
+		m_memory_bytes -= victim.bytes;
+		m_index.erase(victim.key);
+		m_entries.pop_back();
+	}
+	TrimDiskLocked(ops);
+}
+
+inline void RenderCache::TrimDiskLocked(FileOps& ops)
+{
+	while (m_disk_bytes > m_max_disk_bytes && !m_disk_entries.empty()) {
+		DiskEntryList::iterator victim = m_disk_entries.end();
+		EraseDiskLocked(--victim, ops);
+		++m_evictions;
+	}
+}
+
+inline void RenderCache::EraseDiskLocked(DiskEntryList::iterator itr, FileOps& ops)
+{
+	ops.removals.push_back(itr->path);
+	m_disk_bytes -= itr->bytes;
+	m_disk_index.erase(itr->key);
+	m_disk_entries.erase(itr);
+}
+
+inline void RenderCache::RunFileOps(std::unique_lock<std::mutex>& lock, FileOps& ops)
+{
+	// Writes and deletes files without holding the lock, then adds the
+	// written bitmaps to the disk tier. Committing may evict disk entries,
+	// which queues more deletions, hence the loop.
+	while (!ops.spills.empty() || !ops.removals.empty()) {
+		FileOps batch;
+		batch.spills.swap(ops.spills);
+		batch.removals.swap(ops.removals);
+
+		lock.unlock();
+		for (size_t i = 0; i < batch.removals.size(); ++i) {
+			remove(batch.removals[i].c_str());
+		}
+		for (size_t i = 0; i < batch.spills.size(); ++i) {
+			batch.spills[i].written = WriteFile(batch.spills[i].path, *batch.spills[i].bmp);
+		}
+		lock.lock();
+
+		for (size_t i = 0; i < batch.spills.size(); ++i) {
+			Spill& spill = batch.spills[i];
+			// The spill is discarded if the entry was used, replaced or
+			// removed while it was written.
+			std::unordered_map<std::string, Spill>::iterator itr = m_spilling.find(spill.key);
+			bool current = itr != m_spilling.end() && itr->second.path == spill.path;
+			if (current) m_spilling.erase(itr);
+
+			if (current && spill.written && !m_disk_dir.empty()) {
+				std::unordered_map<std::string, DiskEntryList::iterator>::iterator ditr = m_disk_index.find(spill.key);
+				if (ditr != m_disk_index.end()) EraseDiskLocked(ditr->second, ops);
+				DiskEntry entry;
+				entry.key = spill.key;
+				entry.doc_id_len = spill.doc_id_len;
+				entry.path = spill.path;
+				entry.bytes = spill.bmp->GetSize();
+				m_disk_entries.push_front(entry);
+				m_disk_index[entry.key] = m_disk_entries.begin();
+				m_disk_bytes += entry.bytes;
+			}
+			else {
+				if (spill.written) ops.removals.push_back(spill.path);
+				if (current) ++m_evictions;
+			}
+		}
+		TrimDiskLocked(ops);
+	}
+}
+
+inline bool RenderCache::WriteFile(const std::string& path, const BitmapInfo& bmp) const
+{
+	FILE* file = fopen(path.c_str(), "wb");
+	if (!file) return false;
+	Int32 header[3] = { bmp.width, bmp.height, bmp.stride };
+	UInt64 size = bmp.GetSize();
+	bool ok = fwrite(header, sizeof(header), 1, file) == 1
+		&& fwrite(&bmp.dpi, sizeof(bmp.dpi), 1, file) == 1
+		&& fwrite(&size, sizeof(size), 1, file) == 1
+		&& (size == 0 || fwrite(bmp.GetData(), (size_t)size, 1, file) == 1);
+	if (fclose(file) != 0) ok = false;
+	if (!ok) remove(path.c_str());
+	return ok;
+}
+
+inline std::shared_ptr<const BitmapInfo> RenderCache::ReadFile(const std::string& path)
+{
+	std::shared_ptr<BitmapInfo> bmp(new BitmapInfo());
+	FILE* file = fopen(path.c_str(), "rb");
+	if (!file) return std::shared_ptr<const BitmapInfo>();
+	Int32 header[3];
+	UInt64 size = 0;
+	std::vector<unsigned char> buf;
+	bool ok = fread(header, sizeof(header), 1, file) == 1
+		&& fread(&bmp->dpi, sizeof(bmp->dpi), 1, file) == 1
+		&& fread(&size, sizeof(size), 1, file) == 1;
+	if (ok) {
+		buf.resize((size_t)size);
+		ok = size == 0 || fread(&buf[0], (size_t)size, 1, file) == 1;
+	}
+	fclose(file);
+	if (!ok) return std::shared_ptr<const BitmapInfo>();
+
+	bmp->width = header[0];
+	bmp->height = header[1];
+	bmp->stride = header[2];
+	bmp->SwapBuffer(buf);
+	return bmp;
+}
+
+inline std::string RenderCache::MakeFilePrefix()
+{
+	std::random_device device;
+	UInt64 id = ((UInt64)device() << 32) ^ device()
+		^ (UInt64)std::chrono::steady_clock::now().time_since_epoch().count();
+	char prefix[24];
+	snprintf(prefix, sizeof(prefix), "%016llx", (unsigned long long)id);
+	return prefix;
+}
@@ -1,10 +1,10 @@
 
-inline RoleMap::RoleMap (SDF::Obj dict)
+inline RoleMap::RoleMap (SDF::Obj dict) : mp_map(0)
 {
 	REX(TRN_RoleMapCreate(dict.mp_obj,&mp_map));
 }
 	
-inline RoleMap::RoleMap (const RoleMap& p)
+inline RoleMap::RoleMap (const RoleMap& p) : mp_map(0)
 {
 	REX(TRN_RoleMapCopy(p.mp_map,&mp_map));
 }
@@ -17,21 +17,21 @@ inline RoleMap& RoleMap::operator= (const RoleMap& p)
 
 inline bool RoleMap::IsValid() const
 {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_RoleMapIsValid(mp_map,&result));
 	return TBToB(result);
 }
 
 inline const char* RoleMap::GetDirectMap(const char* type) const
 {
-	const char* result;
+	const char* result = 0;
 	REX(TRN_RoleMapGetDirectMap(mp_map,type,&result));
 	return result;
 }
 
 inline SDF::Obj RoleMap::GetSDFObj () const
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_RoleMapGetSDFObj(mp_map,&result));
 	return SDF::Obj(result);
 }
@@ -45,16 +45,47 @@ inline bool DictIterator::HasNext() {
 
 inline DictIterator::DictIterator(TRN_DictIterator impl) : mp_impl(impl) {}
 
-inline DictIterator::DictIterator(const DictIterator& c) {
+#ifdef PDFTRON_CPP11
+	};	// namespace SDF
+
+	namespace Common {
+
+inline RangeTraits<SDF::DictIterator>::value_type RangeTraits<SDF::DictIterator>::Get(SDF::DictIterator& itr) {
+	return value_type(itr.Key(), itr.Value());
+}
+
+	};	// namespace Common
+
+	namespace SDF {
+#endif
+
+inline DictIterator::DictIterator(const DictIterator& c) : mp_impl(0) {
 	mp_impl=0;
-	REX(TRN_DictIteratorAssign(c.mp_impl,&mp_impl));
+	if (c.mp_impl) REX(TRN_DictIteratorAssign(c.mp_impl,&mp_impl));
 }
 
 inline DictIterator& DictIterator::operator=(const DictIterator& other) {
+	if (!other.mp_impl) {
+		DREX(mp_impl, TRN_DictIteratorDestroy(mp_impl));
+		return *this;
+	}
 	REX(TRN_DictIteratorAssign(other.mp_impl,&mp_impl));
 	return *this;
 }
 
+#ifdef PDFTRON_CPP11
+inline DictIterator::DictIterator(DictIterator&& other) noexcept : mp_impl(other.mp_impl)
+{
+	other.mp_impl = 0;
+}
+
+inline DictIterator& DictIterator::operator=(DictIterator&& other) noexcept
+{
+	std::swap(mp_impl, other.mp_impl);
+	return *this;
+}
+#endif
+
 inline Obj::Obj(TRN_Obj impl) : mp_obj(impl) {}
 
 inline Obj::Type Obj::GetType () const {
@@ -114,8 +145,8 @@ inline bool Obj::IsString () const {
 
 #ifdef SWIG
 inline std::vector<unsigned char> Obj::GetBuffer () const {
-	const TRN_UChar* arr;
-	size_t size;
+	const TRN_UChar* arr = 0;
+	size_t size = 0;
 	REX(TRN_ObjSize(mp_obj,&size));
 	std::vector<unsigned char> result (size);
 	REX(TRN_ObjGetBuffer(mp_obj,&arr));
@@ -124,24 +155,40 @@ inline std::vector<unsigned char> Obj::GetBuffer () const {
 }
 #else
 inline const UChar* Obj::GetBuffer () const {
-	const TRN_UChar* result;
+	const TRN_UChar* result = 0;
 	REX(TRN_ObjGetBuffer(mp_obj,&result));
 	return result;
 }
 #endif
 
 inline std::vector<unsigned char> Obj::GetRawBuffer() const {
-	TRN_Vector cvector;
+	std::vector<unsigned char> result;
+	GetRawBuffer(result);
+	return result;
+}
+
+inline void Obj::GetRawBuffer(std::vector<unsigned char>& out) const {
+	TRN_Vector cvector = TRN_Vector();
 	REX(TRN_ObjGetRawBuffer(mp_obj, &cvector));
-	void* arr;
-	UInt32 size;
+	void* arr = 0;
+	UInt32 size = 0;
 	REX(TRN_VectorGetData(&cvector, &arr));
-	REX(TRN_VectorGetSize(&cvector, &size))
-	std::vector<unsigned char> result(size);
-	memcpy(&result[0], arr, size);
-	return result;
+	REX(TRN_VectorGetSize(&cvector, &size));
+	out.resize(size);
+	if (size) memcpy(&out[0], arr, size);
+	REX(TRN_VectorDestroy(&cvector));
 }
 
+#ifndef SWIG
+inline ByteView Obj::GetBufferView () const {
+	const TRN_UChar* data = 0;
+	size_t size = 0;
+	REX(TRN_ObjGetBuffer(mp_obj,&data));
+	REX(TRN_ObjSize(mp_obj,&size));
+	return ByteView(data, size);
+}
+#endif
+
 inline UString Obj::GetAsPDFText() const {
 	UString out_str;
 	REX(TRN_ObjGetAsPDFText(mp_obj,&(out_str.mp_impl)));
@@ -168,7 +215,7 @@ inline bool Obj::IsName () const {
 }
 
 inline const char* Obj::GetName () const {
-	const char* result;
+	const char* result = 0;
 	REX(TRN_ObjGetName(mp_obj,&result));
 	return result;
 }
@@ -182,19 +229,19 @@ inline bool Obj::IsIndirect () const {
 }
 
 inline UInt32 Obj::GetObjNum () const {
-	UInt32 result;
+	UInt32 result = 0;
 	REX(TRN_ObjGetObjNum(mp_obj,&result));
 	return result;
 }
 
 inline UInt16 Obj::GetGenNum () const {
-	UInt16 result;
+	UInt16 result = 0;
 	REX(TRN_ObjGetGenNum(mp_obj,&result));
 	return result;
 }
 
 inline size_t Obj::GetOffset () const {
-	size_t result;
+	size_t result = 0;
 	REX(TRN_ObjGetOffset(mp_obj,&result));
 	return result;
 }
@@ -224,23 +271,29 @@ inline bool Obj::IsContainer () const {
 }
 
 inline size_t Obj::Size () const {
-	size_t result;
+	size_t result = 0;
 	REX(TRN_ObjSize(mp_obj,&result));
 	return result;
 }
 
 inline DictIterator Obj::GetDictIterator () {
-	TRN_DictIterator result;
+	TRN_DictIterator result = 0;
 	REX(TRN_ObjGetDictIterator(mp_obj,&result));
 	return DictIterator(result);
 }
 
+#ifdef PDFTRON_CPP11
+inline DictRange Obj::DictEntries () {
+	return DictRange(GetDictIterator());
+}
+#endif
+
 inline bool Obj::IsDict () const {
 	RetBool(TRN_ObjIsDict(mp_obj,&result));
 }
 
 inline DictIterator Obj::Find (const char* key) {
-	TRN_DictIterator result;
+	TRN_DictIterator result = 0;
 	REX(TRN_ObjFind(mp_obj,key,&result));
 	return DictIterator(result);
 }
@@ -250,7 +303,7 @@ inline Obj Obj::FindObj (const char* key) {
 }
 
 inline DictIterator Obj::Get (const char* key) {
-	TRN_DictIterator result;
+	TRN_DictIterator result = 0;
 	REX(TRN_ObjGet(mp_obj,key,&result));
 	return DictIterator(result);
 }
@@ -427,19 +480,19 @@ inline bool Obj::IsStream () const {
 }
 
 inline size_t Obj::GetRawStreamLength () const {
-	size_t result;
+	size_t result = 0;
 	REX(TRN_ObjGetRawStreamLength(mp_obj,&result));
 	return result;
 }
 
 inline Filters::Filter Obj::GetRawStream (bool decrypt) const {
-	TRN_Filter result;
+	TRN_Filter result = 0;
 	REX(TRN_ObjGetRawStream(mp_obj,BToTB(decrypt),&result));
 	return Filters::Filter(result,true);
 }
 
 inline Filters::Filter Obj::GetDecodedStream () const {
-	TRN_Filter result;
+	TRN_Filter result = 0;
 	REX(TRN_ObjGetDecodedStream(mp_obj,&result));
 	return Filters::Filter(result,true);
 }
@@ -472,26 +525,26 @@ inline ptrdiff_t SDFDoc::GetHandleInternal() {
     return (ptrdiff_t) mp_doc;
 }
 
-inline SDFDoc::SDFDoc () {
+inline SDFDoc::SDFDoc () : mp_doc(0) {
 	REX(TRN_SDFDocCreate(&mp_doc));
 }
 
-inline SDFDoc::SDFDoc (const UString& filepath) {
+inline SDFDoc::SDFDoc (const UString& filepath) : mp_doc(0) {
 	REX(TRN_SDFDocCreateFromFileUString(filepath.mp_impl,&mp_doc));
 }
 
-inline SDFDoc::SDFDoc (const char* filepath) {
+inline SDFDoc::SDFDoc (const char* filepath) : mp_doc(0) {
 	REX(TRN_SDFDocCreateFromFileString(filepath,&mp_doc));
 }
 
-inline SDFDoc::SDFDoc (Filters::Filter stream) {
+inline SDFDoc::SDFDoc (Filters::Filter stream) : mp_doc(0) {
 	stream.m_owner = false;
 	REX(TRN_SDFDocCreateFromFilter(stream.m_impl, &mp_doc));
 	// Note: SDFDoc takes the ownership of the stream
 	stream.m_impl = 0;  
 }
 
-inline SDFDoc::SDFDoc (unsigned char* buf, size_t buf_size) {
+inline SDFDoc::SDFDoc (unsigned char* buf, size_t buf_size) : mp_doc(0) {
 	REX(TRN_SDFDocCreateFromMemoryBuffer((const char*)buf,buf_size,&mp_doc));
 }
 
@@ -507,7 +560,7 @@ inline void SDFDoc::Close () {
 }
 
 inline bool SDFDoc::IsEncrypted() {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_SDFDocIsEncrypted(mp_doc,&result));
 	return TBToB(result);
 }
@@ -515,7 +568,7 @@ inline bool SDFDoc::IsEncrypted() {
 #ifndef SWIG
 inline bool SDFDoc::InitSecurityHandler(void* custom_data) 
 {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_SDFDocInitSecurityHandler(mp_doc,custom_data,&result));
 	return TBToB(result);
 }
@@ -523,63 +576,63 @@ inline bool SDFDoc::InitSecurityHandler(void* custom_data)
 
 inline bool SDFDoc::InitSecurityHandler() 
 {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_SDFDocInitSecurityHandler(mp_doc,0,&result));
 	return TBToB(result);
 }
 
 inline bool SDFDoc::InitStdSecurityHandler (const char* password, int password_sz) {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_SDFDocInitStdSecurityHandler(mp_doc,password,password_sz,&result));
 	return TBToB(result);
 }
 
 inline bool SDFDoc::InitStdSecurityHandler(const pdftron::UString& password)
 {
-    TRN_Bool result;
+    TRN_Bool result = 0;
     REX(TRN_SDFDocInitStdSecurityHandlerUString(mp_doc, password.mp_impl, &result));
     return TBToB(result);
 }
 
 inline bool SDFDoc::InitStdSecurityHandler(const std::vector<UInt8>& password_buf)
 {
-    TRN_Bool result;
+    TRN_Bool result = 0;
     REX(TRN_SDFDocInitStdSecurityHandlerBuffer(mp_doc, &(password_buf[0]), password_buf.size(), &result));
     return TBToB(result);
 }
 
 inline bool SDFDoc::IsModified () const {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_SDFDocIsModified(mp_doc,&result));
 	return TBToB(result);
 }
 
 inline bool SDFDoc::HasRepairedXRef() const {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_SDFDocHasRepairedXRef(mp_doc, &result));
 	return TBToB(result);
 }
 
 inline bool SDFDoc::IsFullSaveRequired () const {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_SDFDocIsFullSaveRequired(mp_doc,&result));
 	return TBToB(result);
 }
 
 inline Obj SDFDoc::GetTrailer () {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_SDFDocGetTrailer(mp_doc,&(result)));
 	return Obj(result);
 }
 
 inline Obj SDFDoc::GetObj (const UInt32 obj_num) const {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_SDFDocGetObj(mp_doc,obj_num,&(result)));
 	return Obj(result);
 }
 
 inline Obj SDFDoc::ImportObj (Obj obj, bool deep_copy) {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_SDFDocImportObj(mp_doc,obj.mp_obj,BToTB(deep_copy),&(result)));
 	return Obj(result);
 }
@@ -599,7 +652,7 @@ inline std::vector<Obj> SDFDoc::ImportObjs(const std::vector<Obj>& obj_list) {
 }
 
 inline UInt32 SDFDoc::XRefSize () const {
-	UInt32 result;
+	UInt32 result = 0;
 	REX(TRN_SDFDocXRefSize(mp_doc,&result));
 	return result;
 }
@@ -619,13 +672,10 @@ inline void SDFDoc::Save(const UString& path, UInt32 flags, Common::ProgressMoni
 #endif
 
 inline std::vector<unsigned char> SDFDoc::Save(UInt32 flags, const char* header) {
-	size_t size;
-	char* buf;
-	std::vector<unsigned char> result;
+	size_t size = 0;
+	char* buf = 0;
 	REX(TRN_SDFDocSaveMemory(mp_doc,(const char**)&buf,&size,flags,0,header));
-	result.resize(size);
-	memcpy(&result[0], buf, size);
-	return result;
+	return std::vector<unsigned char>((unsigned char*)buf, (unsigned char*)buf + size);
 }
 
 #ifndef SWIG
@@ -638,14 +688,23 @@ inline void SDFDoc::Save(Filters::Filter stream, UInt32 flags, const char* heade
 	REX(TRN_SDFDocSaveStream(mp_doc, stream.m_impl,flags,header));
 }
 
+#ifndef SWIG
+inline size_t SDFDoc::Save(Filters::CustomFilter::WriteProc write_proc, void* user_data, UInt32 flags, const char* header) {
+	Filters::CustomFilter sink(write_proc, user_data);
+	REX(TRN_SDFDocSaveStream(mp_doc, sink.m_impl,flags,header));
+	sink.Flush();
+	return sink.GetBytesWritten();
+}
+#endif
+
 inline const char* SDFDoc::GetHeader() const {
-	const char* result;
+	const char* result = 0;
 	REX(TRN_SDFDocGetHeader(mp_doc, &result));
 	return result;
 }
 
 inline SecurityHandler SDFDoc::GetSecurityHandler () {
-	TRN_SecurityHandler result;
+	TRN_SecurityHandler result = 0;
 	REX(TRN_SDFDocGetSecurityHandler(mp_doc, &result));
 
 	void* derived = 0;
@@ -688,19 +747,19 @@ inline void SDFDoc::Swap(UInt32 obj_num1, UInt32 obj_num2) {
 }
 
 inline bool SDFDoc::IsLinearized() const {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_SDFDocIsLinearized(mp_doc,&result));
 	return TBToB(result);
 }
 
 inline SDF::Obj SDFDoc::GetLinearizationDict() const {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_SDFDocGetLinearizationDict(mp_doc,&(result)));
 	return Obj(result);
 }
 
 inline SDF::Obj SDFDoc::GetHintStream() const {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_SDFDocGetHintStream(mp_doc,&(result)));
 	return Obj(result);
 }
@@ -715,7 +774,7 @@ inline void SDFDoc::Unlock() {
 
 inline bool SDFDoc::TryLock( int milliseconds )
 {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_SDFDocTimedLock(mp_doc,milliseconds,&result));
 	return TBToB(result);
 }
@@ -730,7 +789,7 @@ inline void SDFDoc::UnlockRead() {
 
 inline bool SDFDoc::TryLockRead( int milliseconds )
 {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_SDFDocTimedLockRead(mp_doc,milliseconds,&result));
 	return TBToB(result);
 }
@@ -740,61 +799,61 @@ inline void SDFDoc::EnableDiskCaching( bool use_cache_flag ) {
 }
 
 inline UString SDFDoc::GetFileName() const {
-	TRN_UString result;
+	TRN_UString result = 0;
 	REX(TRN_SDFDocGetFileName(mp_doc, &result));
 	return UString(result);	
 }
 
 inline Obj SDFDoc::CreateIndirectName(const char* name) {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_SDFDocCreateIndirectName(mp_doc,name,&(result)));
 	return Obj(result);
 }
 
 inline Obj SDFDoc::CreateIndirectArray() {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_SDFDocCreateIndirectArray(mp_doc,&(result)));
 	return Obj(result);
 }
 
 inline Obj SDFDoc::CreateIndirectBool(bool value) {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_SDFDocCreateIndirectBool(mp_doc,BToTB(value),&(result)));
 	return Obj(result);
 }
 
 inline Obj SDFDoc::CreateIndirectDict() {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_SDFDocCreateIndirectDict(mp_doc,&(result)));
 	return Obj(result);
 }
 
 inline Obj SDFDoc::CreateIndirectNull() {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_SDFDocCreateIndirectNull(mp_doc,&(result)));
 	return Obj(result);
 }
 
 inline Obj SDFDoc::CreateIndirectNumber(double value) {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_SDFDocCreateIndirectNumber(mp_doc,value,&(result)));
 	return Obj(result);
 }
 
 inline Obj SDFDoc::CreateIndirectString(const UChar* value, UInt32 size) {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_SDFDocCreateIndirectString(mp_doc,value,size,&(result)));
 	return Obj(result);
 }
 
 inline Obj SDFDoc::CreateIndirectString(const UString& str) {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_SDFDocCreateIndirectStringFromUString(mp_doc,str.mp_impl,&(result)));
 	return Obj(result);
 }
 
 inline Obj SDFDoc::CreateIndirectStream(Filters::FilterReader& data, Filters::Filter filter_chain) {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	filter_chain.m_owner = false;
 	REX(TRN_SDFDocCreateIndirectStreamFromFilter(mp_doc,data.m_impl,filter_chain.m_impl,&(result)));
 	// Note: SDFDoc takes the ownership of the stream
@@ -803,7 +862,7 @@ inline Obj SDFDoc::CreateIndirectStream(Filters::FilterReader& data, Filters::Fi
 }
 
 inline Obj SDFDoc::CreateIndirectStream(const char* data, const size_t data_size, Filters::Filter filter_chain) {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	filter_chain.m_owner = false;
 	REX(TRN_SDFDocCreateIndirectStream(mp_doc,data,data_size,filter_chain.m_impl,&(result)));
 	// Note: SDFDoc takes the ownership of the stream
@@ -831,12 +890,12 @@ namespace __SecHdlrPrivate
 		SecurityHandler* sh = (SecurityHandler*)derived;
 		SDFDoc d(doc);
 		TRN_Obj ret; 
-		try {
+		PDFTRON_TRY {
 			ret = sh->FillEncryptDict(d).mp_obj;
 		}
-		catch (Common::Exception& ex) {
+		PDFTRON_CATCH(...) {
 			d.mp_doc = 0;
-			throw ex;
+			PDFTRON_RETHROW;
 		}
 		d.mp_doc = 0;
 		return ret;
@@ -861,12 +920,12 @@ namespace __SecHdlrPrivate
 		SecurityHandler* sh = (SecurityHandler*)derived;
 		SDFDoc d(doc);
 		TRN_Bool ret; 
-		try {
+		PDFTRON_TRY {
 			ret = BToTB(sh->EditSecurityData(d));
 		}
-		catch (Common::Exception& ex) {
+		PDFTRON_CATCH(...) {
 			d.mp_doc = 0;
-			throw ex;
+			PDFTRON_RETHROW;
 		}
 		d.mp_doc = 0;
 		return ret;
@@ -887,7 +946,7 @@ namespace __SecHdlrPrivate
 	}
 };
 
-inline SecurityHandler::SecurityHandler (const SecurityHandler& s) {
+inline SecurityHandler::SecurityHandler (const SecurityHandler& s) : mp_handler(0) {
 	REX(TRN_SecurityHandlerClone(s.mp_handler,&mp_handler));
 	m_owner = true;
 	m_derived_procs = s.m_derived_procs;
@@ -926,19 +985,19 @@ inline bool SecurityHandler::GetPermission(Permission p) {
 }
 
 inline int SecurityHandler::GetKeyLength() const {
-	int result;
+	int result = 0;
 	REX(TRN_SecurityHandlerGetKeyLength(mp_handler, &result));
 	return result;
 }
 
 inline int SecurityHandler::GetEncryptionAlgorithmID() const {
-	int result;
+	int result = 0;
 	REX(TRN_SecurityHandlerGetEncryptionAlgorithmID(mp_handler, &result));
 	return result;
 }
 
 inline const char* SecurityHandler::GetHandlerDocName() const {
-	const char* result;
+	const char* result = 0;
 	REX(TRN_SecurityHandlerGetHandlerDocName(mp_handler, &result));
 	return result;
 }
@@ -951,19 +1010,19 @@ inline void SecurityHandler::SetModified (bool is_modified) {
 	REX(TRN_SecurityHandlerSetModified(mp_handler, BToTB(is_modified)));
 }
 
-inline SecurityHandler::SecurityHandler (AlgorithmType crypt_type) {
+inline SecurityHandler::SecurityHandler (AlgorithmType crypt_type) : mp_handler(0) {
 	REX(TRN_SecurityHandlerCreate((enum TRN_SecurityHandlerAlgorithmType)crypt_type, &mp_handler));
 	m_owner=true;
 	m_derived_procs = 0;
 }
 
-inline SecurityHandler::SecurityHandler (const char* name, int key_len, int enc_code) {
+inline SecurityHandler::SecurityHandler (const char* name, int key_len, int enc_code) : mp_handler(0) {
 	REX(TRN_SecurityHandlerCreateFromEncCode(name, key_len, enc_code,&mp_handler));
 	m_owner=true;
 	m_derived_procs = 0;
 }
 
-inline SecurityHandler::SecurityHandler () {
+inline SecurityHandler::SecurityHandler () : mp_handler(0) {
 	REX(TRN_SecurityHandlerCreateDefault(&mp_handler));
 	m_owner=true;
 	m_derived_procs = 0;
@@ -1101,7 +1160,7 @@ inline const char* SecurityHandler::GetUserPassword() {
 }
 
 inline size_t SecurityHandler::GetUserPasswordSize() const {
-	TRN_UInt32 res;
+	TRN_UInt32 res = 0;
 	REX( TRN_SecurityHandlerGetUserPasswordSize( mp_handler, &res ) );
 	return res;
 }
@@ -1129,7 +1188,7 @@ inline const char* SecurityHandler::GetMasterPassword() {
 }
 
 inline size_t SecurityHandler::GetMasterPasswordSize() const {
-	TRN_UInt32 res;
+	TRN_UInt32 res = 0;
 	REX( TRN_SecurityHandlerGetMasterPasswordSize( mp_handler, &res ) );
 	return res;
 }
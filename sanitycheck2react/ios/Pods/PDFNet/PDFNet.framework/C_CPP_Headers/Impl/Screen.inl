@@ -22,7 +22,7 @@ inline Screen::Screen(SDF::Obj d):Annot(d)
 
 inline Screen Screen::Create(SDF::SDFDoc& doc, const Rect& pos)
 {
-	TRN_Annot result;
+	TRN_Annot result = 0;
 	REX(TRN_ScreenAnnotCreate(doc.mp_doc,(const TRN_Rect*)&pos, &result));
 	return Screen(result);
 }
@@ -41,7 +41,7 @@ inline void Screen::SetTitle(const UString& title)
 //A
 inline Action Screen::GetAction() const
 {
-	TRN_Action result;
+	TRN_Action result = 0;
 	REX(TRN_ScreenAnnotGetAction(mp_annot,&result));
 	return Action(result);
 }
@@ -54,7 +54,7 @@ inline void Screen::SetAction(const Action& action)
 //BC
 inline int Screen::GetBorderColorCompNum() const
 {
-	int result;
+	int result = 0;
 	REX(TRN_ScreenAnnotGetBorderColorCompNum(mp_annot, &result));
 	return result;
 }
@@ -72,7 +72,7 @@ inline void Screen::SetBorderColor(const ColorPt& c, int CompNum)
 //BG
 inline int Screen::GetBackgroundColorCompNum() const
 {
-	int result;
+	int result = 0;
 	REX(TRN_ScreenAnnotGetBackgroundColorCompNum(mp_annot, &result));
 	return result;
 }
@@ -90,7 +90,7 @@ inline void Screen::SetBackgroundColor(const ColorPt& c, int CompNum)
 //CA 
 inline UString Screen::GetStaticCaptionText() const
 {
-	TRN_UString result;
+	TRN_UString result = 0;
 	REX(TRN_ScreenAnnotGetStaticCaptionText(mp_annot,&result));
 	return UString(result);	
 }
@@ -103,7 +103,7 @@ inline void Screen::SetStaticCaptionText(const UString& ct)
 //RC
 inline UString Screen::GetRolloverCaptionText() const
 {
-	TRN_UString result;
+	TRN_UString result = 0;
 	REX(TRN_ScreenAnnotGetRolloverCaptionText(mp_annot,&result));
 	return UString(result);
 }
@@ -115,7 +115,7 @@ inline void Screen::SetRolloverCaptionText(const UString& ct)
 //AC
 inline UString Screen::GetMouseDownCaptionText() const
 {
-	TRN_UString result;
+	TRN_UString result = 0;
 	REX(TRN_ScreenAnnotGetMouseDownCaptionText(mp_annot,&result));
 	return UString(result);
 }
@@ -128,7 +128,7 @@ inline void Screen::SetMouseDownCaptionText(const UString& ct)
 //I
 inline SDF::Obj Screen::GetStaticIcon() const
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ScreenAnnotGetStaticIcon(mp_annot, &result));
 	return SDF::Obj(result);
 }
@@ -141,7 +141,7 @@ inline void Screen::SetStaticIcon(SDF::Obj ic)
 //RI
 inline SDF::Obj Screen::GetRolloverIcon() const
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ScreenAnnotGetRolloverIcon(mp_annot, &result));
 	return SDF::Obj(result);
 }
@@ -154,7 +154,7 @@ inline void Screen::SetRolloverIcon(SDF::Obj ic)
 //IX
 inline SDF::Obj Screen::GetMouseDownIcon() const
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_ScreenAnnotGetMouseDownIcon(mp_annot, &result));
 	return SDF::Obj(result);
 }
@@ -206,7 +206,7 @@ inline void Screen::SetScaleCondition(ScaleCondition sd)
 //LO
 inline double Screen::GetHIconLeftOver() const
 {
-	double result;
+	double result = 0;
 	REX(TRN_ScreenAnnotGetHIconLeftOver(mp_annot,&result));
 	return result;
 }
@@ -216,7 +216,7 @@ inline void Screen::SetHIconLeftOver(double hl)
 }
 inline double Screen::GetVIconLeftOver() const
 {
-	double result;
+	double result = 0;
 	REX(TRN_ScreenAnnotGetVIconLeftOver(mp_annot,&result));
 	return result;
 }
@@ -230,7 +230,7 @@ inline void Screen::SetVIconLeftOver(double vl)
 //FB
 inline bool Screen::GetFitFull() const
 {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_ScreenAnnotGetFitFull(mp_annot,&result));
 	return TBToB(result);
 }
@@ -1,21 +1,43 @@
 
-inline Shading::Shading (SDF::Obj shading_dict)
+inline Shading::Shading (SDF::Obj shading_dict) : mp_shade(0)
 {
 	REX(TRN_ShadingCreate(shading_dict.mp_obj,&mp_shade));
 }
 
-inline Shading::Shading (const Shading& s)
+inline Shading::Shading (const Shading& s) : mp_shade(0)
 {
+	if (!s.mp_shade) return;	// a copy of a moved-from shading is null
 	REX(TRN_ShadingCreate(0,&mp_shade));
 	REX(TRN_ShadingAssign(mp_shade,s.mp_shade));
 }
 
 inline Shading& Shading::operator=(const Shading& s)
 {
+	if (!s.mp_shade) {
+		DREX(mp_shade, TRN_ShadingDestroy(mp_shade));
+		return *this;
+	}
+	if (!mp_shade) {
+		// moved-from target
+		REX(TRN_ShadingCreate(0,&mp_shade));
+	}
 	REX(TRN_ShadingAssign(mp_shade,s.mp_shade))
 	return *this;
 }
 
+#ifdef PDFTRON_CPP11
+inline Shading::Shading(Shading&& other) noexcept : mp_shade(other.mp_shade)
+{
+	other.mp_shade = 0;
+}
+
+inline Shading& Shading::operator=(Shading&& other) noexcept
+{
+	std::swap(mp_shade, other.mp_shade);
+	return *this;
+}
+#endif
+
 inline Shading::~Shading()
 {
 	DREX(mp_shade, TRN_ShadingDestroy(mp_shade));
@@ -49,7 +71,7 @@ inline SDF::Obj Shading::GetSDFObj ()
 
 inline ColorSpace Shading::GetBaseColorSpace()
 {
-	TRN_ColorSpace result;
+	TRN_ColorSpace result = 0;
 	REX(TRN_ShadingGetBaseColorSpace(mp_shade,&result));
 	return ColorSpace(result);
 }
@@ -115,10 +137,10 @@ inline void Shading::GetColor(double t, ColorPt& out_color)
 
 inline std::vector<double> Shading::GetCoordsAxial()
 {
-	double out_x0; 
-	double out_y0; 
-	double out_x1; 
-	double out_y1;
+	double out_x0 = 0;
+	double out_y0 = 0;
+	double out_x1 = 0;
+	double out_y1 = 0;
 	std::vector<double> arr(4);
 	REX(TRN_ShadingGetCoords(mp_shade,&out_x0,&out_y0,&out_x1,&out_y1));
 	arr[0] = out_x0;
@@ -137,12 +159,12 @@ inline void Shading::GetCoords(double& out_x0, double& out_y0, double& out_x1, d
 
 inline std::vector<double> Shading::GetCoordsRadial()
 {
-	double out_x0; 
-	double out_y0;
-	double out_r0;
-	double out_x1; 
-	double out_y1;
-	double out_r1;
+	double out_x0 = 0;
+	double out_y0 = 0;
+	double out_r0 = 0;
+	double out_x1 = 0;
+	double out_y1 = 0;
+	double out_r1 = 0;
 	std::vector<double> arr(6);
 	REX(TRN_ShadingGetCoordsRadial(mp_shade,&out_x0,&out_y0,&out_r0,&out_x1,&out_y1,&out_r1));
 	arr[0] = out_x0;
@@ -163,10 +185,10 @@ inline void Shading::GetCoords(double& out_x0, double& out_y0, double& out_r0,	d
 
 inline std::vector<double> Shading::GetDomain()
 {
-	double out_xmin;
-	double out_xmax;
-	double out_ymin;
-	double out_ymax;
+	double out_xmin = 0;
+	double out_xmax = 0;
+	double out_ymin = 0;
+	double out_ymax = 0;
 	std::vector<double> arr(4); 
 	REX(TRN_ShadingGetDomain(mp_shade,&out_xmin,&out_xmax,&out_ymin,&out_ymax));
 	arr[0] = out_xmin;
@@ -13,22 +13,25 @@ namespace SDF {
 
 inline UString SignatureHandler::GetName() const
 {
-    throw (pdftron::Common::Exception("pdftron::SDF::SignatureHandler::GetName not implemented.", __LINE__, __FILE__, __FUNCTION__, "pdftron::SDF::SignatureHandler::GetName not implemented."));
+    PDFTRON_THROW(pdftron::Common::Exception("pdftron::SDF::SignatureHandler::GetName not implemented.", __LINE__, __FILE__, __FUNCTION__, "pdftron::SDF::SignatureHandler::GetName not implemented."));
+    return UString();
 }
 
 inline void SignatureHandler::AppendData(const std::vector<pdftron::UInt8>& in_data)
 {
-    throw (pdftron::Common::Exception("pdftron::SDF::SignatureHandler::AppendData not implemented.", __LINE__, __FILE__, __FUNCTION__, "pdftron::SDF::SignatureHandler::AppendData not implemented."));
+    PDFTRON_THROW(pdftron::Common::Exception("pdftron::SDF::SignatureHandler::AppendData not implemented.", __LINE__, __FILE__, __FUNCTION__, "pdftron::SDF::SignatureHandler::AppendData not implemented."));
 }
 
 inline bool SignatureHandler::Reset()
 {
-    throw (pdftron::Common::Exception("pdftron::SDF::SignatureHandler::Reset not implemented.", __LINE__, __FILE__, __FUNCTION__, "pdftron::SDF::SignatureHandler::Reset not implemented."));
+    PDFTRON_THROW(pdftron::Common::Exception("pdftron::SDF::SignatureHandler::Reset not implemented.", __LINE__, __FILE__, __FUNCTION__, "pdftron::SDF::SignatureHandler::Reset not implemented."));
+    return false;
 }
 
 inline std::vector<pdftron::UInt8> SignatureHandler::CreateSignature()
 {
-    throw (pdftron::Common::Exception("pdftron::SDF::SignatureHandler::CreateSignature not implemented.", __LINE__, __FILE__, __FUNCTION__, "pdftron::SDF::SignatureHandler::Generate not implemented."));
+    PDFTRON_THROW(pdftron::Common::Exception("pdftron::SDF::SignatureHandler::CreateSignature not implemented.", __LINE__, __FILE__, __FUNCTION__, "pdftron::SDF::SignatureHandler::Generate not implemented."));
+    return std::vector<pdftron::UInt8>();
 }
 /*
 inline SignatureHandler::ValidateSignatureResult SignatureHandler::ValidateSignature(const SDF::Obj& in_sig_dict)
@@ -42,8 +45,13 @@ inline SignatureHandler::~SignatureHandler()
 #ifndef SWIGHIDDEN_SIG
 
 #define CREATE_TRNEX(message) TRN_CreateException("false", __FILE__, __LINE__, __FUNCTION__, message)
+#ifdef PDFTRON_NO_EXCEPTIONS
+#define SIGAPI_BEX {
+#define SIGAPI_EEX }
+#else
 #define SIGAPI_BEX try{
 #define SIGAPI_EEX }catch(pdftron::Common::Exception& e){return(CREATE_TRNEX(e.GetMessage()));}catch(std::exception& e){return(CREATE_TRNEX(e.what()));}catch(...){return(CREATE_TRNEX("Unknown exception."));}
+#endif
                     
 inline TRN_Exception TRN_SIGAPI SignatureHandler::TRN_SignatureHandlerGetNameImpl(TRN_UString* out_name, void* derived)
 {
@@ -123,7 +131,7 @@ inline TRN_ValidateSignatureResult TRN_SIGAPI SignatureHandler::TRN_SignatureHan
 {
     SIGAPI_BEX;
     if (derived == NULL)
-        throw (pdftron::Common::Exception("derived == NULL", __LINE__, __FILE__, __FUNCTION__, "Failed to obtain derived instance of pdftron::SDF::SignatureHandler."));
+        PDFTRON_THROW(pdftron::Common::Exception("derived == NULL", __LINE__, __FILE__, __FUNCTION__, "Failed to obtain derived instance of pdftron::SDF::SignatureHandler."));
 
     SignatureHandler* sig = ((SignatureHandler*) derived);
     pdftron::SDF::Obj sigDict(in_sig_dict);
@@ -1,6 +1,6 @@
 
 //CONSTRUCTOR
-inline Stamper::Stamper(SizeType size_type, double a, double b)
+inline Stamper::Stamper(SizeType size_type, double a, double b) : mp_impl(0)
 {
 	REX(TRN_StamperCreate(static_cast<TRN_StamperSizeType>(size_type), a, b, &mp_impl));
 }
@@ -110,7 +110,7 @@ inline void Stamper::DeleteStamps(PDFDoc& doc, const PageSet& page_set)
 
 inline bool Stamper::HasStamps(PDFDoc& doc, const PageSet& page_set)
 {
-	TRN_Bool res;
+	TRN_Bool res = 0;
 	REX(TRN_StamperHasStamps(doc.mp_doc, page_set.mp_impl, &res));
 	return TBToB(res);
 }
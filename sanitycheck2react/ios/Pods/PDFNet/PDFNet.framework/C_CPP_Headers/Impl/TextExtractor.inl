@@ -1,5 +1,5 @@
 
-inline TextExtractor::TextExtractor()
+inline TextExtractor::TextExtractor() : mp_extractor(0)
 {
 	REX(TRN_TextExtractorCreate(&mp_extractor));
 }
@@ -8,6 +8,19 @@ inline TextExtractor::~TextExtractor()
 	DREX(mp_extractor, TRN_TextExtractorDestroy(mp_extractor));
 }
 
+#ifdef PDFTRON_CPP11
+inline TextExtractor::TextExtractor(TextExtractor&& other) noexcept : mp_extractor(other.mp_extractor)
+{
+	other.mp_extractor = 0;
+}
+
+inline TextExtractor& TextExtractor::operator=(TextExtractor&& other) noexcept
+{
+	std::swap(mp_extractor, other.mp_extractor);
+	return *this;
+}
+#endif
+
 inline void TextExtractor::Destroy()
 {
 	REX(TRN_TextExtractorDestroy(mp_extractor));
@@ -74,6 +87,182 @@ inline void TextExtractor::GetAsXML(UString& out_xml, UInt32 xml_output_flags)
 {
 	REX(TRN_TextExtractorGetAsXML(mp_extractor,(int)xml_output_flags, out_xml.mp_impl));
 }
+
+inline int PageTextData::GetWordCount() const
+{
+	return word_offsets.empty() ? 0 : (int)word_offsets.size() - 1;
+}
+
+inline int PageTextData::GetLineCount() const
+{
+	return (int)line_para_ids.size();
+}
+
+inline UStringView PageTextData::GetWord(int word_idx) const
+{
+	int off = word_offsets[word_idx];
+	int len = word_offsets[word_idx+1] - off;
+	return len ? UStringView(&text[off], len) : UStringView();
+}
+
+inline void PageTextData::Clear()
+{
+	text.clear();
+	word_offsets.clear();
+	word_bboxes.clear();
+	word_quads.clear();
+	word_line_ids.clear();
+	word_style_ids.clear();
+	styles.clear();
+	utf8_text.clear();
+	utf8_offsets.clear();
+	glyph_offsets.clear();
+	glyph_quads.clear();
+	line_bboxes.clear();
+	line_para_ids.clear();
+	line_flow_ids.clear();
+}
+
+inline void TextExtractor::GetPageData(PageTextData& out_data, UInt32 flags)
+{
+	out_data.Clear();
+
+	int num_words, num_lines;
+	REX(TRN_TextExtractorGetWordCount(mp_extractor, &num_words));
+	REX(TRN_TextExtractorGetNumLines(mp_extractor, &num_lines));
+
+	out_data.word_offsets.reserve(num_words + 1);
+	out_data.word_bboxes.resize(4 * (size_t)num_words);
+	out_data.word_line_ids.reserve(num_words);
+	out_data.line_bboxes.reserve(4 * (size_t)num_lines);
+	out_data.line_para_ids.reserve(num_lines);
+	out_data.line_flow_ids.reserve(num_lines);
+	if (flags & e_page_data_quads) out_data.word_quads.resize(8 * (size_t)num_words);
+	if (flags & e_page_data_styles) out_data.word_style_ids.reserve(num_words);
+	if (flags & e_page_data_utf8) out_data.utf8_offsets.reserve(num_words + 1);
+	if (flags & e_page_data_glyph_quads) out_data.glyph_offsets.reserve(num_words + 1);
+
+	TRN_TextExtractorLine line = TRN_TextExtractorLine();
+	TRN_TextExtractorWord word = TRN_TextExtractorWord();
+	TRN_TextExtractorStyle style;
+	// styles by font, size and color; the candidates are compared in full
+	std::multimap<std::string, int> style_index;
+	TRN_Bool valid = 0;
+	const double* line_bbox = 0;
+	const Unicode* str;
+	int len, line_id = 0, word_idx = 0, val;
+
+	REX(TRN_TextExtractorGetFirstLine(mp_extractor, &line));
+	REX(TRN_TextExtractorLineIsValid(&line, &valid));
+	while (valid) {
+		REX(TRN_TextExtractorLineGetBBox(&line, &line_bbox));
+		out_data.line_bboxes.insert(out_data.line_bboxes.end(), line_bbox, line_bbox + 4);
+		REX(TRN_TextExtractorLineGetParagraphID(&line, &val));
+		out_data.line_para_ids.push_back(val);
+		REX(TRN_TextExtractorLineGetFlowID(&line, &val));
+		out_data.line_flow_ids.push_back(val);
+
+		REX(TRN_TextExtractorLineGetFirstWord(&line, &word));
+		REX(TRN_TextExtractorWordIsValid(&word, &valid));
+		while (valid) {
+			if (word_idx == num_words) {
+				// GetWordCount() is a lower bound; grow the fixed-size arrays
+				++num_words;
+				out_data.word_bboxes.resize(4 * (size_t)num_words);
+				if (flags & e_page_data_quads) out_data.word_quads.resize(8 * (size_t)num_words);
+			}
+
+			REX(TRN_TextExtractorWordGetStringLen(&word, &len));
+			REX(TRN_TextExtractorWordGetString(&word, &str));
+			out_data.word_offsets.push_back((int)out_data.text.size());
+			out_data.text.insert(out_data.text.end(), str, str + len);
+			out_data.word_line_ids.push_back(line_id);
+			REX(TRN_TextExtractorWordGetBBox(&word, &out_data.word_bboxes[4 * (size_t)word_idx]));
+
+			if (flags & e_page_data_quads) {
+				REX(TRN_TextExtractorWordGetQuad(&word, &out_data.word_quads[8 * (size_t)word_idx]));
+			}
+
+			if (flags & e_page_data_styles) {
+				REX(TRN_TextExtractorWordGetStyle(&word, &style));
+				// consecutive words usually share a style, so test the most recent one first
+				int id = out_data.word_style_ids.empty() ? -1 : out_data.word_style_ids.back();
+				TRN_Bool same = 0;
+				if (id >= 0) REX(TRN_TextExtractorStyleCompare(&style, &out_data.styles[id].mp_style, &same));
+				if (!same) {
+					std::string key = GetStyleKey(style);
+					std::multimap<std::string, int>::iterator itr = style_index.lower_bound(key);
+					for (; itr != style_index.end() && itr->first == key; ++itr) {
+						REX(TRN_TextExtractorStyleCompare(&style, &out_data.styles[itr->second].mp_style, &same));
+						if (same) break;
+					}
+					if (same) {
+						id = itr->second;
+					}
+					else {
+						id = (int)out_data.styles.size();
+						out_data.styles.push_back(Style(style));
+						style_index.insert(itr, std::make_pair(key, id));
+					}
+				}
+				out_data.word_style_ids.push_back(id);
+			}
+
+			if (flags & e_page_data_utf8) {
+				UStringView view(str, len);
+				int sz = view.ConvertToUtf8(0, 0, false);
+				size_t pos = out_data.utf8_text.size();
+				out_data.utf8_offsets.push_back((int)pos);
+				out_data.utf8_text.resize(pos + sz);
+				if (sz) view.ConvertToUtf8(&out_data.utf8_text[pos], sz, false);
+			}
+
+			if (flags & e_page_data_glyph_quads) {
+				int num_glyphs = 0;
+				REX(TRN_TextExtractorWordGetNumGlyphs(&word, &num_glyphs));
+				size_t pos = out_data.glyph_quads.size();
+				out_data.glyph_offsets.push_back((int)(pos / 8));
+				out_data.glyph_quads.resize(pos + 8 * (size_t)num_glyphs);
+				for (int i = 0; i < num_glyphs; ++i) {
+					REX(TRN_TextExtractorWordGetGlyphQuad(&word, i, &out_data.glyph_quads[pos + 8 * (size_t)i]));
+				}
+			}
+
+			++word_idx;
+			TRN_TextExtractorWord next_word = TRN_TextExtractorWord();
+			REX(TRN_TextExtractorWordGetNextWord(&word, &next_word));
+			word = next_word;
+			REX(TRN_TextExtractorWordIsValid(&word, &valid));
+		}
+
+		++line_id;
+		TRN_TextExtractorLine next_line = TRN_TextExtractorLine();
+		REX(TRN_TextExtractorLineGetNextLine(&line, &next_line));
+		line = next_line;
+		REX(TRN_TextExtractorLineIsValid(&line, &valid));
+	}
+
+	// trim the fixed-size arrays in case there were fewer words than reported
+	out_data.word_bboxes.resize(4 * (size_t)word_idx);
+	if (flags & e_page_data_quads) out_data.word_quads.resize(8 * (size_t)word_idx);
+	out_data.word_offsets.push_back((int)out_data.text.size());
+	if (flags & e_page_data_utf8) out_data.utf8_offsets.push_back((int)out_data.utf8_text.size());
+	if (flags & e_page_data_glyph_quads) out_data.glyph_offsets.push_back((int)(out_data.glyph_quads.size() / 8));
+}
+
+inline std::string TextExtractor::GetStyleKey(TRN_TextExtractorStyle& style)
+{
+	TRN_Obj font = 0;
+	double font_size = 0;
+	UInt8 rgb[3];
+	REX(TRN_TextExtractorStyleGetFont(&style, &font));
+	REX(TRN_TextExtractorStyleGetFontSize(&style, &font_size));
+	REX(TRN_TextExtractorStyleGetColor(&style, rgb));
+	std::string key((const char*)&font, sizeof(font));
+	key.append((const char*)&font_size, sizeof(font_size));
+	key.append((const char*)rgb, sizeof(rgb));
+	return key;
+}
 #endif
 
 
@@ -137,17 +326,17 @@ inline bool Style::operator!= (const Style& s)
 	return !operator==(s);
 }
 
-inline Style::Style()
+inline Style::Style() : mp_style()
 {
 	REX(TRN_TextExtractorStyleCreate(&mp_style))
 }
 
-inline Style::Style(const Style& s)
+inline Style::Style(const Style& s) : mp_style()
 {
 	REX(TRN_TextExtractorStyleCopy((TRN_TextExtractorStyle*)&(s.mp_style),&mp_style));
 }
 
-inline Style::Style(TRN_TextExtractorStyle impl)
+inline Style::Style(TRN_TextExtractorStyle impl) : mp_style()
 {
 	REX(TRN_TextExtractorStyleCopy(&impl, &mp_style));
 }
@@ -206,14 +395,14 @@ inline void Word::GetGlyphQuad(int glyph_idx, double out_quad[8])
 
 inline Style Word::GetCharStyle(int char_idx)
 {
-	TRN_TextExtractorStyle result;
+	TRN_TextExtractorStyle result = TRN_TextExtractorStyle();
 	REX(TRN_TextExtractorWordGetCharStyle(&mp_word,char_idx, &result));
 	return Style(result);
 }
 
 inline Style Word::GetStyle()
 {
-	TRN_TextExtractorStyle result;
+	TRN_TextExtractorStyle result = TRN_TextExtractorStyle();
 	REX(TRN_TextExtractorWordGetStyle(&mp_word, &result));
 	return Style(result);
 }
@@ -226,8 +415,8 @@ inline int Word::GetStringLen()
 #ifdef SWIG
 inline UString Word::GetString()
 {
-	const Unicode* result;
-	int len;
+	const Unicode* result = 0;
+	int len = 0;
 	REX(TRN_TextExtractorWordGetStringLen(&mp_word, &len));
 	REX(TRN_TextExtractorWordGetString(&mp_word, &result));
 	UString ustr(result, len);
@@ -236,22 +425,31 @@ inline UString Word::GetString()
 #else
 inline const Unicode* Word::GetString()
 {
-	const Unicode* result;
+	const Unicode* result = 0;
 	REX(TRN_TextExtractorWordGetString(&mp_word, &result));
 	return result;
 }
+
+inline UStringView Word::GetStringView()
+{
+	const Unicode* result = 0;
+	int len = 0;
+	REX(TRN_TextExtractorWordGetStringLen(&mp_word, &len));
+	REX(TRN_TextExtractorWordGetString(&mp_word, &result));
+	return UStringView(result, len);
+}
 #endif
 
 inline Word Word::GetNextWord()
 {
-	TRN_TextExtractorWord result;
+	TRN_TextExtractorWord result = TRN_TextExtractorWord();
 	REX(TRN_TextExtractorWordGetNextWord(&mp_word,&result));
 	return Word(result);
 }
 
 inline int Word::GetCurrentNum()
 {
-	int result;
+	int result = 0;
 	REX(TRN_TextExtractorWordGetCurrentNum(&mp_word, &result));
 	return result;
 }
@@ -266,7 +464,7 @@ inline bool Word::operator!= (const Word& w)
 	return !this->operator==(w);
 }
 
-inline Word::Word()
+inline Word::Word() : mp_word()
 {
 	REX(TRN_TextExtractorWordCreate(&mp_word));
 }
@@ -294,7 +492,7 @@ inline bool Line::IsSimpleLine()
 #ifdef SWIG
 inline Rect Line::GetBBox()
 {
-	const double* arr;
+	const double* arr = 0;
 	REX(TRN_TextExtractorLineGetBBox(&mp_line, &arr));
 	Rect bbox(arr[0],arr[1],arr[2],arr[3]);
 	return bbox;
@@ -302,7 +500,7 @@ inline Rect Line::GetBBox()
 #else
 inline const double* Line::GetBBox()
 {
-	const double* result;
+	const double* result = 0;
 	REX(TRN_TextExtractorLineGetBBox(&mp_line, &result));
 	return result;
 }
@@ -326,35 +524,35 @@ inline void Line::GetQuad(double out_quad[8])
 
 inline Word Line::GetFirstWord()
 {
-	TRN_TextExtractorWord result;
+	TRN_TextExtractorWord result = TRN_TextExtractorWord();
 	REX(TRN_TextExtractorLineGetFirstWord(&mp_line, &result));
 	return Word(result);
 }
 
 inline Word Line::GetWord(int word_idx)
 {
-	TRN_TextExtractorWord result;
+	TRN_TextExtractorWord result = TRN_TextExtractorWord();
 	REX(TRN_TextExtractorLineGetWord(&mp_line, word_idx,&result));
 	return Word(result);
 }
 
 inline Line Line::GetNextLine()
 {
-	TRN_TextExtractorLine result;
+	TRN_TextExtractorLine result = TRN_TextExtractorLine();
 	REX(TRN_TextExtractorLineGetNextLine(&mp_line, &result));
 	return Line(result);
 }
 
 inline int Line::GetCurrentNum()
 {
-	int result;
+	int result = 0;
 	REX(TRN_TextExtractorLineGetCurrentNum(&mp_line, &result));
 	return result;
 }
 
 inline Style Line::GetStyle()
 {
-	TRN_TextExtractorStyle result;
+	TRN_TextExtractorStyle result = TRN_TextExtractorStyle();
 	REX(TRN_TextExtractorLineGetStyle(&mp_line,&result));
 	return Style(result);
 }
@@ -384,7 +582,7 @@ inline bool Line::operator!= (const Line& l)
 	return !this->operator==(l);
 }
 
-inline Line::Line()
+inline Line::Line() : mp_line()
 {
 	REX(TRN_TextExtractorLineCreate(&mp_line));
 }
@@ -407,7 +605,7 @@ inline int TextExtractor::GetNumLines()
 
 inline Line TextExtractor::GetFirstLine()
 {
-	TRN_TextExtractorLine result;
+	TRN_TextExtractorLine result = TRN_TextExtractorLine();
 	REX(TRN_TextExtractorGetFirstLine(mp_extractor, &result));
 	return Line(result);
 }
@@ -39,7 +39,7 @@ inline SearchResult::SearchResult(int p, TRN_TextSearchResultCode rc, UString r,
 	hlts = h;
 }
 
-inline TextSearch::TextSearch()
+inline TextSearch::TextSearch() : mp_textsearch(0)
 {
 	REX(TRN_TextSearchCreate(&mp_textsearch));
 }
@@ -49,6 +49,19 @@ inline TextSearch::~TextSearch()
 	DREX(mp_textsearch, TRN_TextSearchDestroy(mp_textsearch));
 }
 
+#ifdef PDFTRON_CPP11
+inline TextSearch::TextSearch(TextSearch&& other) noexcept : mp_textsearch(other.mp_textsearch)
+{
+	other.mp_textsearch = 0;
+}
+
+inline TextSearch& TextSearch::operator=(TextSearch&& other) noexcept
+{
+	std::swap(mp_textsearch, other.mp_textsearch);
+	return *this;
+}
+#endif
+
 inline void TextSearch::Destroy()
 {
 	REX(TRN_TextSearchDestroy(mp_textsearch));
@@ -62,10 +75,10 @@ inline bool TextSearch::Begin(PDFDoc& doc, const UString& pattern, TRN_UInt32 mo
 
 inline SearchResult TextSearch::Run()
 {
-	TRN_TextSearchResultCode code;
+	TRN_TextSearchResultCode code = TRN_TextSearchResultCode();
 	UString out_str;
 	UString ambient_str;
-	int page_num;
+	int page_num = 0;
 	Highlights hlts;
 	REX(TRN_TextSearchRun(mp_textsearch, &page_num, out_str.mp_impl, ambient_str.mp_impl, hlts.mp_highlights, &code));
 	return SearchResult(page_num, code, out_str, ambient_str, hlts);
@@ -78,7 +91,7 @@ inline bool TextSearch::SetPattern(const UString& pattern)
 
 inline TextSearch::Mode TextSearch::GetMode() const
 {
-	TRN_UInt32 mode;
+	TRN_UInt32 mode = 0;
 	REX(TRN_TextSearchGetMode(mp_textsearch, &mode));
 	return (TextSearch::Mode)mode;
 }
@@ -95,7 +108,7 @@ inline void TextSearch::SetRightToLeftLanguage(bool flag)
 
 inline int TextSearch::GetCurrentPage() const
 {
-	int page;
+	int page = 0;
 	REX(TRN_TextSearchGetCurrentPage(mp_textsearch, &page));
 	return page;
 }
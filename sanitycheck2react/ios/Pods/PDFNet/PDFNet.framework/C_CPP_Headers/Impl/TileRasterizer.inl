@@ -0,0 +1,67 @@
+
+inline TileRasterizer::TileRasterizer(int num_threads, PDFRasterizer::Type type)
+	: m_scheduler(num_threads), m_type(type), m_tile_width(256), m_tile_height(256),
+	m_rasterizers(m_scheduler.GetThreadCount())
+{
+}
+
+inline int TileRasterizer::GetThreadCount() const
+{
+	return m_scheduler.GetThreadCount();
+}
+
+inline void TileRasterizer::SetTileSize(int tile_width, int tile_height)
+{
+	m_tile_width = tile_width > 0 ? tile_width : 1;
+	m_tile_height = tile_height > 0 ? tile_height : 1;
+}
+
+inline void TileRasterizer::SetRasterizerConfig(const ConfigProc& proc)
+{
+	m_config = proc;
+	if (!m_config) return;
+	for (size_t i = 0; i < m_rasterizers.size(); ++i) {
+		if (m_rasterizers[i]) m_config(*m_rasterizers[i]);
+	}
+}
+
+inline PDFRasterizer& TileRasterizer::GetRasterizer(int worker)
+{
+	std::unique_ptr<PDFRasterizer>& rast = m_rasterizers[worker];
+	if (!rast) {
+		rast.reset(new PDFRasterizer(m_type));
+		if (m_config) m_config(*rast);
+	}
+	return *rast;
+}
+
+inline void TileRasterizer::Rasterize(PDFDoc& doc, Page& page, UChar* in_out_image_buffer,
+			int width, int height, int stride,
+			int num_comps, bool demult,
+			const Common::Matrix2D& device_mtx,
+			const Rect* clip,
+			bool* cancel)
+{
+	if (width <= 0 || height <= 0) return;
+	int cols = (width + m_tile_width - 1) / m_tile_width;
+	int rows = (height + m_tile_height - 1) / m_tile_height;
+
+	m_scheduler.Run(cols * rows, [&](int tile, int worker) {
+		if (cancel && *cancel) return;
+		int x = (tile % cols) * m_tile_width;
+		int y = (tile / cols) * m_tile_height;
+		int w = width - x < m_tile_width ? width - x : m_tile_width;
+		int h = height - y < m_tile_height ? height - y : m_tile_height;
+
+		// Render the tile in place: the buffer pointer is moved to the tile origin
+		// and the page is shifted by the same amount in device space.
+		Common::Matrix2D mtx(device_mtx);
+		mtx.m_h -= x;
+		mtx.m_v -= y;
+		UChar* dst = in_out_image_buffer + (ptrdiff_t)y * stride + (ptrdiff_t)x * num_comps;
+
+		PDFRasterizer& rast = GetRasterizer(worker);
+		DocReadGuard guard(doc, "TileRasterizer::Rasterize");
+		rast.Rasterize(page, dst, w, h, stride, num_comps, demult, mtx, clip, 0, cancel);
+	});
+}
@@ -1,28 +1,28 @@
 
-inline UString::UString()
+inline UString::UString() : mp_impl(0)
 { REX(TRN_UStringCreate(&mp_impl))}
 
-inline UString::UString(const UString& str)
+inline UString::UString(const UString& str) : mp_impl(0)
 { REX(TRN_UStringCopy(str.mp_impl,&mp_impl))}
 
-inline UString::UString(Unicode value)
+inline UString::UString(Unicode value) : mp_impl(0)
 { REX(TRN_UStringCreateFromCharacter((TRN_Unicode)value,&mp_impl)) }
 
-inline UString::UString(const Unicode* value)
+inline UString::UString(const Unicode* value) : mp_impl(0)
 { REX(TRN_UStringCreateFromString((TRN_Unicode*)value,&mp_impl)) }
 
-inline UString::UString(const Unicode* value, int length)
+inline UString::UString(const Unicode* value, int length) : mp_impl(0)
 { REX(TRN_UStringCreateFromSubstring((TRN_Unicode*)value,length,&mp_impl)) }
 
-inline UString::UString(const char* buf, int buf_sz, TextEncoding enc)
+inline UString::UString(const char* buf, int buf_sz, TextEncoding enc) : mp_impl(0)
 { REX(TRN_UStringCreateFromCharString(buf,buf_sz,(TRN_UStringTextEncoding)enc,&mp_impl))}
 
-inline UString::UString(const std::string & str, TextEncoding enc )
+inline UString::UString(const std::string & str, TextEncoding enc ) : mp_impl(0)
 { 
 	REX(TRN_UStringCreateFromCharString( str.data(), (int)str.size(), (TRN_UStringTextEncoding)enc, &mp_impl) );
 }
 
-inline UString::UString( const std::wstring& value )
+inline UString::UString( const std::wstring& value ) : mp_impl(0)
 {
 	if( sizeof(std::wstring::value_type)==2 ) {
 		REX(TRN_UStringCreateFromSubstring((const TRN_Unicode*)(value.data()),(int)value.size(),&mp_impl));
@@ -44,16 +44,42 @@ inline UString& UString::operator=(const char* ascii_str)
 { return Assign2(ascii_str); }
 
 inline UString& UString::Assign(const UString& uni) {
+	if (!mp_impl) {
+		// moved-from string
+		REX(TRN_UStringCopy(uni.mp_impl,&mp_impl));
+		return *this;
+	}
 	REX(TRN_UStringAssignUString(mp_impl,uni.mp_impl));
 	return *this;
 }
 
+#ifdef PDFTRON_CPP11
+inline UString::UString(UString&& other) noexcept : mp_impl(other.mp_impl)
+{
+	other.mp_impl = 0;
+}
+
+inline UString& UString::operator=(UString&& other) noexcept
+{
+	std::swap(mp_impl, other.mp_impl);
+	return *this;
+}
+#endif
+
 inline UString& UString::Assign(const Unicode* uni, int buf_sz) {
+	if (!mp_impl) {
+		// moved-from string
+		REX(TRN_UStringCreate(&mp_impl));
+	}
 	REX(TRN_UStringAssignString(mp_impl,(const TRN_Unicode*)uni,buf_sz));
 	return *this;
 }
 
 inline UString& UString::Assign2(const char* buf, int buf_sz, TextEncoding enc) {
+	if (!mp_impl) {
+		// moved-from string
+		REX(TRN_UStringCreate(&mp_impl));
+	}
 	REX(TRN_UStringAssignAscii(mp_impl,buf,buf_sz,(TRN_UStringTextEncoding)enc));
 	return *this;
 }
@@ -70,25 +96,25 @@ inline UString UString::Concat(const UString &str) const {
 }
 
 inline int UString::GetLength() const {
-	int result;
+	int result = 0;
 	REX(TRN_UStringGetLength(mp_impl,&result));
 	return result;
 }
 
 inline bool UString::Empty() const {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_UStringIsEmpty(mp_impl,&result));
 	return TBToB(result);
 }
 
 inline const Unicode* UString::GetBuffer() const {
-	const TRN_Unicode* result;
+	const TRN_Unicode* result = 0;
 	REX(TRN_UStringGetBuffer(mp_impl,&result));
 	return (Unicode*)result;
 }
 
 inline int UString::Compare(const UString& str, int max_length) const {
-	int result;
+	int result = 0;
 	REX(TRN_UStringCompare(mp_impl,str.mp_impl,max_length,&result));
 	return result;
 }
@@ -100,7 +126,7 @@ inline UString UString::SubStr(int off, int count) const {
 }
 
 inline Unicode UString::GetAt(int idx) const {
-	TRN_Unicode result;
+	TRN_Unicode result = 0;
 	REX(TRN_UStringGetAt(mp_impl,idx,&result));
 	return (Unicode)result;
 }
@@ -121,19 +147,19 @@ inline void UString::Reserve(int count)
 { REX(TRN_UStringReserve(mp_impl,count));	}
 
 inline const Unicode* UString::CStr() const { 
-	const TRN_Unicode* result;
+	const TRN_Unicode* result = 0;
 	REX(TRN_UStringCStr(mp_impl,&result));
 	return (Unicode*)result;
 }
 
 inline bool UString::IsInAscii() const {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_UStringIsInAscii(mp_impl,&result));
 	return TBToB(result);
 }
 
 inline int UString::ConvertToAscii(char* in_out_buf, int buf_sz, bool null_term) const {
-	int result;
+	int result = 0;
 	REX(TRN_UStringConvertToAscii(mp_impl,in_out_buf,buf_sz,null_term,&result));
 	return result;
 }
@@ -151,7 +177,7 @@ inline std::string UString::ConvertToAscii() const
 }
 
 inline int UString::ConvertToUtf8(char* in_out_buf, int buf_sz, bool null_term) const {
-	int result;
+	int result = 0;
 	REX(TRN_UStringConvertToUtf8(mp_impl,in_out_buf,buf_sz,null_term,&result));
 	return result;
 }
@@ -169,7 +195,7 @@ inline std::string UString::ConvertToUtf8() const {
 
 inline int UString::ConvertToUtf32( UInt32* out_buf, int buf_sz, bool null_term ) const
 {
-	int result;
+	int result = 0;
 	REX(TRN_UStringConvertToUtf32(mp_impl,out_buf,buf_sz,null_term,&result));
 	return result;
 }
@@ -202,7 +228,7 @@ inline std::basic_string<UInt32> UString::ConvertToUtf32() const
 }
 
 inline int UString::ConvertToPDFText(char* in_out_buf, int buf_sz, bool force_unicode) const {
-	int result;
+	int result = 0;
 	REX(TRN_UStringConvertToPDFText(mp_impl,in_out_buf,buf_sz,force_unicode,&result));
 	return result;
 }
@@ -0,0 +1,116 @@
+inline UStringView::UStringView() : m_str(0), m_len(0) {}
+
+inline UStringView::UStringView(const Unicode* str, int length) : m_str(str), m_len(length)
+{
+	if (m_len < 0) {
+		m_len = 0;
+		if (m_str) {
+			while (m_str[m_len]) ++m_len;
+		}
+	}
+}
+
+inline UStringView::UStringView(const UString& str) : m_str(str.GetBuffer()), m_len(str.GetLength()) {}
+
+inline UStringView UStringView::SubStr(int off, int count) const
+{
+	if (off < 0) off = 0;
+	if (off > m_len) off = m_len;
+	if (count < 0 || count > m_len - off) count = m_len - off;
+	return UStringView(m_str + off, count);
+}
+
+inline int UStringView::Compare(const UStringView& str) const
+{
+	int len = m_len < str.m_len ? m_len : str.m_len;
+	for (int i = 0; i < len; ++i) {
+		if (m_str[i] != str.m_str[i]) {
+			return m_str[i] < str.m_str[i] ? -1 : 1;
+		}
+	}
+	return m_len == str.m_len ? 0 : (m_len < str.m_len ? -1 : 1);
+}
+
+inline int UStringView::ConvertToUtf8(char* in_out_buf, int buf_sz, bool null_term) const
+{
+	int avail = in_out_buf ? buf_sz - (null_term ? 1 : 0) : 0;
+	int pos = 0;
+	for (int i = 0; i < m_len; ++i) {
+		UInt32 cp = m_str[i];
+		// combine a valid surrogate pair; lone surrogates become U+FFFD
+		if (cp >= 0xD800 && cp <= 0xDBFF && i + 1 < m_len && m_str[i+1] >= 0xDC00 && m_str[i+1] <= 0xDFFF) {
+			cp = 0x10000 + ((cp - 0xD800) << 10) + (m_str[i+1] - 0xDC00);
+			++i;
+		}
+		else if (cp >= 0xD800 && cp <= 0xDFFF) {
+			cp = 0xFFFD;
+		}
+
+		char seq[4];
+		int n;
+		if (cp < 0x80) {
+			seq[0] = (char)cp;
+			n = 1;
+		}
+		else if (cp < 0x800) {
+			seq[0] = (char)(0xC0 | (cp >> 6));
+			seq[1] = (char)(0x80 | (cp & 0x3F));
+			n = 2;
+		}
+		else if (cp < 0x10000) {
+			seq[0] = (char)(0xE0 | (cp >> 12));
+			seq[1] = (char)(0x80 | ((cp >> 6) & 0x3F));
+			seq[2] = (char)(0x80 | (cp & 0x3F));
+			n = 3;
+		}
+		else {
+			seq[0] = (char)(0xF0 | (cp >> 18));
+			seq[1] = (char)(0x80 | ((cp >> 12) & 0x3F));
+			seq[2] = (char)(0x80 | ((cp >> 6) & 0x3F));
+			seq[3] = (char)(0x80 | (cp & 0x3F));
+			n = 4;
+		}
+
+		if (in_out_buf) {
+			if (pos + n > avail) break;
+			for (int j = 0; j < n; ++j) in_out_buf[pos + j] = seq[j];
+		}
+		pos += n;
+	}
+
+	if (null_term) {
+		if (in_out_buf) {
+			if (buf_sz <= 0) return 0;
+			in_out_buf[pos] = 0;
+		}
+		++pos;
+	}
+	return pos;
+}
+
+inline std::string UStringView::ConvertToUtf8() const
+{
+	std::string result;
+	int sz = ConvertToUtf8(0, 0, false);
+	if (sz > 0) {
+		result.resize(sz);
+		ConvertToUtf8(&result[0], sz, false);
+	}
+	return result;
+}
+
+inline UString UStringView::ToUString() const
+{
+	return m_len ? UString(m_str, m_len) : UString();
+}
+
+inline size_t UStringView::GetHash() const
+{
+	size_t h = sizeof(size_t) > 4 ? (size_t)14695981039346656037ULL : (size_t)2166136261U;
+	const size_t prime = sizeof(size_t) > 4 ? (size_t)1099511628211ULL : (size_t)16777619U;
+	for (int i = 0; i < m_len; ++i) {
+		h ^= (size_t)m_str[i];
+		h *= prime;
+	}
+	return h;
+}
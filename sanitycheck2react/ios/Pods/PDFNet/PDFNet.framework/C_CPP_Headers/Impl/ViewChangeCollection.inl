@@ -2,7 +2,7 @@
 namespace pdftron {
 	namespace PDF {
 
-inline ViewChangeCollection::ViewChangeCollection()
+inline ViewChangeCollection::ViewChangeCollection() : mp_collection(0)
 {
 	REX(TRN_ViewChangeCollectionCreate(&mp_collection));
 }
@@ -18,17 +18,39 @@ inline void ViewChangeCollection::Destroy()
 	mp_collection = 0;
 }
 
-inline ViewChangeCollection::ViewChangeCollection(const ViewChangeCollection& view_change)
+inline ViewChangeCollection::ViewChangeCollection(const ViewChangeCollection& view_change) : mp_collection(0)
 {
+	if (!view_change.mp_collection) return;	// a copy of a moved-from collection is null
 	REX(TRN_ViewChangeCollectionCreate(&mp_collection));
 	REX(TRN_ViewChangeCollectionAssign(mp_collection, view_change.mp_collection));
 }
 
 inline ViewChangeCollection& ViewChangeCollection::operator=(const ViewChangeCollection& view_change) {
+	if (!view_change.mp_collection) {
+		DREX(mp_collection, TRN_ViewChangeCollectionDestroy(mp_collection));
+		return *this;
+	}
+	if (!mp_collection) {
+		// moved-from target
+		REX(TRN_ViewChangeCollectionCreate(&mp_collection));
+	}
 	REX(TRN_ViewChangeCollectionAssign(mp_collection, view_change.mp_collection));
 	return *this;
 }
 
+#ifdef PDFTRON_CPP11
+inline ViewChangeCollection::ViewChangeCollection(ViewChangeCollection&& other) noexcept : mp_collection(other.mp_collection)
+{
+	other.mp_collection = 0;
+}
+
+inline ViewChangeCollection& ViewChangeCollection::operator=(ViewChangeCollection&& other) noexcept
+{
+	std::swap(mp_collection, other.mp_collection);
+	return *this;
+}
+#endif
+
 inline ViewChangeCollection::ViewChangeCollection(TRN_ViewChangeCollection view_change) : mp_collection(view_change){}
 
 //for xamarin use only
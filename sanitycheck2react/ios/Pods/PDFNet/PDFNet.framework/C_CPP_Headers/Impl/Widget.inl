@@ -22,7 +22,7 @@ inline Widget::Widget(SDF::Obj d):Annot(d)
 
 inline Widget Widget::Create(SDF::SDFDoc& doc, const Rect& pos, Field field)
 {
-	TRN_Annot result;
+	TRN_Annot result = 0;
 	REX(TRN_WidgetAnnotCreate(doc.mp_doc,(const TRN_Rect*)&pos, (TRN_Field*)&field, &result));
 	return Widget(result);
 }
@@ -30,7 +30,7 @@ inline Widget Widget::Create(SDF::SDFDoc& doc, const Rect& pos, Field field)
 
 inline Field Widget::GetField() const
 {
-	TRN_Field result;
+	TRN_Field result = TRN_Field();
 	REX(TRN_WidgetAnnotGetField(mp_annot,&result));
 	return *((Field*)&result);
 }
@@ -52,7 +52,7 @@ inline void Widget::SetHighlightingMode(HighlightingMode mode)
 //A
 inline Action Widget::GetAction() const
 {
-	TRN_Action result;
+	TRN_Action result = 0;
 	REX(TRN_WidgetAnnotGetAction(mp_annot,&result));
 	return Action(result);
 }
@@ -65,7 +65,7 @@ inline void Widget::SetAction(const Action& action)
 //BC
 inline int Widget::GetBorderColorCompNum() const
 {
-	int result;
+	int result = 0;
 	REX(TRN_WidgetAnnotGetBorderColorCompNum(mp_annot, &result));
 	return result;
 }
@@ -83,7 +83,7 @@ inline void Widget::SetBorderColor(const ColorPt& c, int CompNum)
 //BG
 inline int Widget::GetBackgroundColorCompNum() const
 {
-	int result;
+	int result = 0;
 	REX(TRN_WidgetAnnotGetBackgroundColorCompNum(mp_annot, &result));
 	return result;
 }
@@ -101,7 +101,7 @@ inline void Widget::SetBackgroundColor(const ColorPt& c, int CompNum)
 //CA 
 inline UString Widget::GetStaticCaptionText() const
 {
-	TRN_UString result;
+	TRN_UString result = 0;
 	REX(TRN_WidgetAnnotGetStaticCaptionText(mp_annot,&result));
 	return UString(result);	
 }
@@ -114,7 +114,7 @@ inline void Widget::SetStaticCaptionText(const UString& ct)
 //RC
 inline UString Widget::GetRolloverCaptionText() const
 {
-	TRN_UString result;
+	TRN_UString result = 0;
 	REX(TRN_WidgetAnnotGetRolloverCaptionText(mp_annot,&result));
 	return UString(result);
 }
@@ -126,7 +126,7 @@ inline void Widget::SetRolloverCaptionText(const UString& ct)
 //AC
 inline UString Widget::GetMouseDownCaptionText() const
 {
-	TRN_UString result;
+	TRN_UString result = 0;
 	REX(TRN_WidgetAnnotGetMouseDownCaptionText(mp_annot,&result));
 	return UString(result);
 }
@@ -139,7 +139,7 @@ inline void Widget::SetMouseDownCaptionText(const UString& ct)
 //I
 inline SDF::Obj Widget::GetStaticIcon() const
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_WidgetAnnotGetStaticIcon(mp_annot, &result));
 	return SDF::Obj(result);
 }
@@ -152,7 +152,7 @@ inline void Widget::SetStaticIcon(SDF::Obj ic)
 //RI
 inline SDF::Obj Widget::GetRolloverIcon() const
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_WidgetAnnotGetRolloverIcon(mp_annot, &result));
 	return SDF::Obj(result);
 }
@@ -165,7 +165,7 @@ inline void Widget::SetRolloverIcon(SDF::Obj ic)
 //IX
 inline SDF::Obj Widget::GetMouseDownIcon() const
 {
-	TRN_Obj result;
+	TRN_Obj result = 0;
 	REX(TRN_WidgetAnnotGetMouseDownIcon(mp_annot, &result));
 	return SDF::Obj(result);
 }
@@ -217,7 +217,7 @@ inline void Widget::SetScaleCondition(ScaleCondition sd)
 //LO
 inline double Widget::GetHIconLeftOver() const
 {
-	double result;
+	double result = 0;
 	REX(TRN_WidgetAnnotGetHIconLeftOver(mp_annot,&result));
 	return result;
 }
@@ -227,7 +227,7 @@ inline void Widget::SetHIconLeftOver(double hl)
 }
 inline double Widget::GetVIconLeftOver() const
 {
-	double result;
+	double result = 0;
 	REX(TRN_WidgetAnnotGetVIconLeftOver(mp_annot,&result));
 	return result;
 }
@@ -241,7 +241,7 @@ inline void Widget::SetVIconLeftOver(double vl)
 //FB
 inline bool Widget::GetFitFull() const
 {
-	TRN_Bool result;
+	TRN_Bool result = 0;
 	REX(TRN_WidgetAnnotGetFitFull(mp_annot,&result));
 	return TBToB(result);
 }
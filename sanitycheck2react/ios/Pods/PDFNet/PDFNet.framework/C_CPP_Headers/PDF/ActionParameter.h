@@ -24,6 +24,10 @@ public:
 	ActionParameter(const Action& action);
 	ActionParameter(const ActionParameter& action_param);
 	ActionParameter& operator=(const ActionParameter& action_param);
+#ifdef PDFTRON_CPP11
+	ActionParameter(ActionParameter&& other) noexcept;
+	ActionParameter& operator=(ActionParameter&& other) noexcept;
+#endif
 	~ActionParameter();
 	Action GetAction();
 	void Destroy();
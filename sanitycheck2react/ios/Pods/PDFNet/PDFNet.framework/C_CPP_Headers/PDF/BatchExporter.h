@@ -0,0 +1,205 @@
+//---------------------------------------------------------------------------------------
+// Copyright (c) 2001-2019 by PDFTron Systems Inc. All Rights Reserved.
+// Consult legal.txt regarding legal and license information.
+//---------------------------------------------------------------------------------------
+#ifndef PDFTRON_H_CPPPDFBatchExporter
+#define PDFTRON_H_CPPPDFBatchExporter
+
+#include <PDF/PDFDraw.h>
+#include <PDF/PDFDoc.h>
+#include <PDF/DocLock.h>
+#include <PDF/PageIndex.h>
+#include <PDF/Image.h>
+#include <Filters/CustomFilter.h>
+#include <Filters/FilterWriter.h>
+#include <SDF/ObjSet.h>
+#include <Common/WorkStealingScheduler.h>
+
+#ifdef PDFTRON_CPP11
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <stdio.h>
+#include <string.h>
+
+namespace pdftron {
+	namespace PDF {
+
+/**
+ * BatchExporter converts many pages of a document to PNG or JPEG images.
+ *
+ * Unlike calling PDFDraw::Export() in a loop, rasterization and image
+ * encoding run in a pipeline: a pool of render threads (each with its own
+ * PDFDraw) rasterizes the pages while a separate pool of encoder threads
+ * compresses the finished bitmaps and writes them to the output. The two
+ * stages are connected by a bounded queue, so the number of rendered pages
+ * waiting for the encoder, and therefore the memory use, stays constant.
+ *
+ * A sample use case:
+ *
+ * @code
+ * BatchExporter exporter(4, 2);
+ * exporter.SetDrawConfig([](PDFDraw& draw) { draw.SetDPI(72); });
+ * std::vector<int> pages;
+ * for (int i = 1; i <= doc.GetPageCount(); ++i) pages.push_back(i);
+ * BatchExporter::Stats stats = exporter.Export(doc, pages, "thumbs/page_%04d.png");
+ * printf("%.1f pages/s\n", stats.pages_per_second);
+ * @endcode
+ *
+ * @note The pages are given as a list of page numbers rather than a PageSet,
+ * because the content of a PageSet cannot be enumerated.
+ * @note The encoder supports 8 bit RGB output. Use PDFDraw::Export() for
+ * other formats and encoder parameters (e.g. TIFF, PNG8 or BPC).
+ * @note This class requires C++11 (PDFTRON_CPP11).
+ */
+class BatchExporter
+{
+public:
+	enum Format
+	{
+		e_png,
+		e_jpeg
+	};
+
+	/**
+	 * Callback used to configure every render thread's PDFDraw (e.g. to call
+	 * SetDPI() or SetImageSize()).
+	 */
+	typedef std::function<void (PDFDraw& draw)> ConfigProc;
+
+	/**
+	 * Callback returning the output stream for a page. It is invoked on an
+	 * encoder thread once the page has been rendered. Returning an empty
+	 * Filter stops the export with an error.
+	 *
+	 * @param page_idx the index of the page in the list passed to Export().
+	 * @param page_num the page number.
+	 */
+	typedef std::function<Filters::Filter (int page_idx, int page_num)> StreamProc;
+
+	/**
+	 * Throughput statistics, as returned by Export().
+	 */
+	struct Stats
+	{
+		int pages;               ///< The number of exported pages.
+		double elapsed_ms;       ///< The wall clock duration of the export, in milliseconds.
+		double render_ms;        ///< The total time spent rasterizing, summed over all render threads.
+		double encode_ms;        ///< The total time spent encoding and writing, summed over all encoder threads.
+		double pages_per_second; ///< The number of exported pages per second.
+	};
+
+	/**
+	 * @param render_threads the number of render threads. 0 means one thread
+	 * per hardware thread.
+	 * @param encode_threads the number of encoder threads. 0 means one
+	 * encoder thread for every two render threads.
+	 */
+	explicit BatchExporter(int render_threads = 0, int encode_threads = 0);
+
+	/**
+	 * @return the number of render threads.
+	 */
+	int GetRenderThreadCount() const;
+
+	/**
+	 * @return the number of encoder threads.
+	 */
+	int GetEncodeThreadCount() const;
+
+	/**
+	 * Sets the function used to configure the PDFDraw of each render thread.
+	 * The function is applied when the PDFDraw objects are created, at the
+	 * beginning of every Export() call.
+	 */
+	void SetDrawConfig(const ConfigProc& proc);
+
+	/**
+	 * Sets the JPEG compression quality, on the 0..100 scale. The default is 80.
+	 */
+	void SetJPEGQuality(int quality);
+
+	/**
+	 * Exports the given pages to files.
+	 *
+	 * @param doc the source document. A read lock (PDFDoc::LockRead()) is
+	 * held while a page is being rasterized. It is not held during encoding.
+	 * @param page_nums the numbers of the pages to export.
+	 * @param filename_pattern the output file name. The first "%d" (or a
+	 * zero padded variant such as "%04d") is replaced by the page number,
+	 * and "%%" by a single '%'.
+	 * @param format the output image format.
+	 * @return the throughput statistics.
+	 *
+	 * @exception if a page can not be rendered, encoded or written, the
+	 * export is stopped and the first error is rethrown.
+	 */
+	Stats Export(PDFDoc& doc, const std::vector<int>& page_nums, const std::string& filename_pattern, Format format = e_png);
+
+	/**
+	 * Exports the given pages to the streams returned by 'streams'.
+	 * @see Export(PDFDoc&, const std::vector<int>&, const std::string&, Format)
+	 */
+	Stats Export(PDFDoc& doc, const std::vector<int>& page_nums, const StreamProc& streams, Format format = e_png);
+
+	/**
+	 * @return 'pattern' with the first "%d" (or "%0Nd") replaced by 'page_num'.
+	 */
+	static std::string FormatFileName(const std::string& pattern, int page_num);
+
+private:
+	struct Job
+	{
+		int page_idx;
+		int page_num;
+		BitmapInfo bmp;
+	};
+
+	// A bounded blocking queue between the render and the encoder threads.
+	class JobQueue
+	{
+	public:
+		explicit JobQueue(size_t capacity) : m_capacity(capacity), m_closed(false), m_aborted(false) {}
+		bool Push(Job& job);
+		bool Pop(Job& job);
+		void Close(bool abort);
+	private:
+		std::mutex m_mutex;
+		std::condition_variable m_not_empty;
+		std::condition_variable m_not_full;
+		std::deque<Job> m_jobs;
+		size_t m_capacity;
+		bool m_closed;
+		bool m_aborted;
+	};
+
+	void Encode(Job& job, const StreamProc& streams, Format format) const;
+
+	static size_t FileWrite(const void* buf, size_t size, size_t count, void* user_data);
+	static size_t FileTell(void* user_data);
+	static int FileSeek(void* user_data, long offset, int origin);
+	static int FileFlush(void* user_data);
+	static void FileClose(void* user_data);
+
+	Common::WorkStealingScheduler m_scheduler;
+	int m_encode_threads;
+	int m_jpeg_quality;
+	ConfigProc m_config;
+};
+
+#include <Impl/BatchExporter.inl>
+
+	};	// namespace PDF
+};	// namespace pdftron
+
+#endif // PDFTRON_CPP11
+
+#endif // PDFTRON_H_CPPPDFBatchExporter
@@ -40,6 +40,14 @@ namespace pdftron {
  */
 typedef Common::Iterator<TRN_CharData> CharIterator;
 
+#ifdef PDFTRON_CPP11
+/**
+ * CharRange is an STL input range over the characters of a text element.
+ * For more information, please see Element::Chars().
+ */
+typedef Common::IteratorRange<CharIterator> CharRange;
+#endif
+
 	};	// namespace PDF
 };	// namespace pdftron
 
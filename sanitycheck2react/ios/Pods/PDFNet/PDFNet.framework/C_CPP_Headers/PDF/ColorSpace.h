@@ -36,6 +36,10 @@ public:
 	~ColorPt();
 
 	ColorPt& operator= (const ColorPt& co);
+#ifdef PDFTRON_CPP11
+	ColorPt(ColorPt&& other) noexcept;
+	ColorPt& operator=(ColorPt&& other) noexcept;
+#endif
 	bool operator== (const ColorPt& co) const;
 
 	/**
@@ -172,6 +176,10 @@ public:
 	 ColorSpace (SDF::Obj color_space = 0);
 	 ColorSpace(const ColorSpace& c);
 	 ColorSpace& operator=(const ColorSpace& c);
+#ifdef PDFTRON_CPP11
+	 ColorSpace(ColorSpace&& other) noexcept;
+	 ColorSpace& operator=(ColorSpace&& other) noexcept;
+#endif
 
 	/** 
 	 * Destructor
@@ -0,0 +1,361 @@
+//---------------------------------------------------------------------------------------
+// Copyright (c) 2001-2019 by PDFTron Systems Inc. All Rights Reserved.
+// Consult legal.txt regarding legal and license information.
+//---------------------------------------------------------------------------------------
+#ifndef PDFTRON_H_CPPPDFContentWalker
+#define PDFTRON_H_CPPPDFContentWalker
+
+#include <PDF/ElementReader.h>
+#include <PDF/PDFDoc.h>
+#include <PDF/DocLock.h>
+#include <PDF/PageIndex.h>
+#include <PDF/ColorSpace.h>
+#include <PDF/Font.h>
+#include <Common/WorkStealingScheduler.h>
+
+#ifdef PDFTRON_CPP11
+#include <chrono>
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <vector>
+
+namespace pdftron {
+	namespace PDF {
+
+/**
+ * ContentWalker reads the content of many pages concurrently, for audits
+ * that look at every element of a document (the fonts, images or color
+ * spaces that are used, ...).
+ *
+ * Each worker thread owns an ElementReader and holds a read lock on the
+ * document while it reads a page. The content of Form XObjects is read as
+ * part of the page that uses it. The walker keeps track of the open forms on
+ * an explicit stack, so deeply nested forms do not recurse, and a form that
+ * (directly or indirectly) uses itself is skipped instead of being read
+ * until the stack overflows.
+ *
+ * Instead of an Element, which is only valid until the reader moves on, the
+ * walker records a small Item for every element, and passes the items to a
+ * callback in batches. Items are plain values, so recording them does not
+ * call into PDFNet beyond reading the requested fields.
+ *
+ * Forms that are used on many pages (a letterhead, a watermark, ...) can be
+ * read once and replayed from a FormCache, see SetFormCache().
+ *
+ * A sample use case, collecting the fonts used by a document:
+ * @code
+ * ContentWalker walker;
+ * walker.SetElementTypes(ContentWalker::TypeMask(Element::e_text));
+ * std::mutex mutex;
+ * std::set<UInt32> fonts;
+ * walker.Walk(doc, page_nums, [&](const std::vector<ContentWalker::Item>& items, int) {
+ *     std::lock_guard<std::mutex> lock(mutex);
+ *     for (size_t i = 0; i < items.size(); ++i) fonts.insert(items[i].obj.GetObjNum());
+ * });
+ * @endcode
+ *
+ * @note The pages are given as a list of page numbers, as in
+ * ParallelTextExtractor.
+ * @note This class requires C++11 (PDFTRON_CPP11).
+ */
+class ContentWalker
+{
+public:
+	/**
+	 * Selects the optional fields of Item that are filled in. Each of them
+	 * costs additional calls per element.
+	 */
+	enum ItemFlags
+	{
+		e_default = 0x00,
+		e_ctm     = 0x01,	// Item::ctm
+		e_bbox    = 0x02,	// Item::bbox
+		e_colors  = 0x04	// Item::fill_space and Item::stroke_space
+	};
+
+	/**
+	 * The information recorded for one element.
+	 */
+	struct Item
+	{
+		Element::Type type;              ///< The element type.
+		int page_idx;                    ///< The index of the page in the list passed to Walk().
+		int depth;                       ///< The Form XObject nesting depth. 0 for the page content.
+		UInt32 form_num;                 ///< The object number of the enclosing form, 0 for the page content.
+		SDF::Obj obj;                    ///< The XObject of e_image and e_form, the font of e_text, otherwise null.
+		double font_size;                ///< The font size of e_text, otherwise 0.
+		ColorSpace::Type fill_space;     ///< The fill color space of filled e_path and e_text (e_colors).
+		ColorSpace::Type stroke_space;   ///< The stroke color space of stroked e_path (e_colors).
+		double ctm[6];                   ///< The current transformation matrix a, b, c, d, h, v (e_ctm).
+		double bbox[4];                  ///< The bounding box x1, y1, x2, y2 in page coordinates, or zeros (e_bbox).
+	};
+
+	/**
+	 * Statistics of a Walk() call.
+	 */
+	struct Stats
+	{
+		int pages;              ///< The number of pages read.
+		UInt64 elements;        ///< The number of elements read.
+		UInt64 items;           ///< The number of items passed to the callback.
+		UInt64 forms;           ///< The number of form XObjects read (a form used twice is counted twice).
+		UInt64 forms_skipped;   ///< The number of forms not read because of the depth limit or a cycle.
+		UInt64 forms_cached;    ///< The number of forms whose items were replayed from the FormCache.
+		int max_depth;          ///< The deepest form nesting reached.
+		double elapsed_ms;      ///< The wall-clock time of the Walk() call.
+	};
+
+	/**
+	 * Callback invoked with a batch of items.
+	 *
+	 * @param items the items, in content order. A batch holds the items of a
+	 * single page, and the batches of a page are passed in order.
+	 * @param worker the index of the calling worker, in [0, GetThreadCount()).
+	 *
+	 * @note The callback is invoked concurrently from several worker
+	 * threads. The document read lock is held during the call.
+	 */
+	typedef std::function<void (const std::vector<Item>& items, int worker)> BatchProc;
+
+	/**
+	 * FormCache keeps the items of Form XObjects that were read by a
+	 * ContentWalker, so that a form used again is replayed from the cache
+	 * instead of being read with ElementReader::FormBegin(). The cache is
+	 * thread-safe, and can be shared by several walkers and Walk() calls.
+	 *
+	 * Entries are keyed by the document, the object and generation number of
+	 * the form, and the element types and item flags of the walker. The cache
+	 * is bounded by the total number of items, and evicts the least recently
+	 * used forms first.
+	 *
+	 * A cached form is replayed with the CTM of the new use (e_ctm). All other
+	 * values are those of the first use, so a form that depends on the
+	 * graphics state inherited from the page (e.g. a text font that is
+	 * not set in the form itself) is replayed with the font of its first use.
+	 * Forms are not cached if the walker records bounding boxes or color
+	 * spaces (e_bbox, e_colors), if they contain a form that was skipped,
+	 * or if they are drawn with a singular matrix.
+	 *
+	 * @note The cache does not observe changes to the document. Use Remove()
+	 * when a document is modified or closed.
+	 */
+	class FormCache
+	{
+	public:
+		/**
+		 * Cache statistics, as returned by GetStats().
+		 */
+		struct Stats
+		{
+			UInt64 hits;        ///< Forms replayed from the cache.
+			UInt64 misses;      ///< Lookups of forms that were not in the cache.
+			UInt64 evictions;   ///< Entries dropped to stay within the limit.
+			size_t entries;     ///< Current number of cached forms.
+			size_t items;       ///< Current number of cached items.
+			double hit_rate;    ///< hits / (hits + misses), or 0 before the first lookup.
+		};
+
+		/**
+		 * @param max_items the maximum total number of items of the cached
+		 * forms.
+		 */
+		explicit FormCache(size_t max_items = 1 << 20);
+
+		/**
+		 * Removes all entries of the given document.
+		 */
+		void Remove(const PDFDoc& doc);
+
+		/**
+		 * Removes all entries. The hit/miss counters are not reset.
+		 */
+		void Clear();
+
+		/**
+		 * @return the cache statistics.
+		 */
+		Stats GetStats() const;
+
+	private:
+		friend class ContentWalker;
+
+		struct Key
+		{
+			const PDFDoc* doc;
+			UInt32 obj_num;
+			UInt32 gen_num;
+			UInt32 type_mask;
+			UInt32 flags;
+
+			bool operator<(const Key& rhs) const
+			{
+				return std::tie(doc, obj_num, gen_num, type_mask, flags)
+					< std::tie(rhs.doc, rhs.obj_num, rhs.gen_num, rhs.type_mask, rhs.flags);
+			}
+		};
+
+		// The recorded items of a form, relative to the form: the depth of
+		// the items in the form itself is 0, and the CTM is relative to the
+		// CTM of the form element.
+		struct Content
+		{
+			std::vector<Item> items;
+			UInt64 elements;
+			UInt64 forms;
+			int depth;
+		};
+
+		struct Entry
+		{
+			Key key;
+			std::shared_ptr<const Content> content;
+		};
+
+		typedef std::list<Entry> EntryList;
+
+		std::shared_ptr<const Content> Find(const Key& key, int max_depth);
+		void Insert(const Key& key, const std::shared_ptr<const Content>& content);
+
+		FormCache(const FormCache&);
+		FormCache& operator=(const FormCache&);
+
+		mutable std::mutex m_mutex;
+		size_t m_max_items;
+		size_t m_items;
+		EntryList m_entries;
+		std::map<Key, EntryList::iterator> m_index;
+		UInt64 m_hits;
+		UInt64 m_misses;
+		UInt64 m_evictions;
+	};
+
+	/**
+	 * @param num_threads the number of worker threads. 0 means one thread
+	 * per hardware thread.
+	 */
+	explicit ContentWalker(int num_threads = 0);
+
+	/**
+	 * @return the number of worker threads.
+	 */
+	int GetThreadCount() const;
+
+	/**
+	 * @return the bit of an element type in the mask passed to
+	 * SetElementTypes().
+	 */
+	static UInt32 TypeMask(Element::Type type) { return 1u << type; }
+
+	/**
+	 * Selects the element types that are recorded. Elements of other types
+	 * are still read (e.g. to enter forms), but not passed to the callback.
+	 *
+	 * @param type_mask a combination of TypeMask() values. The default
+	 * records all types.
+	 */
+	void SetElementTypes(UInt32 type_mask);
+
+	/**
+	 * @param flags a combination of ItemFlags. The default is e_default.
+	 */
+	void SetItemFlags(UInt32 flags);
+
+	/**
+	 * Sets the maximum Form XObject nesting depth. Forms nested deeper are
+	 * recorded as e_form items, but their content is not read.
+	 *
+	 * @param max_depth the maximum depth. 0 does not read the content of
+	 * forms at all. The default is 32.
+	 */
+	void SetMaxFormDepth(int max_depth);
+
+	/**
+	 * Sets the number of items passed to each callback. The default is 256.
+	 */
+	void SetBatchSize(int batch_size);
+
+	/**
+	 * Sets the cache used to replay forms that were read before.
+	 *
+	 * @param cache the cache, or NULL to read every form (the default). The
+	 * cache must outlive the Walk() calls that use it.
+	 */
+	void SetFormCache(FormCache* cache);
+
+	/**
+	 * Reads the given pages concurrently and passes their items to 'proc'.
+	 *
+	 * @param doc the document.
+	 * @param page_nums the numbers of the pages to read.
+	 * @param proc the callback invoked for every batch of items.
+	 * @return the statistics of the walk.
+	 */
+	Stats Walk(PDFDoc& doc, const std::vector<int>& page_nums, const BatchProc& proc);
+
+private:
+	typedef std::chrono::steady_clock Clock;
+
+	// A form XObject that is being read.
+	struct Frame
+	{
+		UInt32 obj_num;
+		UInt32 gen_num;
+	};
+
+	// A form whose items are being recorded for the FormCache.
+	struct Recording
+	{
+		int frame;              // the index of the form in the stack, -1 if not recording
+		FormCache::Key key;
+		double inv_ctm[6];      // the inverse CTM of the form element
+		UInt64 elements;        // the worker statistics when the form was entered
+		UInt64 forms;
+		UInt64 forms_skipped;
+		int depth;
+		std::vector<Item> items;
+	};
+
+	// The state of one worker.
+	struct Worker
+	{
+		Worker() : doc(0), stats() { recording.frame = -1; }
+
+		std::unique_ptr<ElementReader> reader;
+		std::vector<Frame> stack;
+		std::vector<Item> batch;
+		Recording recording;
+		const PDFDoc* doc;
+		Stats stats;
+	};
+
+	void WalkPage(Page page, int page_idx, Worker& worker, int worker_idx, const BatchProc& proc) const;
+	bool CanEnter(Element& element, const std::vector<Frame>& stack, Frame& out_frame) const;
+	void Record(Element& element, int page_idx, const std::vector<Frame>& stack, Item& item) const;
+	bool Replay(Element& element, int page_idx, const Frame& frame, Worker& worker, int worker_idx, const BatchProc& proc) const;
+	void Emit(const Item& item, Worker& worker, int worker_idx, const BatchProc& proc) const;
+	void EndRecording(Worker& worker) const;
+	void Flush(Worker& worker, int worker_idx, const BatchProc& proc) const;
+	static void GetCTM(Element& element, double out_ctm[6]);
+	static void Multiply(const double m1[6], const double m2[6], double out[6]);
+	static bool Invert(const double m[6], double out[6]);
+
+	Common::WorkStealingScheduler m_scheduler;
+	UInt32 m_type_mask;
+	UInt32 m_flags;
+	int m_max_depth;
+	int m_batch_size;
+	FormCache* m_form_cache;
+};
+
+#include <Impl/ContentWalker.inl>
+
+	};	// namespace PDF
+};	// namespace pdftron
+
+#endif // PDFTRON_CPP11
+
+#endif // PDFTRON_H_CPPPDFContentWalker
@@ -31,6 +31,10 @@ public:
     ~ConversionMonitor();
     ConversionMonitor(const ConversionMonitor& copy);
 	ConversionMonitor& operator=(const ConversionMonitor& other);
+#ifdef PDFTRON_CPP11
+    ConversionMonitor(ConversionMonitor&& other) noexcept;
+    ConversionMonitor& operator=(ConversionMonitor&& other) noexcept;
+#endif
 
 	 /** 
 	  * @return true if the object is not null, false otherwise.  
@@ -29,6 +29,10 @@ public:
 	CubicCurveBuilder(const CubicCurveBuilder& other);
 	CubicCurveBuilder(TRN_CubicCurveBuilder impl);
 	CubicCurveBuilder& operator= (const CubicCurveBuilder& other);
+#ifdef PDFTRON_CPP11
+	CubicCurveBuilder(CubicCurveBuilder&& other) noexcept;
+	CubicCurveBuilder& operator=(CubicCurveBuilder&& other) noexcept;
+#endif
 	~CubicCurveBuilder();
 	
 	void Destroy();
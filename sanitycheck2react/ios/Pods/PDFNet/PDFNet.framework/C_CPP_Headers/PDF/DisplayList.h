@@ -0,0 +1,264 @@
+//---------------------------------------------------------------------------------------
+// Copyright (c) 2001-2019 by PDFTron Systems Inc. All Rights Reserved.
+// Consult legal.txt regarding legal and license information.
+//---------------------------------------------------------------------------------------
+#ifndef PDFTRON_H_CPPPDFDisplayList
+#define PDFTRON_H_CPPPDFDisplayList
+
+#include <PDF/ElementReader.h>
+#include <PDF/Element.h>
+#include <PDF/PathData.h>
+#include <PDF/GState.h>
+#include <PDF/ColorSpace.h>
+#include <PDF/Font.h>
+#include <Common/ByteView.h>
+#include <map>
+#include <string>
+#include <vector>
+#include <stdio.h>
+#include <string.h>
+
+namespace pdftron {
+	namespace PDF {
+
+/**
+ * DisplayList is a compact, serializable copy of the parsed content of a
+ * page. It is built once with an ElementReader, and can then be visited
+ * any number of times, saved to a file or a buffer, and loaded again
+ * without reading the content stream.
+ *
+ * The list is stored in a few flat arrays:
+ *  - one fixed-size Record per element, in content order;
+ *  - a table of the distinct graphics states used by the elements. The
+ *    state is updated from ElementReader::GetChangeMask(), so only the
+ *    attributes that changed are read, and identical states are stored once;
+ *  - pools with the path operators and points, the text matrices, and the
+ *    raw text bytes.
+ *
+ * A sample use case:
+ * @code
+ * DisplayList list;
+ * if (!list.Load(cache_path) || list.GetSourceId() != fingerprint) {
+ *     list.Build(page);
+ *     list.SetSourceId(fingerprint);
+ *     list.Save(cache_path);
+ * }
+ * MyVisitor visitor;      // derived from DisplayList::Visitor
+ * list.Replay(visitor);
+ * @endcode
+ *
+ * @note Form XObjects are flattened into the list: the elements of a form
+ * follow its e_form record, with a greater depth. Inline image data and
+ * shading dictionaries are not stored; images and forms are stored by
+ * object number.
+ */
+class DisplayList
+{
+public:
+	/**
+	 * Flags of a Record.
+	 */
+	enum RecordFlags
+	{
+		e_stroked      = 0x01,	// a stroked path
+		e_filled       = 0x02,	// a filled path
+		e_clip         = 0x04,	// a clipping path
+		e_winding_fill = 0x08	// a path filled with the non-zero winding rule
+	};
+
+	/**
+	 * One element of the page.
+	 */
+	struct Record
+	{
+		UInt8 type;           ///< The Element::Type.
+		UInt8 flags;          ///< A combination of RecordFlags.
+		UInt16 depth;         ///< The Form XObject nesting depth. 0 for the page content.
+		UInt32 gstate;        ///< The index of the graphics state, see GetGState().
+		UInt32 obj_num;       ///< The object number of the XObject of e_image and e_form, otherwise 0.
+		UInt32 data_offset;   ///< e_path: the first operator; e_text: the first text byte.
+		UInt32 data_size;     ///< e_path: the number of operators; e_text: the number of text bytes.
+		UInt32 point_offset;  ///< e_path: the first point value; e_text: the text matrix.
+		UInt32 point_count;   ///< e_path: the number of point values; e_text: 6.
+	};
+
+	/**
+	 * The graphics state of an element.
+	 */
+	struct GStateRecord
+	{
+		double ctm[6];              ///< The current transformation matrix a, b, c, d, h, v.
+		double fill_color[4];       ///< The first four components of the fill color.
+		double stroke_color[4];     ///< The first four components of the stroke color.
+		double line_width;
+		double font_size;
+		double fill_opacity;
+		double stroke_opacity;
+		UInt32 font;                ///< The object number of the font, or 0.
+		UInt8 fill_space;           ///< The ColorSpace::Type of the fill color space.
+		UInt8 stroke_space;         ///< The ColorSpace::Type of the stroke color space.
+		UInt8 text_render_mode;     ///< The GState::TextRenderingMode.
+		UInt8 reserved;
+	};
+
+	/**
+	 * Receives the elements of a display list from Replay(). The default
+	 * implementations do nothing.
+	 */
+	class Visitor
+	{
+	public:
+		virtual ~Visitor() {}
+
+		virtual void VisitPath(const Record& /*rec*/, const GStateRecord& /*gs*/, PathDataView /*path*/) {}
+		virtual void VisitText(const Record& /*rec*/, const GStateRecord& /*gs*/, ByteView /*text*/, const double /*text_matrix*/[6]) {}
+		virtual void VisitXObject(const Record& /*rec*/, const GStateRecord& /*gs*/) {}
+		virtual void VisitOther(const Record& /*rec*/, const GStateRecord& /*gs*/) {}
+	};
+
+	/**
+	 * Creates an empty display list.
+	 */
+	DisplayList();
+
+	/**
+	 * Replaces the content of the list with the content of a page.
+	 *
+	 * @param page the page.
+	 * @param max_form_depth the maximum Form XObject nesting depth. Forms
+	 * nested deeper, and forms that use themselves, are stored as an e_form
+	 * record without content.
+	 */
+	void Build(const Page& page, int max_form_depth = 32);
+
+	/**
+	 * Same as Build(const Page&, int), but uses the given reader instead of
+	 * creating one.
+	 */
+	void Build(ElementReader& reader, const Page& page, int max_form_depth = 32);
+
+	/**
+	 * Removes all records.
+	 */
+	void Clear();
+
+	/**
+	 * @return the number of records.
+	 */
+	size_t GetRecordCount() const;
+
+	/**
+	 * @return the record at the given index, in [0, GetRecordCount()).
+	 */
+	const Record& GetRecord(size_t idx) const;
+
+	/**
+	 * @return the number of distinct graphics states.
+	 */
+	size_t GetGStateCount() const;
+
+	/**
+	 * @return the graphics state at the given index (Record::gstate).
+	 */
+	const GStateRecord& GetGState(size_t idx) const;
+
+#ifndef SWIG
+	/**
+	 * @return the path of an e_path record. The view is valid until the list
+	 * is modified or destroyed.
+	 */
+	PathDataView GetPathData(const Record& rec) const;
+
+	/**
+	 * @return the raw text bytes of an e_text record (see
+	 * Element::GetTextData()). The view is valid until the list is modified
+	 * or destroyed.
+	 */
+	ByteView GetTextData(const Record& rec) const;
+
+	/**
+	 * @return the text matrix a, b, c, d, h, v of an e_text record.
+	 */
+	const double* GetTextMatrix(const Record& rec) const;
+#endif
+
+	/**
+	 * Passes all records, in content order, to the visitor.
+	 */
+	void Replay(Visitor& visitor) const;
+
+	/**
+	 * Sets a string that identifies the source of the list (e.g. a
+	 * fingerprint of the document and the page). It is saved with the list,
+	 * so that a list loaded from a file can be checked against the document.
+	 */
+	void SetSourceId(const std::string& source_id);
+
+	/**
+	 * @return the string set with SetSourceId().
+	 */
+	const std::string& GetSourceId() const;
+
+	/**
+	 * @return the approximate memory used by the list, in bytes. It is also
+	 * the approximate size of the serialized list.
+	 */
+	size_t GetMemorySize() const;
+
+	/**
+	 * Appends the serialized list to a buffer.
+	 */
+	void Serialize(std::vector<unsigned char>& out) const;
+
+	/**
+	 * Replaces the content of the list with a serialized list.
+	 *
+	 * @return false if the data is not a valid serialized list, or was
+	 * written on a machine with a different byte order. The list is empty
+	 * in that case.
+	 */
+	bool Deserialize(const UChar* data, size_t size);
+
+	/**
+	 * Saves the serialized list to a file.
+	 * @return false if the file could not be written.
+	 */
+	bool Save(const std::string& path) const;
+
+	/**
+	 * Loads a list saved with Save().
+	 * @return false if the file could not be read or is not valid.
+	 */
+	bool Load(const std::string& path);
+
+private:
+	enum { k_magic = 0x534C4450, k_version = 1, k_byte_order = 0x01020304 };
+
+	typedef std::map<std::string, UInt32> GStateIndex;
+
+	void Add(Element& element, int depth, UInt32 gstate);
+	static bool CanEnter(Element& element, const std::vector<UInt32>& stack, int max_form_depth);
+	static void ReadGState(Element& element, UInt64 changes, GStateRecord& gs);
+	static void ReadColor(ColorPt color, int num, double out[4]);
+	UInt32 Intern(const GStateRecord& gs, GStateIndex& index);
+	bool IsValid() const;
+
+	template <class T>
+	static void Write(const std::vector<T>& data, std::vector<unsigned char>& out);
+	template <class T>
+	static bool Read(const UChar*& data, const UChar* end, std::vector<T>& out);
+
+	std::vector<Record> m_records;
+	std::vector<GStateRecord> m_gstates;
+	std::vector<UChar> m_ops;
+	std::vector<double> m_points;
+	std::vector<UChar> m_text;
+	std::string m_source_id;
+};
+
+#include <Impl/DisplayList.inl>
+
+	};	// namespace PDF
+};	// namespace pdftron
+
+#endif // PDFTRON_H_CPPPDFDisplayList
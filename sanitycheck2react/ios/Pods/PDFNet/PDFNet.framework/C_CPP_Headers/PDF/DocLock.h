@@ -0,0 +1,296 @@
+//---------------------------------------------------------------------------------------
+// Copyright (c) 2001-2019 by PDFTron Systems Inc. All Rights Reserved.
+// Consult legal.txt regarding legal and license information.
+//---------------------------------------------------------------------------------------
+#ifndef PDFTRON_H_CPPPDFDocLock
+#define PDFTRON_H_CPPPDFDocLock
+
+#include <PDF/PDFDoc.h>
+
+#ifdef PDFTRON_CPP11
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include <stdio.h>
+
+#define PDFTRON_LOCK_SITE_STR2(x) #x
+#define PDFTRON_LOCK_SITE_STR(x) PDFTRON_LOCK_SITE_STR2(x)
+
+/**
+ * Expands to a "file:line" string identifying the current source location,
+ * for use as the call site of a DocReadGuard or DocWriteGuard.
+ */
+#define PDFTRON_LOCK_SITE __FILE__ ":" PDFTRON_LOCK_SITE_STR(__LINE__)
+
+namespace pdftron {
+	namespace PDF {
+
+/**
+ * LockProfiler collects statistics about the document locks acquired through
+ * DocReadGuard and DocWriteGuard: how long each call site waited for the
+ * lock and how long it held it, and which threads hold a lock right now.
+ * It can be used to find the code that keeps other threads waiting, e.g.
+ * render workers that stall behind annotation writers.
+ *
+ * Profiling is disabled by default, in which case the guards only lock and
+ * unlock the document. The statistics are shared by all documents.
+ *
+ * @code
+ * LockProfiler::Enable(true);
+ * ...
+ * {
+ *     DocWriteGuard guard(doc, "AnnotEditor::Apply");
+ *     ...
+ * }
+ * ...
+ * std::string json = LockProfiler::ToJSON();
+ * @endcode
+ *
+ * @note This class requires C++11 (PDFTRON_CPP11).
+ */
+class LockProfiler
+{
+public:
+	enum Mode
+	{
+		e_read,
+		e_write
+	};
+
+	/**
+	 * The number of histogram buckets. Bucket 0 counts durations below 1
+	 * microsecond, and bucket i > 0 counts durations in [2^(i-1), 2^i)
+	 * microseconds. The last bucket also counts all longer durations.
+	 */
+	enum { k_num_buckets = 32 };
+
+	/**
+	 * The lock statistics of a single call site.
+	 */
+	struct SiteStats
+	{
+		std::string site;             ///< The call site name.
+		UInt64 read_count;            ///< The number of read locks acquired.
+		UInt64 write_count;           ///< The number of write locks acquired.
+		UInt64 contended_count;       ///< The number of locks that were not available immediately.
+		UInt64 timeout_count;         ///< The number of timed out lock attempts.
+		double wait_total_ms;         ///< The total time spent waiting for the lock.
+		double wait_max_ms;           ///< The longest wait for the lock.
+		double hold_total_ms;         ///< The total time the lock was held.
+		double hold_max_ms;           ///< The longest time the lock was held.
+		UInt64 wait_histogram[k_num_buckets];  ///< Wait time histogram, see k_num_buckets.
+		UInt64 hold_histogram[k_num_buckets];  ///< Hold time histogram, see k_num_buckets.
+	};
+
+	/**
+	 * A lock that is currently held.
+	 */
+	struct Holder
+	{
+		const SDF::SDFDoc* doc;       ///< The locked document (PDFDoc::GetSDFDoc()).
+		std::string thread_id;        ///< The holding thread.
+		std::string site;             ///< The call site that acquired the lock.
+		Mode mode;                    ///< The lock mode.
+		double held_ms;               ///< How long the lock has been held so far.
+	};
+
+	/**
+	 * Enables or disables profiling. Locks that are held while profiling is
+	 * enabled are recorded when they are released, even if profiling has
+	 * been disabled in the meantime.
+	 */
+	static void Enable(bool enable);
+
+	/**
+	 * @return true if profiling is enabled.
+	 */
+	static bool IsEnabled();
+
+	/**
+	 * Clears the collected statistics. Currently held locks are not affected.
+	 */
+	static void Reset();
+
+	/**
+	 * @return the statistics of all call sites, sorted by call site name.
+	 */
+	static std::vector<SiteStats> GetSiteStats();
+
+	/**
+	 * @param doc if not null, only the locks of this document are returned.
+	 * @return the locks that are currently held, in the order in which they
+	 * were acquired.
+	 */
+	static std::vector<Holder> GetHolders(const SDF::SDFDoc* doc = 0);
+	static std::vector<Holder> GetHolders(const PDFDoc* doc);
+
+	/**
+	 * @return the call site statistics and the current lock holders as a JSON
+	 * document. Histograms are written as objects that map the upper bound of
+	 * each non-empty bucket, in microseconds, to the number of samples.
+	 */
+	static std::string ToJSON();
+
+// @cond PRIVATE_DOC
+#ifndef SWIGHIDDEN
+	typedef std::chrono::steady_clock Clock;
+
+	static UInt64 BeginHold(const SDF::SDFDoc* doc, const char* site, Mode mode, double wait_ms, bool contended);
+	static void EndHold(UInt64 hold_id, double hold_ms);
+	static void RecordTimeout(const char* site, double wait_ms);
+	static double ElapsedMs(Clock::time_point start);
+#endif
+// @endcond
+
+private:
+	struct HoldRecord
+	{
+		const SDF::SDFDoc* doc;
+		std::thread::id thread_id;
+		std::string site;
+		Mode mode;
+		Clock::time_point start;
+	};
+
+	struct State
+	{
+		State() : enabled(false), next_hold_id(1) {}
+		std::mutex mutex;
+		std::atomic<bool> enabled;
+		std::unordered_map<std::string, SiteStats> sites;
+		std::map<UInt64, HoldRecord> holds;
+		UInt64 next_hold_id;
+	};
+
+	static State& GetState();
+	static SiteStats& GetSiteLocked(State& state, const std::string& site);
+	static void AddSample(UInt64* histogram, double ms);
+	static void AppendHistogram(std::string& out, const UInt64* histogram);
+	static void AppendString(std::string& out, const std::string& str);
+	static void AppendNumber(std::string& out, double value);
+};
+
+/**
+ * DocLockGuard acquires a lock on a document for the lifetime of the guard
+ * (RAII), and reports the lock to LockProfiler when profiling is enabled.
+ * Use the DocReadGuard and DocWriteGuard subclasses. A PDFDoc and its
+ * SDFDoc (PDFDoc::GetSDFDoc()) share the same lock, so guards can be
+ * created for either.
+ */
+class DocLockGuard
+{
+public:
+	/**
+	 * Releases the lock, if it is still held.
+	 */
+	~DocLockGuard();
+
+	/**
+	 * @return true if the guard holds the lock. This is false only if a
+	 * timed lock attempt failed or Unlock() was called.
+	 */
+	bool OwnsLock() const;
+
+	/**
+	 * Releases the lock before the guard is destroyed.
+	 */
+	void Unlock();
+
+protected:
+	DocLockGuard(SDF::SDFDoc& doc, LockProfiler::Mode mode, const char* site);
+	DocLockGuard(SDF::SDFDoc& doc, LockProfiler::Mode mode, int milliseconds, const char* site);
+
+private:
+	DocLockGuard(const DocLockGuard&);
+	DocLockGuard& operator=(const DocLockGuard&);
+
+	bool TryLock(int milliseconds);
+	void Lock();
+	// Registers the hold with LockProfiler; releases the lock if that fails.
+	void BeginHold(const char* site, double wait_ms, bool contended);
+	void Release();
+
+	SDF::SDFDoc& m_doc;
+	LockProfiler::Mode m_mode;
+	bool m_locked;
+	UInt64 m_hold_id;
+	LockProfiler::Clock::time_point m_acquired;
+};
+
+/**
+ * Holds a read lock on a document (PDFDoc::LockRead()) for the lifetime of
+ * the guard.
+ *
+ * @code
+ * {
+ *     DocReadGuard guard(doc, PDFTRON_LOCK_SITE);
+ *     ... // read the document
+ * }   // the lock is released here, also when an exception is thrown
+ * @endcode
+ */
+class DocReadGuard : public DocLockGuard
+{
+public:
+	/**
+	 * Waits until the read lock is acquired.
+	 * @param site the call site name reported to LockProfiler. It can be a
+	 * descriptive name or PDFTRON_LOCK_SITE.
+	 */
+	explicit DocReadGuard(PDFDoc& doc, const char* site = 0);
+
+	/**
+	 * Tries to acquire the read lock within the given time
+	 * (PDFDoc::TryLockRead()). Use OwnsLock() to find out if it succeeded.
+	 */
+	DocReadGuard(PDFDoc& doc, int milliseconds, const char* site = 0);
+
+	/**
+	 * Waits until the read lock on an SDFDoc is acquired
+	 * (SDF::SDFDoc::LockRead()).
+	 */
+	explicit DocReadGuard(SDF::SDFDoc& doc, const char* site = 0);
+	DocReadGuard(SDF::SDFDoc& doc, int milliseconds, const char* site = 0);
+};
+
+/**
+ * Holds a write lock on a document (PDFDoc::Lock()) for the lifetime of the
+ * guard.
+ * @see DocReadGuard
+ */
+class DocWriteGuard : public DocLockGuard
+{
+public:
+	/**
+	 * Waits until the write lock is acquired.
+	 * @param site the call site name reported to LockProfiler.
+	 */
+	explicit DocWriteGuard(PDFDoc& doc, const char* site = 0);
+
+	/**
+	 * Tries to acquire the write lock within the given time
+	 * (PDFDoc::TryLock()). Use OwnsLock() to find out if it succeeded.
+	 */
+	DocWriteGuard(PDFDoc& doc, int milliseconds, const char* site = 0);
+
+	/**
+	 * Waits until the write lock on an SDFDoc is acquired
+	 * (SDF::SDFDoc::Lock()).
+	 */
+	explicit DocWriteGuard(SDF::SDFDoc& doc, const char* site = 0);
+	DocWriteGuard(SDF::SDFDoc& doc, int milliseconds, const char* site = 0);
+};
+
+#include <Impl/DocLock.inl>
+
+	};	// namespace PDF
+};	// namespace pdftron
+
+#endif // PDFTRON_CPP11
+
+#endif // PDFTRON_H_CPPPDFDocLock
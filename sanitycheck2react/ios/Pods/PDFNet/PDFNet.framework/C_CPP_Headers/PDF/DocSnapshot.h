@@ -0,0 +1,175 @@
+//---------------------------------------------------------------------------------------
+// Copyright (c) 2001-2019 by PDFTron Systems Inc. All Rights Reserved.
+// Consult legal.txt regarding legal and license information.
+//---------------------------------------------------------------------------------------
+#ifndef PDFTRON_H_CPPPDFDocSnapshot
+#define PDFTRON_H_CPPPDFDocSnapshot
+
+#include <PDF/PDFDoc.h>
+#include <PDF/DocLock.h>
+
+#ifdef PDFTRON_CPP11
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace pdftron {
+	namespace PDF {
+
+/**
+ * DocSnapshotManager lets reader threads (renderers, text extractors, ...)
+ * work on immutable versions of a document without locking it, while a
+ * single writer keeps modifying the original document.
+ *
+ * A version is published by serializing the document to memory. Every
+ * reader owns a DocSnapshotManager::Reader, which opens the latest
+ * published version as a private PDFDoc. The private document is only used
+ * by the thread that owns the Reader, so it needs no locks, and changes
+ * made to the original document are not visible to it until the reader
+ * calls Refresh(). Versions are reference counted and released when the
+ * last Reader moves to a newer version.
+ *
+ * A sample use case:
+ * @code
+ * DocSnapshotManager snapshots(doc);   // publishes version 1
+ *
+ * // writer thread
+ * {
+ *     DocWriteGuard guard(doc);
+ *     annot.SetContents("...");
+ * }
+ * snapshots.Publish();
+ *
+ * // each reader thread
+ * DocSnapshotManager::Reader reader(snapshots);
+ * while (...) {
+ *     reader.Refresh();                 // move to the latest version
+ *     draw.Export(reader.GetDoc().GetPage(1), "page.png");
+ * }
+ * @endcode
+ *
+ * @note Publishing a version saves the whole document, so its cost is
+ * proportional to the document size. It suits workloads where reads are
+ * much more frequent than published changes.
+ * @note Each Reader opens its own copy of the document, and the Page and
+ * SDF::Obj handles obtained from it belong to that copy.
+ * @note Versions are saved with the encryption of the original document.
+ * If the document needs a user password, pass it to the constructor so that
+ * readers can decrypt their copies. Documents that use a custom security
+ * handler cannot be reopened by readers.
+ * @note This class requires C++11 (PDFTRON_CPP11).
+ */
+class DocSnapshotManager
+{
+public:
+	/**
+	 * An immutable, serialized version of the document.
+	 */
+	struct Version
+	{
+		UInt64 number;                     ///< The version number, starting at 1.
+		std::vector<unsigned char> data;   ///< The serialized document.
+	};
+
+	/**
+	 * A private, read-only view of a published version of the document.
+	 * A Reader must only be used by one thread at a time.
+	 */
+	class Reader
+	{
+	public:
+		/**
+		 * Opens the latest published version.
+		 *
+		 * @exception if the version cannot be decrypted. Without exceptions,
+		 * the error is recorded and GetDoc() returns the undecrypted
+		 * document.
+		 */
+		explicit Reader(DocSnapshotManager& manager);
+
+		/**
+		 * Moves to the latest published version, if it is newer than the
+		 * current one. The previous document is closed, so Page and Obj
+		 * handles obtained from GetDoc() are invalidated.
+		 *
+		 * @return true if the reader moved to a newer version.
+		 *
+		 * @exception if the new version cannot be decrypted. The reader
+		 * then stays on the current version (and Refresh() returns false
+		 * when exceptions are disabled).
+		 */
+		bool Refresh();
+
+		/**
+		 * @return the version number of the document returned by GetDoc().
+		 */
+		UInt64 GetVersion() const;
+
+		/**
+		 * @return the document of the current version.
+		 */
+		PDFDoc& GetDoc();
+
+	private:
+		Reader(const Reader&);
+		Reader& operator=(const Reader&);
+
+		bool Open(const std::shared_ptr<const Version>& version);
+
+		DocSnapshotManager& m_manager;
+		std::shared_ptr<const Version> m_version;
+		std::unique_ptr<PDFDoc> m_doc;
+	};
+
+	/**
+	 * Creates the manager and publishes the current state of the document
+	 * as version 1.
+	 *
+	 * @param doc the document. It must outlive the manager.
+	 * @param save_flags the SDFDoc::SaveOptions used to serialize versions.
+	 * e_incremental is ignored.
+	 * @param password the user password readers use to open the versions of
+	 * an encrypted document. Empty to use the default security handler.
+	 */
+	explicit DocSnapshotManager(PDFDoc& doc, UInt32 save_flags = 0, const std::string& password = "");
+
+	/**
+	 * Publishes the current state of the document as a new version. The
+	 * document is write locked while it is saved, so do not call this
+	 * function while holding a lock on the document.
+	 *
+	 * @return the new version number.
+	 */
+	UInt64 Publish();
+
+	/**
+	 * @return the latest published version number.
+	 */
+	UInt64 GetVersion() const;
+
+	/**
+	 * @return the latest published version.
+	 */
+	std::shared_ptr<const Version> GetLatest() const;
+
+private:
+	DocSnapshotManager(const DocSnapshotManager&);
+	DocSnapshotManager& operator=(const DocSnapshotManager&);
+
+	PDFDoc& m_doc;
+	UInt32 m_save_flags;
+	std::string m_password;
+	std::mutex m_publish_mutex;
+	mutable std::mutex m_mutex;
+	std::shared_ptr<const Version> m_latest;
+};
+
+#include <Impl/DocSnapshot.inl>
+
+	};	// namespace PDF
+};	// namespace pdftron
+
+#endif // PDFTRON_CPP11
+
+#endif // PDFTRON_H_CPPPDFDocSnapshot
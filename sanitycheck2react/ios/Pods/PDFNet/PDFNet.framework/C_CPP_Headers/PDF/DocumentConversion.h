@@ -34,6 +34,10 @@ public:
 	DocumentConversion(const DocumentConversion& other);
 	DocumentConversion(TRN_DocumentConversion impl);
 	DocumentConversion& operator= (const DocumentConversion& other);
+#ifdef PDFTRON_CPP11
+	DocumentConversion(DocumentConversion&& other) noexcept;
+	DocumentConversion& operator=(DocumentConversion&& other) noexcept;
+#endif
 	~DocumentConversion();
 	
 	void Destroy();
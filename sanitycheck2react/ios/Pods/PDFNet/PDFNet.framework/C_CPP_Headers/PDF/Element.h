@@ -177,6 +177,26 @@ public:
 	 * @return The PathData which contains the operators and corresponding point data.
 	 */
 	 PathData GetPathData() const;
+
+	/**
+	 * Same as GetPathData(), but stores the path in 'out', reusing the
+	 * capacity of its vectors. Use this overload to read the paths of many
+	 * elements without allocating for each of them.
+	 *
+	 * @param out receives the operators and points of the path.
+	 */
+	 void GetPathData(PathData& out) const;
+
+#ifndef SWIG
+	/**
+	 * Returns the path of the path element without copying it.
+	 *
+	 * @return a view of the operators and points owned by the element. The
+	 * view is valid until the element is modified or the ElementReader moves
+	 * to the next element.
+	 */
+	 PathDataView GetPathDataView() const;
+#endif
 	 
 	// Path Element (e_path) Set Methods --------------------------------------------
 	 
@@ -364,6 +384,22 @@ public:
 	 */
 	 UInt32 GetTextDataSize();
 
+	/**
+	 * Copies the internal text buffer to 'out', reusing its capacity.
+	 *
+	 * @param out receives the raw text data (see GetTextData()).
+	 */
+	 void GetTextData(std::vector<unsigned char>& out);
+
+#ifndef SWIG
+	/**
+	 * @return a view of the internal text buffer (see GetTextData()) and its
+	 * size. The view is valid until the element is modified or the
+	 * ElementReader moves to the next element.
+	 */
+	 ByteView GetTextDataView();
+#endif
+
 	/**
 	 * @return a reference to the current text matrix (Tm).
 	 */
@@ -401,6 +437,20 @@ public:
 	 */
 	 CharIterator GetCharIterator();
 
+#ifdef PDFTRON_CPP11
+	/**
+	 * @return a range over the characters of this text element, for use in
+	 * range-based for loops:
+	 * @code
+	 *     for (const CharData& ch : element.Chars()) {
+	 *         unsigned int char_code = ch.char_code;
+	 *     }
+	 * @endcode
+	 * @see GetCharIterator(), Common::IteratorRange
+	 */
+	 CharRange Chars();
+#endif
+
 	/** 
 	 * @return The text advance distance in text space.  
 	 * 
@@ -35,6 +35,10 @@ public:
 
 	 ElementBuilder();
 	 ~ElementBuilder();
+#ifdef PDFTRON_CPP11
+	 ElementBuilder(ElementBuilder&& other) noexcept;
+	 ElementBuilder& operator=(ElementBuilder&& other) noexcept;
+#endif
 
 	/**
 	 * The function sets the graphics state of this Element to the given value. 
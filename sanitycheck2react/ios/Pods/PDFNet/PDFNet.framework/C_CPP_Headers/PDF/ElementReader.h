@@ -23,6 +23,14 @@ namespace pdftron {
  */ 
 typedef Common::Iterator<int> GSChangesIterator; 
 
+#ifdef PDFTRON_CPP11
+/**
+ * GSChangesRange is an STL input range over the list of graphics state changes.
+ * For more information, please see ElementReader::Changes().
+ */
+typedef Common::IteratorRange<GSChangesIterator> GSChangesRange;
+#endif
+
 
 typedef TRN_CharData CharData;
 	
@@ -63,6 +71,10 @@ public:
 
 	ElementReader();
 	~ElementReader();
+#ifdef PDFTRON_CPP11
+	ElementReader(ElementReader&& other) noexcept;
+	ElementReader& operator=(ElementReader&& other) noexcept;
+#endif
 
 	/** 
 	 * Begin processing a page.
@@ -199,6 +211,19 @@ public:
 	 */ 
 	GSChangesIterator GetChangesIterator();
 
+#ifdef PDFTRON_CPP11
+	/**
+	 * @return a range over the identifiers of the modified graphics state
+	 * attributes (see GetChangesIterator()), for use in range-based for loops:
+	 * @code
+	 * for (int attr : reader.Changes()) {
+	 *     switch (attr) { case GState::e_transform: ... }
+	 * }
+	 * @endcode
+	 */
+	GSChangesRange Changes();
+#endif
+
 	/**
 	 * @return true if given GState attribute was changed since the last call to 
 	 * @param attrib the GState attribute to test if it has been changed
@@ -206,6 +231,18 @@ public:
 	 */
 	bool IsChanged(GState::GStateAttribute attrib); 
 
+	/**
+	 * @return the modified graphics state attributes since the last call to
+	 * ClearChangeList(), as a combination of GState::AttributeBit() values.
+	 * The list is read once, so any number of attributes can then be tested
+	 * without further calls:
+	 * @code
+	 * UInt64 changes = reader.GetChangeMask();
+	 * if (changes & (GState::AttributeBit(GState::e_fill_color) | GState::AttributeBit(GState::e_fill_overprint))) ...
+	 * @endcode
+	 */
+	UInt64 GetChangeMask();
+
 	/**
 	 * Clear the list containing identifiers of modified graphics state attributes.
 	 * The list of modified attributes is then accumulated during a subsequent call(s)
@@ -24,6 +24,10 @@ public:
 
 	 ElementWriter();
 	 ~ElementWriter();
+#ifdef PDFTRON_CPP11
+	 ElementWriter(ElementWriter&& other) noexcept;
+	 ElementWriter& operator=(ElementWriter&& other) noexcept;
+#endif
 
 
 	/**
@@ -29,6 +29,10 @@ public:
 	ExternalAnnotManager(const ExternalAnnotManager& other);
 	ExternalAnnotManager(TRN_ExternalAnnotManager impl);
 	ExternalAnnotManager& operator= (const ExternalAnnotManager& other);
+#ifdef PDFTRON_CPP11
+	ExternalAnnotManager(ExternalAnnotManager&& other) noexcept;
+	ExternalAnnotManager& operator=(ExternalAnnotManager&& other) noexcept;
+#endif
 	~ExternalAnnotManager();
 	
 	void Destroy();
@@ -228,6 +228,10 @@ public:
 
 	 Font(const Font& c);
 	 Font& operator=(const Font& c);
+#ifdef PDFTRON_CPP11
+	 Font(Font&& other) noexcept;
+	 Font& operator=(Font&& other) noexcept;
+#endif
 
 	/** 
 	 * @return Font Type
@@ -36,6 +36,10 @@ public:
 	 Function (SDF::Obj funct_dict = 0);
 	 Function(const Function& f);
 	 Function& operator=(const Function& f);
+#ifdef PDFTRON_CPP11
+	 Function(Function&& other) noexcept;
+	 Function& operator=(Function&& other) noexcept;
+#endif
 	 ~Function();
 
 	enum Type
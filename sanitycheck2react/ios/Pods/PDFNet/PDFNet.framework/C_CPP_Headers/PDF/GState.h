@@ -435,6 +435,68 @@ public:
 	 */
 	 SDF::Obj GetHalftone();
 
+	// Change Tracking --------------------------------------------------------------
+
+	/**
+	 * @return the bit of a GStateAttribute in a change mask, as returned by
+	 * ElementReader::GetChangeMask().
+	 */
+	static UInt64 AttributeBit(GStateAttribute attr) { return (UInt64)1 << attr; }
+
+	/**
+	 * A packed copy of the numeric attributes of a graphics state. Snapshots
+	 * are plain values, so keeping and comparing them does not call into
+	 * PDFNet.
+	 */
+	struct NumericSnapshot
+	{
+		double ctm[6];              ///< The transformation matrix a, b, c, d, h, v (e_transform).
+		double line_width;          ///< e_line_width
+		double fill_opacity;        ///< e_opacity_fill
+		double stroke_opacity;      ///< e_opacity_stroke
+		double font_size;           ///< e_font_size
+		double char_spacing;        ///< e_char_spacing
+		double word_spacing;        ///< e_word_spacing
+		double text_rise;           ///< e_text_rise
+	};
+
+	/**
+	 * @return the mask of the attributes that are part of a NumericSnapshot.
+	 */
+	static UInt64 GetNumericMask();
+
+	/**
+	 * Copies all numeric attributes of this graphics state to a snapshot.
+	 */
+	 void GetNumericSnapshot(NumericSnapshot& out);
+
+	/**
+	 * Copies only the numeric attributes in the given change mask to a
+	 * snapshot. Combined with ElementReader::GetChangeMask(), this keeps a
+	 * snapshot up to date with one call per changed attribute:
+	 * @code
+	 * GState::NumericSnapshot prev, cur;
+	 * Element element = reader.Next();
+	 * if (element) element.GetGState().GetNumericSnapshot(cur);
+	 * for (; element; element = reader.Next()) {
+	 *     prev = cur;
+	 *     element.GetGState().UpdateNumericSnapshot(reader.GetChangeMask(), cur);
+	 *     reader.ClearChangeList();
+	 *     if (GState::Compare(prev, cur) & GState::AttributeBit(GState::e_opacity_fill)) ...
+	 * }
+	 * @endcode
+	 *
+	 * @param changes a combination of AttributeBit() values.
+	 * @param snapshot the snapshot to update.
+	 */
+	 void UpdateNumericSnapshot(UInt64 changes, NumericSnapshot& snapshot);
+
+	/**
+	 * @return the mask of the attributes whose values differ between two
+	 * snapshots.
+	 */
+	static UInt64 Compare(const NumericSnapshot& s1, const NumericSnapshot& s2);
+
 	// Set Methods ------------------------------------------------------------------
 
 	/**
@@ -84,6 +84,10 @@ public:
 	* Assignment operator.
 	*/
 	Highlights& operator = ( const Highlights& hlts );
+#ifdef PDFTRON_CPP11
+	Highlights(Highlights&& other) noexcept;
+	Highlights& operator=(Highlights&& other) noexcept;
+#endif
 
 	/**
 	* Load the Highlight information from a file. Note that the
@@ -308,6 +308,10 @@ public:
 
 	 Image(const Image&);
 	 Image& operator=(const Image&);
+#ifdef PDFTRON_CPP11
+	 Image(Image&& other) noexcept;
+	 Image& operator=(Image&& other) noexcept;
+#endif
 
 	/**
 	 * @return the underlying SDF/Cos object
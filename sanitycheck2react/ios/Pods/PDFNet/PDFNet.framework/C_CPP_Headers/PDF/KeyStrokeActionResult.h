@@ -15,6 +15,10 @@ public:
 	UString GetText();
 	KeyStrokeActionResult(const KeyStrokeActionResult& action_result);
 	KeyStrokeActionResult& operator=(const KeyStrokeActionResult& action_result);
+#ifdef PDFTRON_CPP11
+	KeyStrokeActionResult(KeyStrokeActionResult&& other) noexcept;
+	KeyStrokeActionResult& operator=(KeyStrokeActionResult&& other) noexcept;
+#endif
 
 	void Destroy();
 #ifndef SWIGHIDDEN
@@ -13,6 +13,10 @@ public:
 	~KeyStrokeEventData();
 	KeyStrokeEventData(const KeyStrokeEventData& data);
 	KeyStrokeEventData& operator=(const KeyStrokeEventData& data);
+#ifdef PDFTRON_CPP11
+	KeyStrokeEventData(KeyStrokeEventData&& other) noexcept;
+	KeyStrokeEventData& operator=(KeyStrokeEventData&& other) noexcept;
+#endif
 
 	void Destroy();
 
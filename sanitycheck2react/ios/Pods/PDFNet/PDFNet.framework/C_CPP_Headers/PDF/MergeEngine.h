@@ -0,0 +1,192 @@
+//---------------------------------------------------------------------------------------
+// Copyright (c) 2001-2019 by PDFTron Systems Inc. All Rights Reserved.
+// Consult legal.txt regarding legal and license information.
+//---------------------------------------------------------------------------------------
+#ifndef PDFTRON_H_CPPPDFMergeEngine
+#define PDFTRON_H_CPPPDFMergeEngine
+
+#include <PDF/PDFDoc.h>
+#include <PDF/Page.h>
+#include <PDF/DocLock.h>
+#include <SDF/ObjHasher.h>
+#include <SDF/SDFDoc.h>
+#include <Common/WorkStealingScheduler.h>
+
+#ifdef PDFTRON_CPP11
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace pdftron {
+	namespace PDF {
+
+/**
+ * MergeEngine appends the pages of many source documents to one document,
+ * e.g. to bundle thousands of invoices.
+ *
+ * Compared to calling PDFDoc::ImportPages() for every source, MergeEngine:
+ *  - opens the source files and hashes their page resources (fonts, images,
+ *    form XObjects, ...) on a pool of worker threads, while the pages of the
+ *    previous sources are being imported;
+ *  - shares resources with the same content across source documents, so a
+ *    logo or font embedded by every source is stored only once;
+ *  - keeps at most two batches of source documents open at a time (the
+ *    batch being imported and the next one, which is opened meanwhile), and
+ *    can save the result directly to a file.
+ *
+ * A sample use case:
+ * @code
+ * MergeEngine merger;
+ * for (size_t i = 0; i < files.size(); ++i) merger.AddSource(files[i]);
+ * MergeEngine::Stats stats = merger.Merge("bundle.pdf");
+ * printf("%d pages, %d shared resources, %.0f ms\n",
+ *     stats.pages, stats.resources_merged, stats.elapsed_ms);
+ * @endcode
+ *
+ * @note Resources are matched by their SDF::ObjHasher hash, and compared by
+ * content (SDF::ObjHasher::Equal()) before they are shared. Only the resources
+ * referenced directly from the page resource dictionaries are shared; the
+ * duplicates they replace are dropped when the document is saved with
+ * SDFDoc::e_remove_unused.
+ * @note The pages are imported one source at a time, because a document can
+ * only be modified by one thread.
+ * @note This class requires C++11 (PDFTRON_CPP11).
+ */
+class MergeEngine
+{
+public:
+	/**
+	 * Statistics of a Merge() call. The open and hash times are summed over
+	 * all worker threads, the other times are wall-clock times.
+	 */
+	struct Stats
+	{
+		int sources;              ///< The number of merged source documents.
+		int pages;                ///< The number of merged pages.
+		int resources;            ///< The number of hashed page resources.
+		int resources_merged;     ///< The number of resource references redirected to an identical resource.
+		double open_ms;           ///< Time spent opening source documents.
+		double hash_ms;           ///< Time spent hashing resources.
+		double import_ms;         ///< Time spent importing pages (PDFDoc::ImportPages()).
+		double dedupe_ms;         ///< Time spent redirecting duplicate resources.
+		double save_ms;           ///< Time spent saving the result, if Merge() saves it.
+		double elapsed_ms;        ///< The total time of the Merge() call.
+	};
+
+	/**
+	 * @param num_threads the number of worker threads used to open and hash
+	 * source documents. 0 means one thread per hardware thread.
+	 */
+	explicit MergeEngine(int num_threads = 0);
+
+	/**
+	 * @return the number of worker threads.
+	 */
+	int GetThreadCount() const;
+
+	/**
+	 * Sets the number of source documents that are opened together. The
+	 * next batch is opened while the current one is imported, so up to twice
+	 * this number of documents are open at a time. The default is four per
+	 * worker thread. Larger batches keep the workers busier, smaller batches
+	 * use less memory.
+	 */
+	void SetBatchSize(int batch_size);
+
+	/**
+	 * Sets whether the bookmarks of the source documents are imported as well.
+	 * @see PDFDoc::ImportPages()
+	 */
+	void SetImportBookmarks(bool import_bookmarks);
+
+	/**
+	 * Adds a source file. It is opened during Merge(), and closed as soon as
+	 * its pages have been imported.
+	 *
+	 * @param path the path of the file.
+	 * @param password the password used to open the file, if it is encrypted.
+	 */
+	void AddSource(const UString& path, const std::string& password = "");
+
+	/**
+	 * Adds an open source document. The document must stay open until Merge()
+	 * returns, and it must not be the destination document. It is read
+	 * locked while it is used.
+	 */
+	void AddSource(PDFDoc& doc);
+
+	/**
+	 * @return the number of sources added so far.
+	 */
+	int GetSourceCount() const;
+
+	/**
+	 * Removes all sources.
+	 */
+	void Clear();
+
+	/**
+	 * Appends the pages of all sources, in the order in which they were
+	 * added, to the given document. The document is write locked while the
+	 * pages of each source are imported.
+	 *
+	 * If an error occurs, it is rethrown once the worker threads have stopped.
+	 * The pages of the sources that were merged before the error remain in
+	 * the document.
+	 */
+	Stats Merge(PDFDoc& dest);
+
+	/**
+	 * Merges all sources into a new document and saves it to the given file.
+	 *
+	 * @param save_flags the SDFDoc::SaveOptions passed to PDFDoc::Save().
+	 * e_remove_unused drops the resources replaced by identical resources.
+	 */
+	Stats Merge(const UString& path, UInt32 save_flags = SDF::SDFDoc::e_remove_unused);
+
+private:
+	typedef std::chrono::steady_clock Clock;
+
+	struct Source
+	{
+		UString path;
+		std::string password;
+		PDFDoc* doc;
+	};
+
+	// A source that has been opened and hashed.
+	struct Prepared
+	{
+		std::unique_ptr<PDFDoc> owned;
+		PDFDoc* doc;
+		std::vector<Page> pages;
+		std::map<UInt32, SDF::ContentHash> hashes;
+	};
+
+	void Prepare(int first_source, std::vector<Prepared>& batch, Stats& stats) const;
+	void Import(PDFDoc& dest, Prepared& source, std::map<SDF::ContentHash, SDF::Obj>& canonical,
+		SDF::ObjHasher& verifier, Stats& stats) const;
+	static void Redirect(Page src_page, Page dest_page, const std::map<UInt32, SDF::ContentHash>& hashes,
+		std::map<SDF::ContentHash, SDF::Obj>& canonical, SDF::ObjHasher& verifier, Stats& stats);
+	static const char* const* GetResourceTypes();
+	static double ElapsedMs(Clock::time_point start);
+
+	Common::WorkStealingScheduler m_scheduler;
+	int m_batch_size;
+	bool m_import_bookmarks;
+	std::vector<Source> m_sources;
+};
+
+#include <Impl/MergeEngine.inl>
+
+	};	// namespace PDF
+};	// namespace pdftron
+
+#endif // PDFTRON_CPP11
+
+#endif // PDFTRON_H_CPPPDFMergeEngine
@@ -12,12 +12,16 @@
 #include <C/PDF/TRN_PDFDoc.h>
 #include <PDF/PDFDocViewPrefs.h>
 #include <SDF/SDFDoc.h>
+#include <Filters/MappedFile.h>
 #include <PDF/Page.h>
 #include <PDF/PageSet.h>
 #include <PDF/DiffOptions.h>
 #include <PDF/Annot.h>
 #include <Common/Iterator.h>
 #include <SDF/SignatureHandler.h>
+#ifdef PDFTRON_CPP11
+#include <chrono>
+#endif
 
 namespace pdftron {
 	namespace PDF {
@@ -38,6 +42,20 @@ typedef Common::Iterator<Page> PageIterator;
  */ 
 typedef Common::Iterator<Field> FieldIterator;
 
+#ifdef PDFTRON_CPP11
+/**
+ * PageRange is an STL input range over the pages of a PDF document.
+ * For more information, please see PDFDoc::Pages().
+ */
+typedef Common::IteratorRange<PageIterator> PageRange;
+
+/**
+ * FieldRange is an STL input range over the form fields of a PDF document.
+ * For more information, please see PDFDoc::Fields().
+ */
+typedef Common::IteratorRange<FieldIterator> FieldRange;
+#endif
+
 
 /** 
  * PDFDoc is a high-level class describing a single PDF (Portable Document 
@@ -84,6 +102,10 @@ public:
 	 */
 	 PDFDoc(const PDFDoc& other);
 	 PDFDoc& operator= (const PDFDoc&);
+#ifdef PDFTRON_CPP11
+	 PDFDoc(PDFDoc&& other) noexcept;
+	 PDFDoc& operator=(PDFDoc&& other) noexcept;
+#endif
 
 	/**
 	 * Open an existing PDF document
@@ -96,6 +118,49 @@ public:
 	 PDFDoc (const UString& filepath);
 	 PDFDoc (const char* filepath);
 
+	/**
+	 * Flags controlling how PDFDoc(const UString&, UInt32, OpenStats*) opens a file.
+	 */
+	enum OpenFlags
+	{
+		e_open_default       = 0x00, ///< Same as PDFDoc(filepath).
+		e_open_mapped        = 0x01, ///< Read the file through a Filters::MappedFile.
+		e_open_no_disk_cache = 0x02  ///< Do not cache new stream objects in a temporary file (see SDFDoc::EnableDiskCaching()).
+	};
+
+	/**
+	 * Information about opening a document, reported by 
+	 * PDFDoc(const UString&, UInt32, OpenStats*).
+	 */
+	struct OpenStats
+	{
+		/** The time it took to open the document, in milliseconds, or -1 if it was not measured (C++11 is required). */
+		double open_time_ms;
+		/** The size of the file in bytes. Only available with e_open_mapped, 0 otherwise. */
+		size_t file_size;
+		/** true if the document is linearized (see IsLinearized()). */
+		bool linearized;
+	};
+
+	/**
+	 * Open an existing PDF document using the given open flags.
+	 *
+	 * With e_open_mapped the document is opened from a Filters::MappedFile 
+	 * (see PDFDoc(Filters::Filter)) instead of from the file path. Which 
+	 * parts of the file are read when the document is opened, and which 
+	 * are read later, is decided by the parser. With e_open_no_disk_cache, 
+	 * SDFDoc::EnableDiskCaching(false) is called on the opened document.
+	 *
+	 * @param filepath - pathname to the file.
+	 * @param open_flags - A bit field composed of an OR of PDFDoc::OpenFlags values.
+	 * @param out_stats - optional pointer to a structure that receives 
+	 * information about the open operation, such as the open latency.
+	 *
+	 * @note Make sure to call InitSecurityHandler() after PDFDoc(...) in case 
+	 * a document is encrypted
+	 */
+	 PDFDoc (const UString& filepath, UInt32 open_flags, OpenStats* out_stats = 0);
+
 	/**
 	 * Open an existing PDF document
 	 *
@@ -525,6 +590,34 @@ public:
 	 */
 	 void Save(Filters::Filter& stream, UInt32 flags); 
 
+#ifndef SWIG
+	/**
+	 * Saves the document by passing the serialized file, chunk by chunk, to a
+	 * callback function. Unlike Save(UInt32), the file is never materialized in
+	 * memory, so the memory used by this method does not depend on the size of
+	 * the document.
+	 *
+	 * @param write_proc the callback receiving the output data. See
+	 * Filters::CustomFilter::WriteProc.
+	 * @param user_data a pointer passed unchanged to 'write_proc'.
+	 * @param flags - A bit field composed of an OR of the SDFDoc::SaveOptions values.
+	 *
+	 * @return the total number of bytes passed to 'write_proc'.
+	 *
+	 * @exception - if there is a problem during Save, or if 'write_proc' returns
+	 * less than the size of a chunk, an Exception object will be thrown.
+	 *
+	 * @note - Chunks are delivered in output order, so the running total of the
+	 * chunk sizes can be used to report progress.
+	 *
+	 * @note - The output cannot seek, so SDFDoc::e_linearized is not supported.
+	 *
+	 * @note - Save will modify the PDFDoc object's internal representation.  As such, 
+	 *			  the user should acquire a write lock before calling save.
+	 */
+	 size_t Save(Filters::CustomFilter::WriteProc write_proc, void* user_data, UInt32 flags);
+#endif
+
 	/**
 	 * Use the Next() method on the returned iterator to traverse all pages in the document. 
 	 * For example:
@@ -543,6 +636,21 @@ public:
 	 */
 	 PageIterator GetPageIterator(UInt32 page_number=1);
 
+#ifdef PDFTRON_CPP11
+	/**
+	 * @return a range over the pages of the document, for use in range-based
+	 * for loops:
+	 * @code
+	 *   for (Page& page : pdfdoc.Pages()) {
+	 *      // ...
+	 *   }
+	 * @endcode
+	 * @param page_number the first page of the range. 1 corresponds to the first page.
+	 * @see GetPageIterator(), Common::IteratorRange
+	 */
+	 PageRange Pages(UInt32 page_number=1);
+#endif
+
 	/**
 	 * @param page_number - the page number in document's page sequence. Page numbers 
 	 * in document's page sequence are indexed from 1. 
@@ -835,6 +943,20 @@ public:
 	 FieldIterator GetFieldIterator();
 	 FieldIterator GetFieldIterator(const UString& field_name);
 
+#ifdef PDFTRON_CPP11
+	/**
+	 * @return a range over all Fields in the document, for use in range-based
+	 * for loops:
+	 * @code
+	 * for (Field& field : pdfdoc.Fields()) {
+	 *   cout << field.GetName() << endl;
+	 * }
+	 * @endcode
+	 * @see GetFieldIterator(), Common::IteratorRange
+	 */
+	 FieldRange Fields();
+#endif
+
 	/**
 	 * @param field_name - a string representing the fully qualified name of 
 	 * the field (e.g. "employee.name.first").
@@ -28,19 +28,25 @@ namespace pdftron {
 	namespace PDF {
 
 
-//return type for PDFDraw::GetBitmap
+/**
+ * Return type for PDFDraw::GetBitmap. Holds a copy of the rasterized image
+ * together with its dimensions.
+ *
+ * @note The pixel buffer is copied only once, when the bitmap is created. Use
+ * GetData()/GetSize() or GetBuffer() to access the pixels without a copy, and
+ * SwapBuffer() to take ownership of the pixel storage. To read the rasterizer 
+ * output in place, without any copy, use the PDFDraw::GetBitmap() overload that
+ * returns 'const UChar*'.
+ */
 class BitmapInfo
 {
   	std::vector<unsigned char> buf;
 	  
 public:
+	BitmapInfo() : width(0), height(0), stride(0), dpi(0) {}
+
 	BitmapInfo(int w, int h, int s, double d, char* b) {
-		width = w;
-		height = h;
-		stride = s;
-		dpi = d;
-		buf.resize(h*s);
-		memcpy(&buf[0], b, h*s);
+		Assign(w, h, s, d, b);
 	}
 	int width;
 	int height;
@@ -48,18 +54,106 @@ public:
 	double dpi;
 
 	//copy constructor
-	BitmapInfo(const BitmapInfo& b) {
+	BitmapInfo(const BitmapInfo& b) : buf(b.buf) {
 		width = b.width;
 		height = b.height;
 		stride = b.stride;
 		dpi = b.dpi;
-		std::vector<unsigned char> temp(b.GetBuffer());
-		buf.swap(temp);
 	}
-	  
-	std::vector<unsigned char> GetBuffer() const {
+
+	BitmapInfo& operator=(const BitmapInfo& b) {
+		if (this != &b) {
+			width = b.width;
+			height = b.height;
+			stride = b.stride;
+			dpi = b.dpi;
+			buf = b.buf;
+		}
+		return *this;
+	}
+
+#ifdef PDFTRON_CPP11
+	BitmapInfo(BitmapInfo&& b) noexcept : buf(std::move(b.buf)) {
+		width = b.width;
+		height = b.height;
+		stride = b.stride;
+		dpi = b.dpi;
+		b.width = b.height = b.stride = 0;
+		b.dpi = 0;
+	}
+
+	BitmapInfo& operator=(BitmapInfo&& b) noexcept {
+		if (this != &b) {
+			width = b.width;
+			height = b.height;
+			stride = b.stride;
+			dpi = b.dpi;
+			buf = std::move(b.buf);
+			b.width = b.height = b.stride = 0;
+			b.dpi = 0;
+		}
+		return *this;
+	}
+#endif
+
+	/**
+	 * Replaces the content of the bitmap with a copy of the given pixel buffer.
+	 * The existing storage is reused if it is large enough, so a BitmapInfo
+	 * that is repeatedly filled with pages of the same size does not reallocate.
+	 *
+	 * @param w the width of the image in pixels.
+	 * @param h the height of the image in pixels.
+	 * @param s the stride of the image in bytes. A negative stride means that 
+	 * the Y axis is inverted; the buffer size is always h*abs(s) bytes.
+	 * @param d the resolution of the image.
+	 * @param b the source pixel buffer. It must be at least h*abs(s) bytes long.
+	 */
+	void Assign(int w, int h, int s, double d, const char* b) {
+		width = w;
+		height = h;
+		stride = s;
+		dpi = d;
+		size_t sz = (size_t)h * (size_t)(s < 0 ? -s : s);
+		buf.resize(sz);
+		if (sz) memcpy(&buf[0], b, sz);
+	}
+
+	/**
+	 * @return a reference to the pixel buffer. The reference is valid as long as 
+	 * this BitmapInfo is not modified or destroyed.
+	 */
+	const std::vector<unsigned char>& GetBuffer() const {
 		return buf;
 	}
+
+#ifndef SWIG
+	/**
+	 * @return a pointer to the first byte of the pixel buffer, or NULL if the 
+	 * bitmap is empty. The pointer is valid as long as this BitmapInfo is not 
+	 * modified or destroyed.
+	 */
+	const unsigned char* GetData() const {
+		return buf.empty() ? 0 : &buf[0];
+	}
+
+	/**
+	 * @return the size of the pixel buffer in bytes.
+	 */
+	size_t GetSize() const {
+		return buf.size();
+	}
+
+	/**
+	 * Exchanges the pixel buffer with the given vector, without copying. 
+	 * This can be used to hand the rasterized image over to an encoder, or to 
+	 * supply a preallocated buffer that will be reused by PDFDraw::GetBitmap().
+	 *
+	 * @param out_buf the vector to swap the pixel buffer with.
+	 */
+	void SwapBuffer(std::vector<unsigned char>& out_buf) {
+		buf.swap(out_buf);
+	}
+#endif
 };
 
 /** 
@@ -82,6 +176,10 @@ public:
 	 */
 	PDFDraw(double dpi = 92);
 	~PDFDraw();
+#ifdef PDFTRON_CPP11
+	PDFDraw(PDFDraw&& other) noexcept;
+	PDFDraw& operator=(PDFDraw&& other) noexcept;
+#endif
 
 	/**
 	 * Sets the core graphics library used for rasterization and 
@@ -472,9 +570,22 @@ public:
 	 * @param demult - Specifies if the alpha is de-multiplied from the resulting color components. This
 	 * parameter is only used for e_rgba, e_bgra, e_gray_alpha formats.
 	 */
-	const BitmapInfo GetBitmap(Page page, PixelFormat pix_fmt = e_bgra, bool demult = false);
+	BitmapInfo GetBitmap(Page page, PixelFormat pix_fmt = e_bgra, bool demult = false);
 
 #ifndef SWIG
+	/**
+	 * Rasterizes the given page into an existing BitmapInfo. The storage 
+	 * already held by 'out_bmp' is reused when it is large enough, so calling 
+	 * this method in a loop with the same BitmapInfo avoids a new allocation 
+	 * per page. A caller-owned buffer can be supplied with BitmapInfo::SwapBuffer().
+	 *
+	 * @param page The source PDF page.
+	 * @param out_bmp - Filled by the method with the rasterized image.
+	 * @param pix_fmt - Optional parameter used to specify the desired pixel format.
+	 * @param demult - Specifies if the alpha is de-multiplied from the resulting color components.
+	 */
+	void GetBitmap(Page page, BitmapInfo& out_bmp, PixelFormat pix_fmt = e_bgra, bool demult = false);
+
 	const UChar* GetBitmap(Page page, int& out_width, int& out_height, int& out_stride, double& out_dpi, 
 		PixelFormat pix_fmt = e_bgra, bool demult = false);
 #endif
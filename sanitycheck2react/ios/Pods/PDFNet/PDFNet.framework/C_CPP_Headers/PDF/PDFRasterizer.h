@@ -92,6 +92,10 @@ public:
 	 */
 	PDFRasterizer(Type type = e_BuiltIn);
 	~PDFRasterizer();
+#ifdef PDFTRON_CPP11
+	PDFRasterizer(PDFRasterizer&& other) noexcept;
+	PDFRasterizer& operator=(PDFRasterizer&& other) noexcept;
+#endif
 
 	/**
 	 * Draws the page into a given memory buffer.
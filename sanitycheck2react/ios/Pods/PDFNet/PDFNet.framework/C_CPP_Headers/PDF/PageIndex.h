@@ -0,0 +1,153 @@
+//---------------------------------------------------------------------------------------
+// Copyright (c) 2001-2019 by PDFTron Systems Inc. All Rights Reserved.
+// Consult legal.txt regarding legal and license information.
+//---------------------------------------------------------------------------------------
+#ifndef PDFTRON_H_CPPPDFPageIndex
+#define PDFTRON_H_CPPPDFPageIndex
+
+#include <PDF/PDFDoc.h>
+#include <PDF/Page.h>
+#include <SDF/Obj.h>
+#include <vector>
+
+namespace pdftron {
+	namespace PDF {
+
+/**
+ * PageIndex is a flat table of the page dictionaries of a document, indexed
+ * by page number. It is built with a single traversal of the page tree, after
+ * which GetPage() takes constant time regardless of the shape of the page
+ * tree (PDFDoc::GetPage() descends the page tree on every call, which is
+ * slow for random access in large or badly balanced trees).
+ *
+ * GetPage() and GetPageObj() only read the table, so any number of threads
+ * can look up pages concurrently. The usual document locking rules still
+ * apply when the returned pages are used.
+ *
+ * The index does not observe the document. Page sequence changes should be
+ * made through the PageIndex methods (PageInsert(), PageRemove(),
+ * MovePages(), ...), which update the document and the table together.
+ * After changes made by other means, call Build() again.
+ *
+ * A sample use case:
+ * @code
+ * PageIndex index(doc);
+ * for (int i = 0; i < 100; ++i) {
+ *     Page page = index.GetPage(1 + rand() % index.GetPageCount());
+ *     ...
+ * }
+ * @endcode
+ */
+class PageIndex
+{
+public:
+	/**
+	 * Creates an empty index. Use Build() to index a document.
+	 */
+	PageIndex();
+
+	/**
+	 * Creates an index of the pages of the given document.
+	 * @note the document must outlive the index.
+	 */
+	explicit PageIndex(PDFDoc& doc);
+
+	/**
+	 * Indexes the pages of the given document, replacing the current content.
+	 * The caller should hold at least a read lock on the document.
+	 */
+	void Build(PDFDoc& doc);
+
+	/**
+	 * @return the document this index was built for, or 0 if the index is empty.
+	 */
+	PDFDoc* GetDoc() const;
+
+	/**
+	 * @return the number of pages in the index.
+	 */
+	int GetPageCount() const;
+
+	/**
+	 * @param page_number the page number. 1 corresponds to the first page.
+	 * @return the page, or a null (invalid) page if the page number is out
+	 * of range, the same as PDFDoc::GetPage().
+	 */
+	Page GetPage(UInt32 page_number) const;
+
+	/**
+	 * @param page_number the page number. 1 corresponds to the first page.
+	 * @return the page dictionary, or a null object if the page number is
+	 * out of range.
+	 */
+	SDF::Obj GetPageObj(UInt32 page_number) const;
+
+	/**
+	 * Inserts a page before the given page number and updates the index.
+	 * A page number larger than the page count appends the page.
+	 * @see PDFDoc::PageInsert()
+	 */
+	void PageInsert(UInt32 insert_before_page_number, Page page);
+
+	/**
+	 * Adds a page to the beginning of the document and updates the index.
+	 * @see PDFDoc::PagePushFront()
+	 */
+	void PagePushFront(Page page);
+
+	/**
+	 * Adds a page to the end of the document and updates the index.
+	 * @see PDFDoc::PagePushBack()
+	 */
+	void PagePushBack(Page page);
+
+	/**
+	 * Removes the given page from the document and updates the index.
+	 * @see PDFDoc::PageRemove()
+	 */
+	void PageRemove(UInt32 page_number);
+
+	/**
+	 * Inserts a range of pages from another document and updates the index.
+	 * @see PDFDoc::InsertPages()
+	 */
+	void InsertPages(int insert_before_page_number, PDFDoc& src_doc, int start_page, int end_page,
+		PDFDoc::InsertFlag flag);
+
+	/**
+	 * Moves a range of pages from another document (or within the indexed
+	 * document) and updates the index.
+	 *
+	 * @param src_index the index of 'src_doc', if there is one. The moved
+	 * pages are removed from it.
+	 * @see PDFDoc::MovePages()
+	 */
+	void MovePages(int move_before_page_number, PDFDoc& src_doc, int start_page, int end_page,
+		PDFDoc::InsertFlag flag, PageIndex* src_index = 0);
+
+	/**
+	 * Looks up the page dictionaries of the given pages. If the pages make up
+	 * a large part of the document, they are found with a single traversal of
+	 * the page tree; otherwise each page is looked up with PDFDoc::GetPage().
+	 * The caller should hold at least a read lock on the document.
+	 *
+	 * @param out_pages receives the page dictionary of page_nums[i] at index i,
+	 * or a null object if the page does not exist.
+	 */
+	static void Lookup(PDFDoc& doc, const std::vector<int>& page_nums, std::vector<SDF::Obj>& out_pages);
+
+private:
+	int ClampInsertPos(int insert_before_page_number) const;
+	void LoadRange(int first_page, int count);
+	void EraseRange(int first_page, int count);
+
+	PDFDoc* mp_doc;
+	std::vector<TRN_Obj> m_pages;
+};
+
+#include <Impl/PageIndex.inl>
+
+	};	// namespace PDF
+};	// namespace pdftron
+
+#endif // PDFTRON_H_CPPPDFPageIndex
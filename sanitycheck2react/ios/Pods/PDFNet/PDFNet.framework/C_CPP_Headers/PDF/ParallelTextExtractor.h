@@ -0,0 +1,137 @@
+//---------------------------------------------------------------------------------------
+// Copyright (c) 2001-2019 by PDFTron Systems Inc. All Rights Reserved.
+// Consult legal.txt regarding legal and license information.
+//---------------------------------------------------------------------------------------
+#ifndef PDFTRON_H_CPPPDFParallelTextExtractor
+#define PDFTRON_H_CPPPDFParallelTextExtractor
+
+#include <PDF/TextExtractor.h>
+#include <PDF/PDFDoc.h>
+#include <PDF/DocLock.h>
+#include <PDF/PageIndex.h>
+#include <Common/WorkStealingScheduler.h>
+
+#ifdef PDFTRON_CPP11
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace pdftron { 
+	namespace PDF {
+
+/**
+ * ParallelTextExtractor extracts text from many pages of a document 
+ * concurrently. Each worker thread owns its own TextExtractor and holds a 
+ * read lock on the document (PDFDoc::LockRead()) only while it processes a 
+ * page, so the pages are analyzed in parallel and writers are blocked only 
+ * for the duration of a single page. Pages are distributed with a 
+ * work-stealing scheduler, so a few expensive pages do not leave the other 
+ * threads idle.
+ *
+ * A sample use case:
+ * 
+ * @code
+ * PDFDoc doc(filein);
+ * doc.InitSecurityHandler();
+ * ParallelTextExtractor extractor(8);
+ * extractor.SetProcessingFlags(TextExtractor::e_remove_hidden_text);
+ * std::vector<int> pages;
+ * for (int i = 1; i <= doc.GetPageCount(); ++i) pages.push_back(i);
+ * std::vector<UString> text;
+ * extractor.ExtractText(doc, pages, text);   // text[i] belongs to pages[i]
+ * @endcode
+ *
+ * @note The pages are given as a list of page numbers rather than a PageSet, 
+ * because the content of a PageSet cannot be enumerated.
+ * @note This class requires C++11 (PDFTRON_CPP11).
+ */
+class ParallelTextExtractor
+{
+public:
+	/**
+	 * Callback invoked once per page, as soon as the page has been analyzed.
+	 *
+	 * @param page_idx the index of the page in the list passed to Process().
+	 * @param page_num the page number.
+	 * @param extractor the worker's TextExtractor, positioned on the page. 
+	 * It is valid only for the duration of the call.
+	 *
+	 * @note The callback is invoked concurrently from several worker threads, 
+	 * in the order in which pages complete. The document read lock is held 
+	 * during the call.
+	 */
+	typedef std::function<void (int page_idx, int page_num, TextExtractor& extractor)> PageProc;
+
+	/**
+	 * @param num_threads the number of worker threads. 0 means one thread 
+	 * per hardware thread.
+	 */
+	explicit ParallelTextExtractor(int num_threads = 0);
+
+	/**
+	 * @return the number of worker threads.
+	 */
+	int GetThreadCount() const;
+
+	/**
+	 * Sets the ProcessingFlags passed to TextExtractor::Begin() for every page.
+	 */
+	void SetProcessingFlags(UInt32 flags);
+
+	/**
+	 * Sets the directionality of the text extractors.
+	 * @see TextExtractor::SetRightToLeftLanguage()
+	 */
+	void SetRightToLeftLanguage(bool rtl);
+
+	/**
+	 * Sets an optional clipping rectangle used for every page. 
+	 * @param clip the clipping rectangle, or NULL to read the whole page.
+	 */
+	void SetClipRect(const Rect* clip);
+
+	/**
+	 * Analyzes the given pages concurrently and streams each page to 'proc' 
+	 * as soon as it completes.
+	 *
+	 * @param doc the source document.
+	 * @param page_nums the numbers of the pages to process.
+	 * @param proc the callback invoked for every page.
+	 */
+	void Process(PDFDoc& doc, const std::vector<int>& page_nums, const PageProc& proc);
+
+	/**
+	 * Extracts the text of the given pages, as returned by 
+	 * TextExtractor::GetAsText().
+	 *
+	 * @param out_text - Filled by the method. out_text[i] holds the text of 
+	 * page page_nums[i].
+	 */
+	void ExtractText(PDFDoc& doc, const std::vector<int>& page_nums, std::vector<UString>& out_text, bool dehyphen = true);
+
+	/**
+	 * Exports the words of the given pages, as returned by 
+	 * TextExtractor::GetPageData().
+	 *
+	 * @param out_data - Filled by the method. out_data[i] holds the words of 
+	 * page page_nums[i].
+	 * @param flags - a combination of TextExtractor::PageDataFlags.
+	 */
+	void ExtractPageData(PDFDoc& doc, const std::vector<int>& page_nums, std::vector<PageTextData>& out_data, UInt32 flags = 0);
+
+private:
+	Common::WorkStealingScheduler m_scheduler;
+	UInt32 m_flags;
+	bool m_rtl;
+	bool m_has_clip;
+	Rect m_clip;
+};
+
+#include <Impl/ParallelTextExtractor.inl>
+
+	};	// namespace PDF
+};	// namespace pdftron
+
+#endif // PDFTRON_CPP11
+
+#endif // PDFTRON_H_CPPPDFParallelTextExtractor
@@ -5,6 +5,7 @@
 #ifndef PDFTRON_H_CPPPDFPathData
 #define PDFTRON_H_CPPPDFPathData
 
+#include <Common/ByteView.h>
 #include <vector>
 
 namespace pdftron {
@@ -141,6 +142,77 @@ public:
 // @endcond
 };
 
+#ifndef SWIG
+/**
+ * PathDataView is a non-owning view of the path of a path element, as
+ * returned by Element::GetPathDataView(). It has the same content as
+ * PathData, but points to the buffers owned by the element instead of
+ * copying them.
+ *
+ * @note The view is valid only until the element is modified or the
+ * ElementReader that produced it moves to the next element (i.e. the next
+ * call to ElementReader::Next() or ElementReader::End()). Use ToPathData()
+ * to obtain an owning copy.
+ */
+class PathDataView
+{
+public:
+	/**
+	 * Create an empty view.
+	 */
+	PathDataView() : m_oprs(0), m_oprs_count(0), m_pts(0), m_pts_count(0) {}
+
+	/**
+	 * Create a view of the given operator and point arrays.
+	 */
+	PathDataView(const UChar* oprs, size_t oprs_count, const double* pts, size_t pts_count)
+		: m_oprs(oprs), m_oprs_count(oprs_count), m_pts(pts), m_pts_count(pts_count) {}
+
+	/**
+	 * @return the PathData::PathSegmentType operators.
+	 */
+	ByteView GetOperators() const { return ByteView(m_oprs, m_oprs_count); }
+
+	/**
+	 * @return the number of operators.
+	 */
+	size_t GetOperatorCount() const { return m_oprs_count; }
+
+	/**
+	 * @return a pointer to the data points, stored as x, y pairs.
+	 */
+	const double* GetPoints() const { return m_pts; }
+
+	/**
+	 * @return the number of values returned by GetPoints(), i.e. twice the
+	 * number of points.
+	 */
+	size_t GetPointCount() const { return m_pts_count; }
+
+	/**
+	 * @return true if the path has no operators.
+	 */
+	bool Empty() const { return m_oprs_count == 0; }
+
+	/**
+	 * @return a PathData containing a copy of the operators and points.
+	 */
+	PathData ToPathData() const
+	{
+		PathData result;
+		result.oprs.assign(m_oprs, m_oprs + m_oprs_count);
+		result.pts.assign(m_pts, m_pts + m_pts_count);
+		return result;
+	}
+
+private:
+	const UChar* m_oprs;
+	size_t m_oprs_count;
+	const double* m_pts;
+	size_t m_pts_count;
+};
+#endif
+
 	};	// namespace PDF
 };	// namespace pdftron
 
@@ -53,6 +53,10 @@ public:
 
 	PatternColor(const PatternColor&);
 	PatternColor& operator=(const PatternColor&);
+#ifdef PDFTRON_CPP11
+	PatternColor(PatternColor&& other) noexcept;
+	PatternColor& operator=(PatternColor&& other) noexcept;
+#endif
 	
 	~PatternColor();
 
@@ -0,0 +1,124 @@
+//---------------------------------------------------------------------------------------
+// Copyright (c) 2001-2019 by PDFTron Systems Inc. All Rights Reserved.
+// Consult legal.txt regarding legal and license information.
+//---------------------------------------------------------------------------------------
+#ifndef PDFTRON_H_CPPPDFPixelConverter
+#define PDFTRON_H_CPPPDFPixelConverter
+
+#include <Common/BasicTypes.h>
+#include <Common/Common.h>
+
+#ifndef SWIG
+
+// Select the SIMD kernels enabled by the compiler flags (e.g. -mssse3, -mavx2
+// or /arch:AVX2). Define PDFTRON_NO_SIMD to always use the portable code.
+#if !defined(PDFTRON_NO_SIMD) && defined(__AVX2__)
+#define PDFTRON_PIXEL_AVX2
+#endif
+#if !defined(PDFTRON_NO_SIMD) && (defined(__SSSE3__) || defined(__AVX2__))
+#define PDFTRON_PIXEL_SSSE3
+#endif
+
+#if defined(PDFTRON_PIXEL_AVX2)
+#include <immintrin.h>
+#elif defined(PDFTRON_PIXEL_SSSE3)
+#include <tmmintrin.h>
+#endif
+
+namespace pdftron {
+	namespace PDF {
+
+/**
+ * PixelConverter contains optimized routines to convert the bitmaps produced
+ * by PDFDraw::GetBitmap() and PDFRasterizer::Rasterize() to the pixel formats
+ * expected by image and video encoders.
+ *
+ * All functions operate on rectangular images described by a pointer to the
+ * first row, a stride in bytes and the image dimensions. The 4 channel
+ * formats store the alpha channel in the last byte of each pixel (BGRA or
+ * RGBA byte order). Unless stated otherwise the source and destination may
+ * be the same buffer.
+ *
+ * The functions use SSSE3 or AVX2 instructions when the compiler targets
+ * them (e.g. -mssse3 or -mavx2) and portable code otherwise. All code paths
+ * produce identical results.
+ *
+ * For example:
+ * @code
+ * BitmapInfo bmp = draw.GetBitmap(page, PDFDraw::e_bgra);
+ * std::vector<UChar> rgb(bmp.width * bmp.height * 3);
+ * PixelConverter::BGRAToRGB(bmp.GetData(), bmp.stride, &rgb[0], bmp.width * 3, bmp.width, bmp.height);
+ * @endcode
+ */
+class PixelConverter
+{
+public:
+	/**
+	 * Converts BGRA to RGBA or RGBA to BGRA by swapping the first and the
+	 * third byte of every pixel.
+	 */
+	static void SwapRedBlue(const UChar* src, int src_stride, UChar* dst, int dst_stride, int width, int height);
+
+	/**
+	 * Converts 4 channel pixels with straight alpha to premultiplied alpha
+	 * (c = c * a / 255, rounded to the nearest integer).
+	 */
+	static void Premultiply(const UChar* src, int src_stride, UChar* dst, int dst_stride, int width, int height);
+
+	/**
+	 * Converts 4 channel pixels with premultiplied alpha to straight alpha
+	 * (c = c * 255 / a, rounded to the nearest integer and clamped to 255).
+	 * Fully transparent pixels are set to 0.
+	 *
+	 * @note this is equivalent to the 'demult' option of PDFDraw::GetBitmap().
+	 */
+	static void Demultiply(const UChar* src, int src_stride, UChar* dst, int dst_stride, int width, int height);
+
+	/**
+	 * Converts BGRA pixels to packed 24 bit RGB, discarding the alpha channel.
+	 *
+	 * @note 'src' and 'dst' must not overlap.
+	 */
+	static void BGRAToRGB(const UChar* src, int src_stride, UChar* dst, int dst_stride, int width, int height);
+
+	/**
+	 * Converts BGRA pixels to 8 bit gray, using the ITU-R BT.601 luma
+	 * weights and discarding the alpha channel.
+	 *
+	 * @note 'src' and 'dst' must not overlap.
+	 */
+	static void BGRAToGray(const UChar* src, int src_stride, UChar* dst, int dst_stride, int width, int height);
+
+	/**
+	 * Converts BGRA pixels to planar YUV 4:2:0 (I420), using the ITU-R BT.601
+	 * limited range coefficients and discarding the alpha channel. The
+	 * chroma planes are subsampled by averaging 2x2 pixel blocks.
+	 *
+	 * @param dst_y the luma plane, 'width' x 'height' samples.
+	 * @param dst_u the Cb plane, ((width + 1) / 2) x ((height + 1) / 2) samples.
+	 * @param dst_v the Cr plane, ((width + 1) / 2) x ((height + 1) / 2) samples.
+	 *
+	 * @note the source and the destination planes must not overlap.
+	 */
+	static void BGRAToI420(const UChar* src, int src_stride,
+		UChar* dst_y, int y_stride, UChar* dst_u, int u_stride, UChar* dst_v, int v_stride,
+		int width, int height);
+
+private:
+	static void SwapRedBlueRow(const UChar* src, UChar* dst, int width);
+	static void PremultiplyRow(const UChar* src, UChar* dst, int width);
+	static void DemultiplyRow(const UChar* src, UChar* dst, int width);
+	static void BGRAToRGBRow(const UChar* src, UChar* dst, int width);
+	static void BGRAToGrayRow(const UChar* src, UChar* dst, int width);
+	static void BGRAToYRow(const UChar* src, UChar* dst, int width);
+	static void BGRAToUVRow(const UChar* src0, const UChar* src1, UChar* dst_u, UChar* dst_v, int width);
+};
+
+#include <Impl/PixelConverter.inl>
+
+	};	// namespace PDF
+};	// namespace pdftron
+
+#endif // SWIG
+
+#endif // PDFTRON_H_CPPPDFPixelConverter
@@ -0,0 +1,288 @@
+//---------------------------------------------------------------------------------------
+// Copyright (c) 2001-2019 by PDFTron Systems Inc. All Rights Reserved.
+// Consult legal.txt regarding legal and license information.
+//---------------------------------------------------------------------------------------
+#ifndef PDFTRON_H_CPPPDFRenderCache
+#define PDFTRON_H_CPPPDFRenderCache
+
+#include <PDF/PDFDraw.h>
+#include <PDF/PDFDoc.h>
+
+#ifdef PDFTRON_CPP11
+#include <chrono>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <stdio.h>
+
+namespace pdftron {
+	namespace PDF {
+
+/**
+ * RenderSettings is the set of PDFDraw options that affect the rasterized
+ * image of a page. It is used by RenderCache both to configure a PDFDraw
+ * and to build the cache key, so two renders share a cache entry only if
+ * all of these settings are equal.
+ *
+ * The default values match the defaults of PDFDraw.
+ */
+struct RenderSettings
+{
+	RenderSettings();
+
+	double dpi;                   ///< See PDFDraw::SetDPI(). Ignored if width and height are set.
+	int width;                    ///< See PDFDraw::SetImageSize(). 0 to use 'dpi'.
+	int height;                   ///< See PDFDraw::SetImageSize(). 0 to use 'dpi'.
+	bool preserve_aspect_ratio;   ///< See PDFDraw::SetImageSize().
+	Page::Box page_box;           ///< See PDFDraw::SetPageBox().
+	Page::Rotate rotate;          ///< See PDFDraw::SetRotate().
+	bool flip_y;                  ///< See PDFDraw::SetFlipYAxis().
+	bool draw_annotations;        ///< See PDFDraw::SetDrawAnnotations().
+	bool highlight_fields;        ///< See PDFDraw::SetHighlightFields().
+	bool anti_aliasing;           ///< See PDFDraw::SetAntiAliasing().
+	bool path_hinting;            ///< See PDFDraw::SetPathHinting().
+	bool image_smoothing;         ///< See PDFDraw::SetImageSmoothing().
+	bool hq_image_resampling;     ///< See PDFDraw::SetImageSmoothing().
+	double gamma;                 ///< See PDFDraw::SetGamma(). Values <= 0 are treated as 1 (no correction).
+	bool print_mode;              ///< See PDFDraw::SetPrintMode().
+	bool page_transparent;        ///< See PDFDraw::SetPageTransparent().
+	UInt8 page_color[3];          ///< See PDFDraw::SetDefaultPageColor().
+	PDFDraw::PixelFormat pix_fmt; ///< See PDFDraw::GetBitmap().
+	bool demult;                  ///< See PDFDraw::GetBitmap().
+
+	/**
+	 * Applies the settings to the given PDFDraw.
+	 */
+	void Apply(PDFDraw& draw) const;
+
+	/**
+	 * @return a compact binary string that uniquely identifies the settings.
+	 */
+	std::string GetKey() const;
+
+private:
+	double GetGamma() const;
+};
+
+/**
+ * RenderCache is a thread-safe, size-bounded cache of rendered pages, that
+ * can be shared by several PDFDraw objects, threads and requests. The cache
+ * is keyed by the document fingerprint, the page object number and
+ * generation, and the RenderSettings used to render the page.
+ *
+ * The cache has two tiers. Recently used bitmaps are kept in memory; when
+ * the memory limit is exceeded the least recently used bitmaps are written
+ * to the disk tier (if a cache directory is set) and are reloaded from disk
+ * on the next hit. Both tiers are evicted in LRU order.
+ *
+ * A sample use case:
+ *
+ * @code
+ * RenderCache cache(256 << 20);              // 256 MB in memory
+ * cache.SetDiskCache("/tmp/render", 2048LL << 20);
+ * ...
+ * RenderSettings settings;
+ * settings.dpi = 150;
+ * std::string id = RenderCache::GetDocumentFingerprint(doc);
+ * std::shared_ptr<const BitmapInfo> bmp = cache.GetBitmap(draw, id, page, settings);
+ * @endcode
+ *
+ * Documents opened from memory or created in code usually have neither a
+ * file name nor a file identifier, so GetDocumentFingerprint() cannot tell
+ * them apart. For such documents the caller must supply an id that is unique
+ * per document (e.g. a database key or a hash of the source buffer).
+ *
+ * @note The cache does not observe changes to the document. The fingerprint
+ * should change whenever the document is modified, or Remove() should be used
+ * to drop the entries of a modified document.
+ * @note Settings that are not part of RenderSettings (such as an OCG context
+ * or a clip rectangle) must be the same for all PDFDraw objects sharing a
+ * cache, or must be encoded in the document fingerprint.
+ * @note This class requires C++11 (PDFTRON_CPP11).
+ */
+class RenderCache
+{
+public:
+	/**
+	 * Cache statistics, as returned by GetStats().
+	 */
+	struct Stats
+	{
+		UInt64 memory_hits;     ///< Lookups served from memory.
+		UInt64 disk_hits;       ///< Lookups served from the disk tier.
+		UInt64 misses;          ///< Lookups that required rendering.
+		UInt64 evictions;       ///< Entries dropped from the cache (from the last tier).
+		size_t memory_entries;  ///< Current number of entries in memory.
+		size_t memory_bytes;    ///< Current size of the memory tier in bytes.
+		size_t disk_entries;    ///< Current number of entries on disk.
+		UInt64 disk_bytes;      ///< Current size of the disk tier in bytes.
+	};
+
+	/**
+	 * @param max_memory_bytes the maximum total size of the bitmaps kept in memory.
+	 */
+	explicit RenderCache(size_t max_memory_bytes);
+
+	/**
+	 * Destructor. Deletes the files created in the disk tier.
+	 */
+	~RenderCache();
+
+	/**
+	 * Enables the disk tier.
+	 *
+	 * @param directory an existing directory where the evicted bitmaps are
+	 * stored. The files are only valid for this RenderCache, and are deleted
+	 * when they are evicted or when the cache is destroyed. The file names
+	 * start with a random prefix chosen per cache, so several caches and
+	 * processes can share a directory. An empty string disables the disk
+	 * tier.
+	 * @param max_disk_bytes the maximum total size of the files in the disk tier.
+	 */
+	void SetDiskCache(const std::string& directory, UInt64 max_disk_bytes);
+
+	/**
+	 * Returns the cached rendering of a page, or renders the page with 'draw'
+	 * and inserts the result in the cache.
+	 *
+	 * @param draw the PDFDraw used on a cache miss. The settings are applied
+	 * to 'draw' before rendering.
+	 * @param doc_id the fingerprint of the document the page belongs to. See
+	 * GetDocumentFingerprint().
+	 * @param page the page to render.
+	 * @param settings the settings used to render the page.
+	 * @return the rendered bitmap. The bitmap is shared with the cache and
+	 * must not be modified.
+	 *
+	 * @note The cache lock is not held while the page is rendered or while
+	 * the disk tier is read or written, so concurrent misses are rendered in
+	 * parallel. A bitmap that is being reloaded from disk is not visible to
+	 * other threads until it is in memory again. 'draw' must not be used
+	 * concurrently by another thread.
+	 */
+	std::shared_ptr<const BitmapInfo> GetBitmap(PDFDraw& draw, const std::string& doc_id,
+		Page page, const RenderSettings& settings);
+
+	/**
+	 * Looks up a cached bitmap without rendering.
+	 * @return the cached bitmap, or an empty pointer on a miss.
+	 */
+	std::shared_ptr<const BitmapInfo> Find(const std::string& doc_id,
+		Page page, const RenderSettings& settings);
+
+	/**
+	 * Inserts a bitmap in the cache, replacing any existing entry with the same key.
+	 */
+	void Insert(const std::string& doc_id, Page page, const RenderSettings& settings,
+		const std::shared_ptr<const BitmapInfo>& bmp);
+
+	/**
+	 * Removes all entries of the given document from both tiers.
+	 */
+	void Remove(const std::string& doc_id);
+
+	/**
+	 * Removes all entries from both tiers. The hit/miss counters are not reset.
+	 */
+	void Clear();
+
+	/**
+	 * @return the cache statistics.
+	 */
+	Stats GetStats() const;
+
+	/**
+	 * @return a string identifying the document, based on its file name and
+	 * the file identifier stored in the trailer (the 'ID' entry).
+	 *
+	 * @exception if the document has neither a file name nor a file
+	 * identifier. The caller must then supply its own id.
+	 */
+	static std::string GetDocumentFingerprint(PDFDoc& doc);
+
+private:
+	struct Entry
+	{
+		std::string key;
+		size_t doc_id_len;
+		std::shared_ptr<const BitmapInfo> bmp;
+		size_t bytes;
+	};
+
+	struct DiskEntry
+	{
+		std::string key;
+		size_t doc_id_len;
+		std::string path;
+		UInt64 bytes;
+	};
+
+	// A bitmap evicted from memory that is being written to the disk tier.
+	struct Spill
+	{
+		std::string key;
+		size_t doc_id_len;
+		std::shared_ptr<const BitmapInfo> bmp;
+		std::string path;
+		bool written;
+	};
+
+	// File operations collected while the lock is held, and run by
+	// RunFileOps() after it is released.
+	struct FileOps
+	{
+		std::vector<Spill> spills;
+		std::vector<std::string> removals;
+	};
+
+	typedef std::list<Entry> EntryList;
+	typedef std::list<DiskEntry> DiskEntryList;
+
+	static std::string MakeKey(const std::string& doc_id, Page& page, const RenderSettings& settings);
+	std::shared_ptr<const BitmapInfo> Lookup(const std::string& key);
+	std::shared_ptr<const BitmapInfo> FindLocked(const std::string& key, FileOps& ops, DiskEntry& out_disk_entry);
+	void InsertLocked(const std::string& key, size_t doc_id_len, const std::shared_ptr<const BitmapInfo>& bmp, FileOps& ops);
+	void TrimMemoryLocked(FileOps& ops);
+	void TrimDiskLocked(FileOps& ops);
+	void EraseDiskLocked(DiskEntryList::iterator itr, FileOps& ops);
+	void RunFileOps(std::unique_lock<std::mutex>& lock, FileOps& ops);
+	bool WriteFile(const std::string& path, const BitmapInfo& bmp) const;
+	static std::shared_ptr<const BitmapInfo> ReadFile(const std::string& path);
+	static std::string MakeFilePrefix();
+
+	RenderCache(const RenderCache&);
+	RenderCache& operator= (const RenderCache&);
+
+	mutable std::mutex m_mutex;
+	size_t m_max_memory_bytes;
+	size_t m_memory_bytes;
+	EntryList m_entries;
+	std::unordered_map<std::string, EntryList::iterator> m_index;
+
+	std::string m_disk_dir;
+	UInt64 m_max_disk_bytes;
+	UInt64 m_disk_bytes;
+	std::string m_file_prefix;
+	UInt64 m_file_counter;
+	DiskEntryList m_disk_entries;
+	std::unordered_map<std::string, DiskEntryList::iterator> m_disk_index;
+	std::unordered_map<std::string, Spill> m_spilling;
+
+	UInt64 m_memory_hits;
+	UInt64 m_disk_hits;
+	UInt64 m_misses;
+	UInt64 m_evictions;
+};
+
+#include <Impl/RenderCache.inl>
+
+	};	// namespace PDF
+};	// namespace pdftron
+
+#endif // PDFTRON_CPP11
+
+#endif // PDFTRON_H_CPPPDFRenderCache
@@ -70,6 +70,10 @@ public:
 
 	 Shading (const Shading& s);
 	 Shading& operator=(const Shading& s);
+#ifdef PDFTRON_CPP11
+	 Shading(Shading&& other) noexcept;
+	 Shading& operator=(Shading&& other) noexcept;
+#endif
 	 ~Shading();
 
 	enum Type
@@ -8,7 +8,10 @@
 #include <PDF/Page.h>
 #include <PDF/Rect.h>
 #include <Common/UString.h>
+#include <Common/UStringView.h>
 #include <C/PDF/TRN_TextExtractor.h>
+#include <map>
+#include <string>
 #include <vector>
 
 namespace pdftron { 
@@ -101,6 +104,7 @@ namespace pdftron {
 class Style;
 class Word;
 class Line;
+class PageTextData;
 
 class TextExtractor 
 {
@@ -108,12 +112,17 @@ public:
 	typedef pdftron::PDF::Style Style;
 	typedef pdftron::PDF::Word Word;
 	typedef pdftron::PDF::Line Line;
+	typedef pdftron::PDF::PageTextData PageTextData;
 
 	/**
 	* Constructor and destructor
 	*/
 	 TextExtractor();
 	 ~TextExtractor();
+#ifdef PDFTRON_CPP11
+	 TextExtractor(TextExtractor&& other) noexcept;
+	 TextExtractor& operator=(TextExtractor&& other) noexcept;
+#endif
 
 	/** 
 	 * Processing options that can be passed in Begin() method to direct 
@@ -283,6 +292,43 @@ public:
 	  */
 	 Line GetFirstLine();
 
+#ifndef SWIG
+	/**
+	 * Flags selecting the optional arrays filled by GetPageData().
+	 */
+	enum PageDataFlags
+	{
+		// Fill PageTextData::word_quads.
+		e_page_data_quads = 1,
+
+		// Fill PageTextData::styles and PageTextData::word_style_ids.
+		e_page_data_styles = 2,
+
+		// Fill PageTextData::utf8_text and PageTextData::utf8_offsets.
+		e_page_data_utf8 = 4,
+
+		// Fill PageTextData::glyph_offsets and PageTextData::glyph_quads.
+		e_page_data_glyph_quads = 8
+	};
+
+	/**
+	 * Exports all words and lines on the current page into flat, 
+	 * structure-of-arrays buffers in a single pass.
+	 *
+	 * Word text, bounding boxes, line, paragraph and flow ids are always 
+	 * exported. Quadrilaterals, styles, UTF-8 text and glyph quadrilaterals 
+	 * are exported if requested by 'flags'. The arrays in 'out_data' are 
+	 * cleared but keep their capacity, so reusing the same PageTextData for 
+	 * consecutive pages avoids reallocation.
+	 *
+	 * @param out_data - Filled by the method with the text of the current page.
+	 * @param flags - a combination of PageDataFlags.
+	 *
+	 * @note Begin() must be called before this method.
+	 */
+	void GetPageData(PageTextData& out_data, UInt32 flags = 0);
+#endif
+
 	 /**
 	 * Frees the native memory of the object.
 	 */
@@ -292,6 +338,10 @@ public:
 private:
 	TRN_TextExtractor mp_extractor;
 
+#ifndef SWIG
+	static std::string GetStyleKey(TRN_TextExtractorStyle& style);
+#endif
+
 	// TextExtractor should not be copied
 	TextExtractor(const TextExtractor& other);
 	TextExtractor& operator= (const TextExtractor&);
@@ -445,6 +495,13 @@ public:
 	UString GetString();
 #else
 	const Unicode* GetString();
+
+	/** 
+		* @return the content of this word as a non-owning UStringView. The view 
+		* is valid as long as the TextExtractor that produced this word is alive 
+		* and is not restarted with TextExtractor::Begin().
+		*/
+	UStringView GetStringView();
 #endif
 
 	/** 
@@ -581,6 +638,58 @@ public:
 	// @endcond
 };
 
+#ifndef SWIG
+/**
+ * PageTextData holds the text of a page exported by TextExtractor::GetPageData()
+ * as a set of parallel arrays (structure-of-arrays). Word 'i' occupies 
+ * text[word_offsets[i], word_offsets[i+1]), its bounding box is 
+ * word_bboxes[4*i, 4*i+4) and it belongs to line word_line_ids[i]. 
+ * Per-line arrays are indexed by the line id.
+ *
+ * All coordinates are in unrotated page coordinates, as returned by 
+ * Word::GetBBox() and Word::GetQuad().
+ */
+class PageTextData
+{
+public:
+	std::vector<Unicode> text;          ///< UTF-16 text of all words, without separators.
+	std::vector<int> word_offsets;      ///< Start of each word in 'text', plus the end of the last word.
+	std::vector<double> word_bboxes;    ///< 4 values (x1, y1, x2, y2) per word.
+	std::vector<double> word_quads;     ///< 8 values per word. Only with e_page_data_quads.
+	std::vector<int> word_line_ids;     ///< Line id of each word.
+	std::vector<int> word_style_ids;    ///< Index into 'styles' of each word. Only with e_page_data_styles.
+	std::vector<Style> styles;          ///< Distinct word styles. Only with e_page_data_styles.
+	std::vector<char> utf8_text;        ///< UTF-8 text of all words. Only with e_page_data_utf8.
+	std::vector<int> utf8_offsets;      ///< Start of each word in 'utf8_text', plus the end of the last word.
+	std::vector<int> glyph_offsets;     ///< Index of the first glyph of each word, plus the total glyph count.
+	std::vector<double> glyph_quads;    ///< 8 values per glyph. Only with e_page_data_glyph_quads.
+	std::vector<double> line_bboxes;    ///< 4 values per line.
+	std::vector<int> line_para_ids;     ///< Paragraph id of each line.
+	std::vector<int> line_flow_ids;     ///< Flow id of each line.
+
+	/**
+	 * @return the number of words.
+	 */
+	int GetWordCount() const;
+
+	/**
+	 * @return the number of lines.
+	 */
+	int GetLineCount() const;
+
+	/**
+	 * @return a view of the text of the given word. The view is valid until 
+	 * this PageTextData is modified.
+	 */
+	UStringView GetWord(int word_idx) const;
+
+	/**
+	 * Removes all data, keeping the allocated capacity.
+	 */
+	void Clear();
+};
+#endif
+
 
 
 
@@ -176,6 +176,10 @@ public:
 	*/
 	TextSearch();
 	~TextSearch();
+#ifdef PDFTRON_CPP11
+	TextSearch(TextSearch&& other) noexcept;
+	TextSearch& operator=(TextSearch&& other) noexcept;
+#endif
 
  	/**
 	* Typedef the search mode.
@@ -0,0 +1,116 @@
+//---------------------------------------------------------------------------------------
+// Copyright (c) 2001-2019 by PDFTron Systems Inc. All Rights Reserved.
+// Consult legal.txt regarding legal and license information.
+//---------------------------------------------------------------------------------------
+#ifndef PDFTRON_H_CPPPDFTileRasterizer
+#define PDFTRON_H_CPPPDFTileRasterizer
+
+#include <PDF/PDFRasterizer.h>
+#include <PDF/PDFDoc.h>
+#include <PDF/DocLock.h>
+#include <Common/WorkStealingScheduler.h>
+
+#ifdef PDFTRON_CPP11
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace pdftron {
+	namespace PDF {
+
+/**
+ * TileRasterizer renders a page by splitting the target image into
+ * rectangular tiles and rasterizing the tiles concurrently. Every worker
+ * thread owns its own PDFRasterizer, and each tile is drawn in place into the
+ * caller's image buffer, so no intermediate tile buffers are allocated and
+ * no pixels are copied.
+ *
+ * The rasterizers are kept between calls, so the graphics caches of each
+ * worker are reused when several pages are rendered with the same
+ * TileRasterizer.
+ *
+ * A sample use case:
+ *
+ * @code
+ * TileRasterizer tiles(8);
+ * tiles.SetRasterizerConfig([](PDFRasterizer& rast) { rast.SetAntiAliasing(true); });
+ * Common::Matrix2D mtx(scale, 0, 0, scale, 0, 0);
+ * std::vector<unsigned char> buf(height * stride, 0xFF);
+ * tiles.Rasterize(doc, page, &buf[0], width, height, stride, 4, false, mtx);
+ * @endcode
+ *
+ * @note The methods of a TileRasterizer must not be called concurrently.
+ * Use one TileRasterizer per rendering thread.
+ * @note This class requires C++11 (PDFTRON_CPP11).
+ */
+class TileRasterizer
+{
+public:
+	/**
+	 * Callback used to configure every worker's PDFRasterizer (e.g. to
+	 * call SetAntiAliasing() or SetDrawAnnotations()).
+	 */
+	typedef std::function<void (PDFRasterizer& rast)> ConfigProc;
+
+	/**
+	 * @param num_threads the number of worker threads. 0 means one thread
+	 * per hardware thread.
+	 * @param type the type of the rasterizers used by the workers.
+	 */
+	explicit TileRasterizer(int num_threads = 0, PDFRasterizer::Type type = PDFRasterizer::e_BuiltIn);
+
+	/**
+	 * @return the number of worker threads.
+	 */
+	int GetThreadCount() const;
+
+	/**
+	 * Sets the size of the tiles in pixels. The default is 256 x 256.
+	 * Smaller tiles balance the load better, larger tiles reduce the
+	 * per-tile overhead of parsing the page content.
+	 */
+	void SetTileSize(int tile_width, int tile_height);
+
+	/**
+	 * Sets the function used to configure the rasterizers. The function is
+	 * applied immediately to all existing rasterizers and later to every
+	 * newly created rasterizer.
+	 */
+	void SetRasterizerConfig(const ConfigProc& proc);
+
+	/**
+	 * Draws the page into a given memory buffer. The parameters have the same
+	 * meaning as in PDFRasterizer::Rasterize().
+	 *
+	 * @param doc the document containing the page. A read lock
+	 * (PDFDoc::LockRead()) is held while a tile is being rendered.
+	 * @param cancel An optional variable that can be used to stop rendering.
+	 * It is checked before each tile and passed to the rasterizer of each
+	 * tile. The tiles that were not rendered leave the buffer unchanged.
+	 */
+	void Rasterize(PDFDoc& doc, Page& page, UChar* in_out_image_buffer,
+				int width, int height, int stride,
+				int num_comps, bool demult,
+				const Common::Matrix2D& device_mtx,
+				const Rect* clip = 0,
+				bool* cancel = 0);
+
+private:
+	PDFRasterizer& GetRasterizer(int worker);
+
+	Common::WorkStealingScheduler m_scheduler;
+	PDFRasterizer::Type m_type;
+	int m_tile_width;
+	int m_tile_height;
+	ConfigProc m_config;
+	std::vector<std::unique_ptr<PDFRasterizer> > m_rasterizers;
+};
+
+#include <Impl/TileRasterizer.inl>
+
+	};	// namespace PDF
+};	// namespace pdftron
+
+#endif // PDFTRON_CPP11
+
+#endif // PDFTRON_H_CPPPDFTileRasterizer
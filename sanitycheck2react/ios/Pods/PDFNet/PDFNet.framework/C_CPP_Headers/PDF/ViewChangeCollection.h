@@ -13,6 +13,10 @@ public:
 	~ViewChangeCollection();
 	ViewChangeCollection(const ViewChangeCollection& view_change);
 	ViewChangeCollection& operator=(const ViewChangeCollection& view_change);
+#ifdef PDFTRON_CPP11
+	ViewChangeCollection(ViewChangeCollection&& other) noexcept;
+	ViewChangeCollection& operator=(ViewChangeCollection&& other) noexcept;
+#endif
 
 	void Destroy();
 
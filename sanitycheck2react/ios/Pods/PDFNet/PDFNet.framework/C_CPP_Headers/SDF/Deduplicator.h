@@ -0,0 +1,140 @@
+//---------------------------------------------------------------------------------------
+// Copyright (c) 2001-2019 by PDFTron Systems Inc. All Rights Reserved.
+// Consult legal.txt regarding legal and license information.
+//---------------------------------------------------------------------------------------
+#ifndef PDFTRON_H_CPPSDFDeduplicator
+#define PDFTRON_H_CPPSDFDeduplicator
+
+#include <SDF/SDFDoc.h>
+#include <SDF/Obj.h>
+#include <SDF/ObjHasher.h>
+#include <Common/WorkStealingScheduler.h>
+#include <PDF/DocLock.h>
+
+#ifdef PDFTRON_CPP11
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace pdftron {
+	namespace SDF {
+
+/**
+ * Deduplicator finds indirect objects with identical content in a document
+ * (font programs, images, form XObjects, ... that were embedded more than
+ * once, e.g. by merging or stamping) and makes all references point to a
+ * single copy.
+ *
+ * The pass has two stages:
+ *  - all indirect streams, dictionaries and arrays are hashed with
+ *    ObjHasher, in parallel. Each worker thread holds a read lock on the
+ *    document while it hashes a block of objects.
+ *  - the document is write locked. Objects with the same hash are compared
+ *    by content (ObjHasher::Equal()), so a hash collision never merges
+ *    different objects. Every reference to a duplicate is replaced with a
+ *    reference to the copy with the lowest object number.
+ *
+ * The duplicates are no longer referenced afterwards, and are dropped when
+ * the document is saved with SDFDoc::e_remove_unused.
+ *
+ * A sample use case:
+ * @code
+ * Deduplicator dedup;
+ * Deduplicator::Stats stats = dedup.Run(doc.GetSDFDoc());
+ * printf("%u duplicates, %llu stream bytes saved\n",
+ *     stats.duplicates, stats.stream_bytes_saved);
+ * doc.Save(output_path, SDFDoc::e_remove_unused, 0);
+ * @endcode
+ *
+ * @note Objects whose identity matters are never merged, even if their
+ * content is identical: the catalog, page tree nodes, pages, annotations,
+ * form fields, optional content groups, structure elements, signatures and
+ * the objects referenced from the trailer. Objects that reference them are
+ * only merged if they reference the same instance (see
+ * ObjHasher::SetIdentityProc()). Objects that are part of a reference
+ * cycle are not merged either (see ObjHasher::Hash()).
+ * @note No other thread should modify the document during Run(), because
+ * the document is not locked between the two stages. The locks are taken
+ * with PDF::DocReadGuard and PDF::DocWriteGuard, so they are reported by
+ * PDF::LockProfiler.
+ * @note This class requires C++11 (PDFTRON_CPP11).
+ */
+class Deduplicator
+{
+public:
+	/**
+	 * Statistics of a Run() call.
+	 */
+	struct Stats
+	{
+		UInt32 objects;                  ///< The number of indirect objects in the document.
+		UInt32 hashed;                   ///< The number of objects that were hashed.
+		UInt32 duplicates;               ///< The number of objects that were replaced with an identical object.
+		UInt32 references_rewritten;     ///< The number of references that were redirected.
+		UInt64 stream_bytes_hashed;      ///< The number of stream bytes read while hashing.
+		UInt64 stream_bytes_saved;       ///< The encoded size of the duplicate streams.
+		double hash_ms;                  ///< The wall-clock time of the hashing stage.
+		double rewrite_ms;               ///< The wall-clock time of the rewriting stage.
+		double elapsed_ms;               ///< The total time of the Run() call.
+	};
+
+	/**
+	 * @param num_threads the number of worker threads used for hashing. 0
+	 * means one thread per hardware thread.
+	 */
+	explicit Deduplicator(int num_threads = 0);
+
+	/**
+	 * @return the number of worker threads.
+	 */
+	int GetThreadCount() const;
+
+	/**
+	 * Merges the duplicate objects of a document. The caller must not hold a
+	 * lock on the document.
+	 *
+	 * @param doc the document.
+	 * @return the statistics of the pass.
+	 */
+	Stats Run(SDFDoc& doc);
+
+private:
+	typedef std::chrono::steady_clock Clock;
+
+	// The hash of one indirect object.
+	struct Record
+	{
+		ContentHash hash;
+		UInt32 obj_num;
+		UInt64 stream_size;
+
+		bool operator<(const Record& rhs) const
+		{
+			return hash < rhs.hash || (hash == rhs.hash && obj_num < rhs.obj_num);
+		}
+	};
+
+	typedef std::unordered_map<UInt32, Obj> ReplaceMap;
+
+	void HashObjects(SDFDoc& doc, std::vector<Record>& out_records, Stats& stats) const;
+	static bool IsMergeable(Obj obj);
+	static bool IsIdentity(Obj obj);
+	static UInt32 RewriteRefs(Obj container, const ReplaceMap& replace);
+	static double ElapsedMs(Clock::time_point start);
+
+	enum { k_block_size = 256 };
+
+	Common::WorkStealingScheduler m_scheduler;
+};
+
+#include <Impl/Deduplicator.inl>
+
+	};	// namespace SDF
+};	// namespace pdftron
+
+#endif // PDFTRON_CPP11
+
+#endif // PDFTRON_H_CPPSDFDeduplicator
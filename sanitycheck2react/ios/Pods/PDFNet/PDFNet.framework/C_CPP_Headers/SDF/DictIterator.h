@@ -7,6 +7,7 @@
 
 #include <C/Common/TRN_Types.h>
 #include <C/Common/TRN_Iterator.h>
+#include <Common/Iterator.h>
 
 namespace pdftron { 
 	namespace SDF {
@@ -59,6 +60,10 @@ public:
 	 */
 	 DictIterator(const DictIterator& c);
 	 DictIterator& operator=(const DictIterator& other);
+#ifdef PDFTRON_CPP11
+	 DictIterator(DictIterator&& other) noexcept;
+	 DictIterator& operator=(DictIterator&& other) noexcept;
+#endif
 	 ~DictIterator();
 
 	/**
@@ -74,7 +79,28 @@ public:
 // @endcond
 };
 
+#ifdef PDFTRON_CPP11
+/**
+ * DictRange is an STL input range over the key/value pairs of a dictionary.
+ * For more information, please see Obj::DictEntries().
+ */
+typedef Common::IteratorRange<DictIterator> DictRange;
+#endif
+
+	};
+
+#ifdef PDFTRON_CPP11
+	namespace Common {
+
+template <>
+struct RangeTraits<SDF::DictIterator>
+{
+	typedef std::pair<SDF::Obj, SDF::Obj> value_type;
+	static value_type Get(SDF::DictIterator& itr);
+};
+
 	};
+#endif
 };
 
 #include <Impl/SDFDoc.inl>
@@ -6,6 +6,8 @@
 #define PDFTRON_H_CPPSDFSDFObj
 
 #include <Common/Exception.h>
+#include <Common/Iterator.h>
+#include <Common/ByteView.h>
 #include <Common/UString.h>
 #include <Common/Matrix2D.h>
 #include <Filters/FilterWriter.h>
@@ -271,6 +273,28 @@ public:
 	 */
 	 std::vector<unsigned char> GetRawBuffer() const;
 
+	/**
+	 * Same as GetRawBuffer(), but stores the encrypted string buffer in
+	 * 'out', reusing its capacity. Use this overload to read many strings
+	 * without allocating a vector for each of them.
+	 *
+	 * @exception Exception is thrown if this is not a Obj::Type::e_string.
+	 */
+	 void GetRawBuffer(std::vector<unsigned char>& out) const;
+
+#ifndef SWIG
+	/**
+	 * @return a view of the string buffer (see GetBuffer()) and its size.
+	 * The bytes are not copied: the view points to the buffer owned by the
+	 * object, and is valid until the object is modified or destroyed. If
+	 * other threads may modify the document, hold a read lock on it
+	 * (SDFDoc::LockRead()) for as long as the view is used.
+	 *
+	 * @exception Exception is thrown if this is not a Obj::Type::e_string.
+	 */
+	 ByteView GetBufferView () const;
+#endif
+
 	/**
 	 * Convert the SDF/Cos String object to 'PDF Text String' (a Unicode string).
 	 *
@@ -342,6 +366,20 @@ public:
 	 */ 
 	 DictIterator GetDictIterator ();
 
+#ifdef PDFTRON_CPP11
+	/**
+	 * @return a range over the key/value pairs of the dictionary, for use in
+	 * range-based for loops:
+	 * @code
+	 *  for (const std::pair<Obj, Obj>& entry : dict.DictEntries()) {
+	 *      cout << entry.first.GetName() << endl;
+	 *  }
+	 * @endcode
+	 * @see GetDictIterator(), Common::IteratorRange
+	 */
+	 Common::IteratorRange<DictIterator> DictEntries ();
+#endif
+
 	/**
 	 * Search the dictionary for a given key.
 	 * 
@@ -0,0 +1,203 @@
+//---------------------------------------------------------------------------------------
+// Copyright (c) 2001-2019 by PDFTron Systems Inc. All Rights Reserved.
+// Consult legal.txt regarding legal and license information.
+//---------------------------------------------------------------------------------------
+#ifndef PDFTRON_H_CPPSDFObjHasher
+#define PDFTRON_H_CPPSDFObjHasher
+
+#include <SDF/Obj.h>
+#include <SDF/DictIterator.h>
+#include <Filters/FilterReader.h>
+#include <algorithm>
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+#include <string.h>
+
+namespace pdftron {
+	namespace SDF {
+
+/**
+ * A 128 bit content hash of an SDF object, as computed by ObjHasher.
+ */
+struct ContentHash
+{
+	UInt64 h1;
+	UInt64 h2;
+
+	bool operator==(const ContentHash& rhs) const { return h1 == rhs.h1 && h2 == rhs.h2; }
+	bool operator!=(const ContentHash& rhs) const { return !(*this == rhs); }
+	bool operator<(const ContentHash& rhs) const { return h1 < rhs.h1 || (h1 == rhs.h1 && h2 < rhs.h2); }
+};
+
+/**
+ * ObjHasher computes content hashes of SDF objects, so that objects with
+ * the same content can be found across object numbers and across documents
+ * (e.g. the same font program embedded by two source documents).
+ *
+ * The hash covers the object type and value. Dictionary entries are hashed
+ * in key order, so the order in which the entries were written does not
+ * matter. Streams are hashed by their dictionary (without /Length) and their
+ * raw (still encoded, but decrypted) data. An indirect object referenced
+ * from the hashed object contributes its own content hash rather than its
+ * object number, so two graphs with the same content get the same hash.
+ *
+ * The hashes of indirect objects are cached by object number, so an
+ * ObjHasher must only be used with objects of a single document, and
+ * shared objects (e.g. a font descriptor used by several fonts) are hashed
+ * once.
+ *
+ * A sample use case:
+ * @code
+ * ObjHasher hasher;
+ * ContentHash h1, h2;
+ * if (hasher.Hash(font1, h1) && hasher.Hash(font2, h2) && h1 == h2) {
+ *     ... // font1 and font2 have the same content
+ * }
+ * @endcode
+ *
+ * @note The hash is not cryptographic, and a crafted document can contain
+ * different objects with the same hash. Use Equal() to confirm a match
+ * before one object is replaced with another.
+ */
+class ObjHasher
+{
+public:
+	/**
+	 * A function that returns true for objects that must be told apart by
+	 * their identity rather than their content. See SetIdentityProc().
+	 */
+	typedef bool (*IdentityProc)(Obj obj);
+
+	ObjHasher();
+
+	/**
+	 * Sets a function that selects objects whose identity matters (e.g.
+	 * optional content groups, which are distinct layers even if their
+	 * dictionaries are identical). A reference to such an object contributes
+	 * its object number to the hash instead of its content, so two objects
+	 * are only equal if they reference the same instance. Clears the cached
+	 * hashes.
+	 *
+	 * @param proc the function, or 0 to hash all objects by content (the
+	 * default).
+	 */
+	void SetIdentityProc(IdentityProc proc);
+
+	/**
+	 * Computes the content hash of an object.
+	 *
+	 * @param obj the object to hash.
+	 * @param out_hash receives the hash.
+	 * @return true on success. false if the object reaches an object graph
+	 * that cannot be hashed by content: a reference cycle, or a graph nested
+	 * deeper than the maximum depth. Such objects must not be treated as
+	 * duplicates of other objects.
+	 */
+	bool Hash(Obj obj, ContentHash& out_hash);
+
+	/**
+	 * Compares the content of two objects of the same document by the rules
+	 * of Hash(): the order of dictionary entries, the /Length of streams and
+	 * the object numbers of referenced objects do not matter, and objects
+	 * selected by the identity function must be the same instance. Stream
+	 * data is compared byte by byte.
+	 *
+	 * Pairs of indirect objects found to be equal are cached, so comparing
+	 * many objects that share sub-objects stays cheap.
+	 *
+	 * @return true if the objects have the same content. false if they
+	 * differ, or if either reaches a reference cycle or a graph nested deeper
+	 * than the maximum depth.
+	 */
+	bool Equal(Obj a, Obj b);
+
+	/**
+	 * Clears the cached hashes and comparison results. Call this before
+	 * hashing the objects of a different document, or after the hashed
+	 * objects were modified.
+	 */
+	void Clear();
+
+	/**
+	 * @return the number of stream bytes read so far.
+	 */
+	UInt64 GetStreamBytesHashed() const;
+
+// @cond PRIVATE_DOC
+#ifndef SWIGHIDDEN
+	/**
+	 * The incremental hash function used by ObjHasher. Identical byte
+	 * sequences produce the same hash regardless of how they are split
+	 * between calls to Update(). Data is consumed 32 bytes at a time by
+	 * four independent lanes, so consecutive multiplications do not depend
+	 * on each other and the compiler can overlap (or vectorize) them.
+	 */
+	class State
+	{
+	public:
+		State();
+		void Update(const void* data, size_t size);
+		void UpdateByte(UChar value);
+		void UpdateWord(UInt64 value);
+		ContentHash Finish() const;
+
+	private:
+		void Round(const UChar* block);
+		static UInt64 Mix(UInt64 lane, UInt64 word);
+		static UInt64 Load(const UChar* p);
+		static UInt64 Rotl(UInt64 value, int bits);
+		static UInt64 Avalanche(UInt64 value);
+
+		UInt64 m_lanes[4];
+		UInt64 m_size;
+		UChar m_tail[32];
+		size_t m_tail_size;
+	};
+#endif
+// @endcond
+
+private:
+	enum { k_max_depth = 100 };
+
+	struct Entry
+	{
+		ContentHash hash;
+		bool valid;
+	};
+
+	bool HashIndirect(Obj obj, int depth, ContentHash& out_hash);
+	bool HashContent(Obj obj, State& state, int depth);
+	bool HashChild(Obj obj, State& state, int depth);
+	bool HashEntries(Obj dict, State& state, int depth, bool is_stream);
+	static void GetEntries(Obj dict, bool is_stream, std::vector<std::pair<std::string, Obj> >& out_entries);
+	static bool CompareKeys(const std::pair<std::string, Obj>& lhs, const std::pair<std::string, Obj>& rhs);
+	void HashStreamData(Obj stream, State& state);
+
+	bool EqualIndirect(Obj a, Obj b, int depth);
+	bool EqualContent(Obj a, Obj b, int depth);
+	bool EqualChild(Obj a, Obj b, int depth);
+	bool EqualEntries(Obj a, Obj b, int depth, bool is_stream);
+	bool EqualStreamData(Obj a, Obj b);
+	static size_t ReadBlock(Filters::FilterReader& reader, UChar* buf, size_t size);
+
+	typedef std::pair<UInt32, UInt32> ObjPair;
+
+	std::map<UInt32, Entry> m_cache;
+	std::set<UInt32> m_active;
+	std::set<ObjPair> m_equal;
+	std::set<ObjPair> m_comparing;
+	std::vector<UChar> m_buf;
+	std::vector<UChar> m_buf2;
+	UInt64 m_stream_bytes;
+	IdentityProc m_identity_proc;
+};
+
+#include <Impl/ObjHasher.inl>
+
+	};	// namespace SDF
+};	// namespace pdftron
+
+#endif // PDFTRON_H_CPPSDFObjHasher
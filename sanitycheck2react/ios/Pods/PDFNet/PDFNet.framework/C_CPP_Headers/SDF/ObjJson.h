@@ -0,0 +1,128 @@
+//---------------------------------------------------------------------------------------
+// Copyright (c) 2001-2019 by PDFTron Systems Inc. All Rights Reserved.
+// Consult legal.txt regarding legal and license information.
+//---------------------------------------------------------------------------------------
+#ifndef PDFTRON_H_CPPSDFObjJson
+#define PDFTRON_H_CPPSDFObjJson
+
+#include <SDF/Obj.h>
+#include <SDF/ObjSet.h>
+#include <SDF/SDFDoc.h>
+#include <SDF/DictIterator.h>
+#include <Filters/FilterReader.h>
+#include <string>
+#include <vector>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+namespace pdftron {
+	namespace SDF {
+
+/**
+ * ObjJson converts SDF objects to JSON and back. Both directions work on
+ * UTF-8 buffers directly: the writer appends to a std::string and the
+ * parser creates the objects while it reads the buffer, without building
+ * an intermediate tree or converting the text to a UString.
+ *
+ * JSON has fewer types than PDF, so some values are marked with a prefix:
+ *
+ * <pre>
+ * PDF                     JSON
+ * null, true, 12.5        null, true, 12.5
+ * /Name                   "/Name"
+ * (text)                  "s:text"      the string bytes as U+0000..U+00FF
+ * <FEFF...> (UTF-16)      "u:text"      Unicode text strings
+ * 12 0 R                  "12 0 R"      references to indirect objects
+ * [ ... ]                 [ ... ]
+ * << /Key ... >>          { "/Key": ... }
+ * stream                  { "stream": { "/Key": ... }, "data": "base64" }
+ * </pre>
+ *
+ * The mapping is lossless: parsing the output of Write() creates an object
+ * with the same content. The parser also accepts plain JSON, such as the
+ * input of ObjSet::CreateFromJson(): object keys without a leading '/' are
+ * used as names, and strings without a prefix become text strings. An
+ * object whose first key is "stream" is always read as a stream.
+ *
+ * A sample use case:
+ * @code
+ * std::string json;
+ * ObjJson::Write(doc.GetTrailer().FindObj("Info"), json);
+ * ...
+ * Obj info = ObjJson::Parse(doc, json.data(), json.size());
+ * doc.GetTrailer().Put("Info", info);
+ * @endcode
+ */
+class ObjJson
+{
+public:
+	enum WriteFlags
+	{
+		e_default     = 0x00,
+		e_stream_data = 0x01,	// Write the stream data (encoded, but decrypted) as base64.
+		e_ascii       = 0x02	// Escape all non-ASCII characters as \uXXXX.
+	};
+
+	/**
+	 * Appends the JSON representation of an object to a buffer. Indirect
+	 * objects referenced from the object are written as references, so the
+	 * output size is proportional to the object itself.
+	 *
+	 * @param obj the object. If it is an indirect object, its content is
+	 * written.
+	 * @param out the buffer the UTF-8 encoded JSON is appended to.
+	 * @param flags a combination of WriteFlags.
+	 */
+	static void Write(Obj obj, std::string& out, UInt32 flags = e_default);
+
+	/**
+	 * @return the JSON representation of an object.
+	 * @see Write()
+	 */
+	static std::string ToJson(Obj obj, UInt32 flags = e_default);
+
+	/**
+	 * Creates a direct object from JSON. The JSON value must be an object
+	 * or an array, and it must not contain references or streams, because
+	 * these require a document.
+	 *
+	 * @param set the object set that will own the created object.
+	 * @param json the UTF-8 encoded JSON.
+	 * @param size the size of the JSON in bytes.
+	 * @return the created dictionary or array.
+	 * @exception An Exception is thrown if the JSON is invalid.
+	 */
+	static Obj Parse(ObjSet& set, const char* json, size_t size);
+
+	/**
+	 * Creates an indirect object in a document from JSON. References are
+	 * resolved against the document, and streams, including nested ones,
+	 * are created as indirect objects.
+	 *
+	 * @param doc the document.
+	 * @param json the UTF-8 encoded JSON.
+	 * @param size the size of the JSON in bytes.
+	 * @return the created indirect object.
+	 * @exception An Exception is thrown if the JSON is invalid.
+	 */
+	static Obj Parse(SDFDoc& doc, const char* json, size_t size);
+
+private:
+	class Parser;
+
+	static void WriteValue(Obj obj, std::string& out, UInt32 flags, bool top_level, std::vector<UChar>& buf);
+	static void WriteNumber(double value, std::string& out);
+	static void WriteBytes(const char* prefix, const UChar* data, size_t size, std::string& out, UInt32 flags);
+	static bool WriteUTF16(const UChar* data, size_t size, std::string& out, UInt32 flags);
+	static void WriteCodePoint(UInt32 cp, std::string& out, UInt32 flags);
+	static void WriteStreamData(Obj stream, std::string& out, std::vector<UChar>& buf);
+};
+
+#include <Impl/ObjJson.inl>
+
+	};	// namespace SDF
+};	// namespace pdftron
+
+#endif // PDFTRON_H_CPPSDFObjJson
@@ -7,6 +7,7 @@
 
 #include <Common/Matrix2D.h>
 #include <Filters/FilterReader.h>
+#include <Filters/CustomFilter.h>
 #include <vector>
 
 namespace pdftron { 
@@ -411,6 +412,35 @@ public:
 	 *			  the user should acquire a write lock before calling save.
 	 */
 	 void Save(Filters::Filter stream, UInt32 flags, const char* header); 
+
+#ifndef SWIG
+	/**
+	 * Saves the document by passing the serialized file, chunk by chunk, to a
+	 * callback function. Unlike Save(UInt32, const char*), the file is never
+	 * materialized in memory, so the memory used by this method does not depend
+	 * on the size of the document.
+	 *
+	 * @param write_proc the callback receiving the output data. See
+	 * Filters::CustomFilter::WriteProc.
+	 * @param user_data a pointer passed unchanged to 'write_proc'.
+	 * @param flags - A bit field composed of an OR of the SDFDoc::SaveOptions values.
+	 * @param header - File header. A new file header is set only during full save.
+	 *
+	 * @return the total number of bytes passed to 'write_proc'.
+	 *
+	 * @exception - if there is a problem during Save, or if 'write_proc' returns
+	 * less than the size of a chunk, an Exception object will be thrown.
+	 *
+	 * @note - Chunks are delivered in output order, so the running total of the
+	 * chunk sizes can be used to report progress.
+	 *
+	 * @note - The output cannot seek, so SDFDoc::e_linearized is not supported.
+	 *
+	 * @note - Save will modify the SDFDoc object's internal representation.  As such, 
+	 *			  the user should acquire a write lock before calling save.
+	 */
+	 size_t Save(Filters::CustomFilter::WriteProc write_proc, void* user_data, UInt32 flags, const char* header);
+#endif
 	
 	/**
 	 * @return the header string identifying the document version to which the file conforms. 